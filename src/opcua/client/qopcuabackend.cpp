@@ -12,6 +12,9 @@ QOpcUaBackend::QOpcUaBackend()
 QOpcUaBackend::~QOpcUaBackend()
 {}
 
+void QOpcUaBackend::flushNotificationRing()
+{}
+
 // All attributes except Value have a fixed type.
 // A mapping between attribute id and type can be used to simplify the API for writing multiple attributes at once.
 QOpcUa::Types QOpcUaBackend::attributeIdToTypeId(QOpcUa::NodeAttribute attr)
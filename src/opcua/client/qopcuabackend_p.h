@@ -46,6 +46,10 @@ public:
     double revisePublishingInterval(double requestedValue, double minimumValue);
     static bool verifyEndpointDescription(const QOpcUaEndpointDescription &endpoint, QString *message = nullptr);
 
+public Q_SLOTS:
+    // Called after the application has drained the notification ring
+    virtual void flushNotificationRing();
+
 Q_SIGNALS:
     void stateAndOrErrorChanged(QOpcUaClient::ClientState state,
                                 QOpcUaClient::ClientError error);
@@ -54,6 +58,9 @@ Q_SIGNALS:
     void methodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
 
     void dataChangeOccurred(quint64 handle, QOpcUaReadResult res);
+    void dataChangesOccurred(QList<QOpcUaReadResult> results);
+    void notificationsAvailable();
+    void scalarDataChangeOccurred(quint64 handle, QOpcUaScalarDataChange change);
     void eventOccurred(quint64 handle, QVariantList fields);
     void monitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void monitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
@@ -83,6 +90,12 @@ Q_SIGNALS:
     void registerNodesFinished(QStringList nodesToRegister, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
     void unregisterNodesFinished(QStringList nodesToUnregister, QOpcUa::UaStatusCode statusCode);
 
+    void readGroupStatusChanged(quint64 handle, QOpcUa::UaStatusCode statusCode);
+    void readGroupReadFinished(quint64 handle, QList<QOpcUaReadResult> results, QOpcUa::UaStatusCode serviceResult);
+
+    void requestQueueChanged(int queuedRequests, bool saturated);
+    void subscriptionStatisticsReceived(QList<QOpcUaSubscriptionStatistics> statistics);
+
 private:
     Q_DISABLE_COPY(QOpcUaBackend)
 };
@@ -8,6 +8,7 @@
 #include "qopcuaqualifiedname.h"
 
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuanotificationring_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -104,6 +105,31 @@ QT_BEGIN_NAMESPACE
            The given type or data of authentication information is not supported.
 */
 
+/*!
+    \enum QOpcUaClient::Service
+    \since 6.9
+
+    This enum type specifies the OPC UA service of a request counted by \l inFlightRequests().
+
+    \value Read The Read service.
+    \value Write The Write service.
+    \value Browse The Browse and BrowseNext services.
+    \value TranslateBrowsePaths The TranslateBrowsePathsToNodeIds service.
+    \value Call The Call service.
+    \value AddNodes The AddNodes service.
+    \value DeleteNodes The DeleteNodes service.
+    \value AddReferences The AddReferences service.
+    \value DeleteReferences The DeleteReferences service.
+    \value HistoryRead The HistoryRead service.
+    \value RegisterNodes The RegisterNodes service.
+    \value UnregisterNodes The UnregisterNodes service.
+    \value CreateMonitoredItems The CreateMonitoredItems service.
+    \value ModifyMonitoredItems The ModifyMonitoredItems service.
+    \value SetMonitoringMode The SetMonitoringMode service.
+    \value DeleteMonitoredItems The DeleteMonitoredItems service.
+    \value Republish The Republish service.
+*/
+
 /*!
     \property QOpcUaClient::error
     \brief Specifies the current error state of the client.
@@ -280,6 +306,73 @@ QT_BEGIN_NAMESPACE
     \sa unregisterNodes()
 */
 
+/*!
+    \fn void QOpcUaClient::requestQueueChanged(int queuedRequests, bool saturated)
+    \since 6.9
+
+    This signal is emitted when the number of queued requests or the saturation state of the
+    request window has changed. \a queuedRequests is the number of requests waiting to be sent,
+    \a saturated is \c true if the maximum number of requests in flight has been reached.
+
+    Changes are reported at most once per pass of the backend's event loop.
+
+    \sa queuedRequests() isRequestWindowSaturated()
+*/
+
+/*!
+    \fn void QOpcUaClient::subscriptionStatisticsReceived(QList<QOpcUaSubscriptionStatistics> statistics)
+    \since 6.9
+
+    This signal is emitted after a \l requestSubscriptionStatistics() request has been processed.
+    \a statistics contains one entry for each subscription of this client on the server.
+
+    \sa requestSubscriptionStatistics()
+*/
+
+/*!
+    \fn void QOpcUaClient::dataChangesReceived(QList<QOpcUaReadResult> results)
+    \since 6.9
+
+    This signal is emitted if the backend has been created with the \c batchDataChanges backend property
+    and new data change notifications have been received for monitored items of this client.
+    All notifications which have been received in one iteration of the backend, at least the complete
+    content of one publish response, are delivered in \a results.
+
+    Each element contains the node id, attribute, index range, value, timestamps and status code of
+    one data change notification.
+
+    In this mode, data changes are only delivered by this signal and not by \l QOpcUaNode::dataChangeOccurred().
+    This avoids the overhead of dispatching each notification to its \l QOpcUaNode for clients with
+    a large number of monitored items.
+
+    \sa QOpcUaNode::enableMonitoring() QOpcUaProvider::createClient()
+*/
+
+/*!
+    \fn void QOpcUaClient::notificationsAvailable()
+    \since 6.9
+
+    This signal is emitted if the backend has been created with the \c notificationRingCapacity
+    backend property and data change notifications are waiting in the notification ring.
+
+    The signal is emitted once until the notifications have been taken with \l drainNotifications().
+    The notifications should be drained in the slot connected to this signal.
+
+    \sa drainNotifications()
+*/
+
+/*!
+    \typealias QOpcUaClient::NotificationHandler
+    \since 6.9
+
+    The type of the function which is called by \l drainNotifications() for each notification.
+
+    The function receives the \l QOpcUaNode the notification belongs to and the notification
+    in \c change. The attribute, status code and timestamps are always part of \c change.
+    If the value is a scalar numeric, Boolean, DateTime or StatusCode value, it is also stored in \c change
+    and the \c value argument is invalid. Otherwise, the value is passed as \c value.
+*/
+
 /*!
     \internal QOpcUaClientImpl is an opaque type (as seen from the public API).
     This prevents users of the public API to use this constructor (even though
@@ -336,6 +429,22 @@ QOpcUaClient::QOpcUaClient(QOpcUaClientImpl *impl, QObject *parent)
 
     QObject::connect(impl, &QOpcUaClientImpl::unregisterNodesFinished,
                      this, &QOpcUaClient::unregisterNodesFinished);
+
+    QObject::connect(impl, &QOpcUaClientImpl::dataChangesReceived,
+                     this, &QOpcUaClient::dataChangesReceived);
+
+    QObject::connect(impl, &QOpcUaClientImpl::notificationsAvailable,
+                     this, &QOpcUaClient::notificationsAvailable);
+
+    QObject::connect(impl, &QOpcUaClientImpl::requestQueueChanged, this, [this](int queuedRequests, bool saturated) {
+        Q_D(QOpcUaClient);
+        d->m_queuedRequests = queuedRequests;
+        d->m_requestWindowSaturated = saturated;
+        emit requestQueueChanged(queuedRequests, saturated);
+    });
+
+    QObject::connect(impl, &QOpcUaClientImpl::subscriptionStatisticsReceived,
+                     this, &QOpcUaClient::subscriptionStatisticsReceived);
 }
 
 /*!
@@ -490,6 +599,25 @@ QOpcUaNode *QOpcUaClient::node(const QOpcUaExpandedNodeId &expandedNodeId)
         return nullptr;
 }
 
+/*!
+    \since 6.9
+
+    Returns a \l QOpcUaNode object associated with the OPC UA node identified
+    by the parsed node id \a nodeId. The caller becomes owner of the node object.
+
+    This overload avoids parsing a node id string in backends which support it.
+
+    If the client is not connected or \a nodeId is null, \c nullptr is returned.
+*/
+QOpcUaNode *QOpcUaClient::node(const QOpcUaNodeId &nodeId)
+{
+    if (state() != QOpcUaClient::Connected || nodeId.isNull())
+       return nullptr;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->node(nodeId);
+}
+
 /*!
     Requests an update of the namespace array from the server.
     Returns \c true if the operation has been successfully dispatched.
@@ -1098,6 +1226,490 @@ bool QOpcUaClient::unregisterNodes(const QStringList &nodesToUnregister)
     return d->m_impl->unregisterNodes(nodesToUnregister);
 }
 
+/*!
+    \since 6.9
+
+    Creates a read group for the read items in \a nodesToRead and returns it.
+    The caller becomes owner of the returned object.
+
+    The backend prepares the read request for the items once. It is reused for every read
+    of the group which avoids converting the read items for each read of a large set of nodes.
+    If \a useRegisteredNodes is \c true, the nodes are registered with the server and the
+    registered node ids are used for reading.
+
+    Returns \c nullptr if the client is not connected, \a nodesToRead is empty or the backend
+    doesn't support read groups.
+
+    \sa QOpcUaReadGroup readNodeAttributes() registerNodes()
+*/
+QOpcUaReadGroup *QOpcUaClient::createReadGroup(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes)
+{
+    if (state() != QOpcUaClient::Connected || nodesToRead.isEmpty())
+        return nullptr;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->createReadGroup(nodesToRead, useRegisteredNodes);
+}
+
+/*!
+    \since 6.9
+
+    Returns the number of service requests which have been sent to the server and are waiting
+    for a response, keyed by the OPC UA service. Requests sent on behalf of read groups, monitored
+    items and subscriptions are included.
+
+    The counters are intended for diagnostics. An empty hash is returned if the backend doesn't
+    provide these counters.
+*/
+QHash<QOpcUaClient::Service, quint32> QOpcUaClient::inFlightRequests() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->inFlightRequests();
+}
+
+/*!
+    \since 6.9
+
+    Returns the number of requests which are waiting to be sent because the maximum number
+    of requests in flight has been reached.
+
+    The limit is set with the \c maxInFlightRequests backend property, see \l QOpcUaProvider::createClient().
+    Queued requests are sent by priority. Writes and method calls are sent before other requests,
+    browse, browse path resolution and history read requests are sent last.
+
+    \sa isRequestWindowSaturated() requestQueueChanged()
+*/
+int QOpcUaClient::queuedRequests() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_queuedRequests;
+}
+
+/*!
+    \since 6.9
+
+    Returns \c true if the maximum number of requests in flight has been reached and
+    new requests are queued.
+
+    \sa queuedRequests() requestQueueChanged()
+*/
+bool QOpcUaClient::isRequestWindowSaturated() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_requestWindowSaturated;
+}
+
+/*!
+    \since 6.9
+
+    Requests the statistics of all subscriptions of this client.
+
+    Shared subscriptions with the same publishing interval are spread over several subscriptions
+    on the server if the \c maxItemsPerSubscription or \c maxNotificationsPerSubscription backend
+    properties are set, see \l QOpcUaProvider::createClient(). The statistics show how the monitored
+    items are distributed and how many notifications each subscription has delivered.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The result is returned in the \l subscriptionStatisticsReceived() signal.
+    Returns \c false if the backend doesn't provide subscription statistics.
+*/
+bool QOpcUaClient::requestSubscriptionStatistics()
+{
+    Q_D(QOpcUaClient);
+    return d->m_impl->requestSubscriptionStatistics();
+}
+
+/*!
+    \since 6.9
+
+    Takes all data change notifications from the notification ring of this client and
+    calls \a handler for each of them in the order they have been received.
+    Notifications for nodes which have already been deleted are skipped.
+    Notifications for tags are passed to the \l QOpcUaTagSink of the client instead of \a handler.
+
+    Returns the number of notifications taken from the ring.
+
+    \a handler may delete the client. In that case, the remaining notifications are discarded.
+
+    The notification ring is enabled by the \c notificationRingCapacity backend property, see
+    \l QOpcUaProvider::createClient(). The backend writes the notifications into a bounded ring
+    without dispatching a signal for each of them, and emits \l notificationsAvailable() once
+    until the ring has been drained. In this mode, data changes are not delivered
+    by \l QOpcUaNode::dataChangeOccurred() and the attribute cache of the nodes is not updated.
+
+    If the notification ring is not enabled, nothing is done and 0 is returned.
+
+    \sa notificationsAvailable() droppedNotifications() conflatedNotifications()
+*/
+qsizetype QOpcUaClient::drainNotifications(const NotificationHandler &handler)
+{
+    Q_D(QOpcUaClient);
+    return d->m_impl->drainNotifications(handler);
+}
+
+/*!
+    \since 6.9
+
+    Returns the number of data change notifications which have been dropped because
+    the notification ring was full. This happens for the \c DropOldest overflow policy
+    and for the \c Block policy while the client is destroyed.
+
+    \sa drainNotifications()
+*/
+quint64 QOpcUaClient::droppedNotifications() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->m_notificationRing ? d->m_impl->m_notificationRing->droppedCount() : 0;
+}
+
+/*!
+    \since 6.9
+
+    Returns the number of data change notifications which have been replaced by a newer
+    notification for the same monitored item because the notification ring was full.
+    This only happens for the \c Conflate overflow policy.
+
+    \sa drainNotifications()
+*/
+quint64 QOpcUaClient::conflatedNotifications() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->m_notificationRing ? d->m_impl->m_notificationRing->conflatedCount() : 0;
+}
+
+/*!
+    \since 6.9
+
+    Returns the value table of this client or \c nullptr if the backend has not been
+    created with a value table.
+
+    The table is owned by the client. It can be read from any thread as long as the client exists.
+
+    \sa QOpcUaValueTable QOpcUaNode::setValueTableSlot()
+*/
+const QOpcUaValueTable *QOpcUaClient::valueTable() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->m_valueTable.get();
+}
+
+/*!
+    \since 6.9
+
+    Registers \a nodeIds as tags and returns their handles in the same order.
+
+    Tags are nodes which are read, written and monitored without a \l QOpcUaNode object.
+    The results are passed to the \l QOpcUaTagSink set with \l setTagSink().
+    No request is sent to the server, the node ids are checked when they are used.
+
+    An invalid handle is returned for node ids which can't be parsed.
+
+    \sa QOpcUaTagHandle releaseTags()
+*/
+QList<QOpcUaTagHandle> QOpcUaClient::createTags(const QStringList &nodeIds)
+{
+    Q_D(QOpcUaClient);
+
+    QList<QOpcUaTagHandle> tags;
+    tags.reserve(nodeIds.size());
+    for (const auto &nodeId : nodeIds)
+        tags.push_back(d->m_impl->createTag(nodeId));
+
+    return tags;
+}
+
+/*!
+    \since 6.9
+
+    Releases \a tags. Monitored items of the tags are removed.
+    Results for released tags which arrive later are discarded.
+
+    \sa createTags()
+*/
+void QOpcUaClient::releaseTags(const QList<QOpcUaTagHandle> &tags)
+{
+    Q_D(QOpcUaClient);
+    for (const auto &tag : tags)
+        d->m_impl->releaseTag(tag);
+}
+
+/*!
+    \since 6.9
+
+    Returns the node id of \a tag or an empty string if \a tag is not valid for this client.
+*/
+QString QOpcUaClient::tagNodeId(QOpcUaTagHandle tag) const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->tagNodeId(tag);
+}
+
+/*!
+    \since 6.9
+
+    Returns the number of tags which have been created and not been released.
+*/
+qsizetype QOpcUaClient::tagCount() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->tagCount();
+}
+
+/*!
+    \since 6.9
+
+    Sets \a sink as the receiver of the results of the tag functions.
+    The sink is not owned by the client and must exist until it is replaced or the client is destroyed.
+    If no sink is set, the results are discarded.
+
+    \sa QOpcUaTagSink
+*/
+void QOpcUaClient::setTagSink(QOpcUaTagSink *sink)
+{
+    Q_D(QOpcUaClient);
+    d->m_impl->m_tagSink = sink;
+}
+
+/*!
+    \since 6.9
+
+    Returns the sink for the results of the tag functions.
+*/
+QOpcUaTagSink *QOpcUaClient::tagSink() const
+{
+    Q_D(const QOpcUaClient);
+    return d->m_impl->m_tagSink;
+}
+
+/*!
+    \since 6.9
+
+    Starts an asynchronous read of \a attributes of each of \a tags.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The results are passed to \l QOpcUaTagSink::tagAttributesRead() per tag.
+    \c false is returned if one of the tags is invalid or the backend doesn't support tags.
+
+    The tags are read with as few read requests as the operation limits of the server allow.
+*/
+bool QOpcUaClient::readTags(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttributes attributes)
+{
+    Q_D(QOpcUaClient);
+
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    QList<QOpcUaClientImpl::Tag> implTags;
+    if (!d->m_impl->tagsForHandles(tags, &implTags))
+        return false;
+
+    return d->m_impl->readTagAttributes(implTags, attributes);
+}
+
+/*!
+    \since 6.9
+
+    Starts an asynchronous write of \a value to the value attribute of \a tag.
+    If \a type is not set, the type of the value is guessed from \a value.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The result is passed to \l QOpcUaTagSink::tagAttributeWritten().
+*/
+bool QOpcUaClient::writeTag(QOpcUaTagHandle tag, const QVariant &value, QOpcUa::Types type)
+{
+    Q_D(QOpcUaClient);
+
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    QList<QOpcUaClientImpl::Tag> implTags;
+    if (!d->m_impl->tagsForHandles({tag}, &implTags))
+        return false;
+
+    return d->m_impl->writeTagAttribute(implTags.constFirst(), QOpcUa::NodeAttribute::Value, value, type);
+}
+
+/*!
+    \since 6.9
+
+    Starts monitoring \a attributes of each of \a tags with the parameters in \a settings.
+    Like for \l QOpcUaNode::enableMonitoring(), the monitored items are added to a shared subscription
+    with a matching publishing interval unless \a settings specifies a subscription.
+    The monitored items of the same subscription are created in batches.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The results are passed to \l QOpcUaTagSink::tagMonitoringChanged(), data change notifications
+    to \l QOpcUaTagSink::tagDataChanged() and \l QOpcUaTagSink::tagScalarDataChanged().
+    Notifications from the notification ring are passed to the sink by \l drainNotifications().
+*/
+bool QOpcUaClient::enableTagMonitoring(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttributes attributes,
+                                       const QOpcUaMonitoringParameters &settings)
+{
+    Q_D(QOpcUaClient);
+
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    QList<QOpcUaClientImpl::Tag> implTags;
+    if (!d->m_impl->tagsForHandles(tags, &implTags))
+        return false;
+
+    if (!d->m_impl->enableTagMonitoring(implTags, attributes, settings))
+        return false;
+
+    d->m_impl->setTagsMonitored(implTags, attributes, true);
+    return true;
+}
+
+/*!
+    \since 6.9
+
+    Stops monitoring \a attributes of each of \a tags.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The results are passed to \l QOpcUaTagSink::tagMonitoringChanged().
+*/
+bool QOpcUaClient::disableTagMonitoring(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttributes attributes)
+{
+    Q_D(QOpcUaClient);
+
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    QList<QOpcUaClientImpl::Tag> implTags;
+    if (!d->m_impl->tagsForHandles(tags, &implTags))
+        return false;
+
+    QList<quint64> handles;
+    handles.reserve(implTags.size());
+    for (const auto &tag : std::as_const(implTags))
+        handles.push_back(tag.handle);
+
+    if (!d->m_impl->disableTagMonitoring(handles, attributes))
+        return false;
+
+    d->m_impl->setTagsMonitored(implTags, attributes, false);
+    return true;
+}
+
+static bool isMonitoredItemParameter(QOpcUaMonitoringParameters::Parameter item)
+{
+    switch (item) {
+    case QOpcUaMonitoringParameters::Parameter::MonitoringMode:
+    case QOpcUaMonitoringParameters::Parameter::SamplingInterval:
+    case QOpcUaMonitoringParameters::Parameter::QueueSize:
+    case QOpcUaMonitoringParameters::Parameter::DiscardOldest:
+    case QOpcUaMonitoringParameters::Parameter::Filter:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*!
+    \since 6.9
+
+    Sets the parameter \a item of the monitored items for \a attribute of each of \a nodes to \a value.
+    Supported parameters are \l {QOpcUaMonitoringParameters::Parameter} {MonitoringMode},
+    \l {QOpcUaMonitoringParameters::Parameter} {SamplingInterval}, \l {QOpcUaMonitoringParameters::Parameter} {QueueSize},
+    \l {QOpcUaMonitoringParameters::Parameter} {DiscardOldest} and \l {QOpcUaMonitoringParameters::Parameter} {Filter}.
+
+    In contrast to \l QOpcUaNode::modifyMonitoring(), the monitored items of a subscription are modified by a single
+    ModifyMonitoredItems or SetMonitoringMode service call which is split according to the MaxMonitoredItemsPerCall
+    operation limit.
+
+    Returns \c true if the asynchronous call has been successfully dispatched. \c false is returned if one of the nodes
+    doesn't belong to this client, if \a item is not supported or if the backend doesn't support modifying multiple items.
+
+    The result for each node is reported by the \l QOpcUaNode::monitoringStatusChanged() signal.
+
+    \sa setMonitoringMode()
+*/
+bool QOpcUaClient::modifyMonitoring(const QList<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attribute,
+                                    QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    Q_D(QOpcUaClient);
+
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    if (!isMonitoredItemParameter(item)) {
+        qCWarning(QT_OPCUA) << "Modifying" << item << "is not supported for multiple monitored items";
+        return false;
+    }
+
+    QList<quint64> handles;
+    if (!d->m_impl->handlesForNodes(nodes, &handles))
+        return false;
+
+    return d->m_impl->modifyMonitoredItems(handles, attribute, item, value);
+}
+
+/*!
+    \since 6.9
+
+    Sets the monitoring mode of the monitored items for \a attribute of each of \a nodes to \a mode.
+
+    This is a convenience function for \l modifyMonitoring() which is useful to stop sampling
+    the values of many nodes while they are not displayed.
+
+    \sa QOpcUaMonitoringParameters::MonitoringMode
+*/
+bool QOpcUaClient::setMonitoringMode(const QList<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attribute,
+                                     QOpcUaMonitoringParameters::MonitoringMode mode)
+{
+    return modifyMonitoring(nodes, attribute, QOpcUaMonitoringParameters::Parameter::MonitoringMode,
+                            QVariant::fromValue(mode));
+}
+
+/*!
+    \since 6.9
+
+    Sets the parameter \a item of the monitored items for \a attribute of each of \a tags to \a value.
+    The supported parameters and the service calls are the same as for \l modifyMonitoring().
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The results are passed to \l QOpcUaTagSink::tagMonitoringStatusChanged().
+*/
+bool QOpcUaClient::modifyTagMonitoring(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttribute attribute,
+                                       QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    Q_D(QOpcUaClient);
+
+    if (state() != QOpcUaClient::Connected)
+        return false;
+
+    if (!isMonitoredItemParameter(item)) {
+        qCWarning(QT_OPCUA) << "Modifying" << item << "is not supported for multiple monitored items";
+        return false;
+    }
+
+    QList<QOpcUaClientImpl::Tag> implTags;
+    if (!d->m_impl->tagsForHandles(tags, &implTags))
+        return false;
+
+    QList<quint64> handles;
+    handles.reserve(implTags.size());
+    for (const auto &tag : std::as_const(implTags))
+        handles.push_back(tag.handle);
+
+    return d->m_impl->modifyMonitoredItems(handles, attribute, item, value);
+}
+
+/*!
+    \since 6.9
+
+    Sets the monitoring mode of the monitored items for \a attribute of each of \a tags to \a mode.
+
+    This is a convenience function for \l modifyTagMonitoring().
+*/
+bool QOpcUaClient::setTagMonitoringMode(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttribute attribute,
+                                        QOpcUaMonitoringParameters::MonitoringMode mode)
+{
+    return modifyTagMonitoring(tags, attribute, QOpcUaMonitoringParameters::Parameter::MonitoringMode,
+                               QVariant::fromValue(mode));
+}
+
 /*!
     \since 6.7
 
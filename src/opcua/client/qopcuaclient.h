@@ -8,8 +8,13 @@
 #include <QtOpcUa/qopcuaapplicationidentity.h>
 #include <QtOpcUa/qopcuapkiconfiguration.h>
 #include <QtOpcUa/qopcuanode.h>
+#include <QtOpcUa/qopcuanodeid.h>
 #include <QtOpcUa/qopcuareaditem.h>
 #include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuascalardatachange.h>
+#include <QtOpcUa/qopcuasubscriptionstatistics.h>
+#include <QtOpcUa/qopcuataghandle.h>
+#include <QtOpcUa/qopcuavaluetable.h>
 #include <QtOpcUa/qopcuawriteitem.h>
 #include <QtOpcUa/qopcuawriteresult.h>
 #include <QtOpcUa/qopcuaaddnodeitem.h>
@@ -18,9 +23,12 @@
 #include <QtOpcUa/qopcuaendpointdescription.h>
 #include <QtOpcUa/QOpcUaHistoryReadEventRequest>
 
+#include <QtCore/qhash.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qurl.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
 class QOpcUaAuthenticationInformation;
@@ -31,8 +39,10 @@ class QOpcUaConnectionSettings;
 class QOpcUaErrorState;
 class QOpcUaExpandedNodeId;
 class QOpcUaQualifiedName;
+class QOpcUaReadGroup;
 class QOpcUaEndpointDescription;
 class QOpcUaReadRawRequest;
+class QOpcUaTagSink;
 
 class Q_OPCUA_EXPORT QOpcUaClient : public QObject
 {
@@ -60,6 +70,27 @@ public:
     };
     Q_ENUM(ClientError)
 
+    enum class Service {
+        Read,
+        Write,
+        Browse,
+        TranslateBrowsePaths,
+        Call,
+        AddNodes,
+        DeleteNodes,
+        AddReferences,
+        DeleteReferences,
+        HistoryRead,
+        RegisterNodes,
+        UnregisterNodes,
+        CreateMonitoredItems,
+        ModifyMonitoredItems,
+        SetMonitoringMode,
+        DeleteMonitoredItems,
+        Republish,
+    };
+    Q_ENUM(Service)
+
     explicit QOpcUaClient(QOpcUaClientImpl *impl, QObject *parent = nullptr);
     ~QOpcUaClient();
 
@@ -73,6 +104,7 @@ public:
     Q_INVOKABLE void disconnectFromEndpoint();
     QOpcUaNode *node(const QString &nodeId);
     QOpcUaNode *node(const QOpcUaExpandedNodeId &expandedNodeId);
+    QOpcUaNode *node(const QOpcUaNodeId &nodeId);
 
     bool updateNamespaceArray();
     QStringList namespaceArray() const;
@@ -120,6 +152,44 @@ public:
     bool registerNodes(const QStringList &nodesToRegister);
     bool unregisterNodes(const QStringList &nodesToUnregister);
 
+    QOpcUaReadGroup *createReadGroup(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes = false);
+
+    QHash<Service, quint32> inFlightRequests() const;
+    int queuedRequests() const;
+    bool isRequestWindowSaturated() const;
+    bool requestSubscriptionStatistics();
+
+    using NotificationHandler = std::function<void(QOpcUaNode *node, const QOpcUaScalarDataChange &change,
+                                                   const QVariant &value)>;
+    qsizetype drainNotifications(const NotificationHandler &handler);
+    quint64 droppedNotifications() const;
+    quint64 conflatedNotifications() const;
+
+    const QOpcUaValueTable *valueTable() const;
+
+    QList<QOpcUaTagHandle> createTags(const QStringList &nodeIds);
+    void releaseTags(const QList<QOpcUaTagHandle> &tags);
+    QString tagNodeId(QOpcUaTagHandle tag) const;
+    qsizetype tagCount() const;
+
+    void setTagSink(QOpcUaTagSink *sink);
+    QOpcUaTagSink *tagSink() const;
+
+    bool readTags(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttributes attributes = QOpcUa::NodeAttribute::Value);
+    bool writeTag(QOpcUaTagHandle tag, const QVariant &value, QOpcUa::Types type = QOpcUa::Types::Undefined);
+    bool enableTagMonitoring(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttributes attributes,
+                             const QOpcUaMonitoringParameters &settings);
+    bool disableTagMonitoring(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttributes attributes);
+
+    bool modifyMonitoring(const QList<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attribute,
+                          QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
+    bool setMonitoringMode(const QList<QOpcUaNode *> &nodes, QOpcUa::NodeAttribute attribute,
+                           QOpcUaMonitoringParameters::MonitoringMode mode);
+    bool modifyTagMonitoring(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttribute attribute,
+                             QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
+    bool setTagMonitoringMode(const QList<QOpcUaTagHandle> &tags, QOpcUa::NodeAttribute attribute,
+                              QOpcUaMonitoringParameters::MonitoringMode mode);
+
 Q_SIGNALS:
     void connected();
     void disconnected();
@@ -141,6 +211,10 @@ Q_SIGNALS:
     void passwordForPrivateKeyRequired(QString keyFilePath, QString *password, bool previousTryWasInvalid);
     void registerNodesFinished(const QStringList &nodesToRegister, const QStringList &registeredNodeIds, QOpcUa::UaStatusCode statusCode);
     void unregisterNodesFinished(const QStringList &nodesToUnregister, QOpcUa::UaStatusCode statusCode);
+    void dataChangesReceived(QList<QOpcUaReadResult> results);
+    void notificationsAvailable();
+    void requestQueueChanged(int queuedRequests, bool saturated);
+    void subscriptionStatisticsReceived(QList<QOpcUaSubscriptionStatistics> statistics);
 
 private:
     Q_DISABLE_COPY(QOpcUaClient)
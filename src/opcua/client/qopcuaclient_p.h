@@ -51,6 +51,8 @@ public:
     QOpcUaClient::ClientError m_error;
     QOpcUaEndpointDescription m_endpoint;
     bool m_enableNamespaceArrayAutoupdate;
+    int m_queuedRequests = 0;
+    bool m_requestWindowSaturated = false;
 
     bool checkAndSetUrl(const QUrl &url);
     void setStateAndError(QOpcUaClient::ClientState state,
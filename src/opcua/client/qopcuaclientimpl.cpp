@@ -3,10 +3,16 @@
 
 #include <private/qopcuabackend_p.h>
 #include <private/qopcuaclientimpl_p.h>
+#include <private/qopcuanode_p.h>
+#include <private/qopcuanotificationring_p.h>
+#include <private/qopcuasubscriptionrecorder_p.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuatagsink.h>
 #include "qopcuaclient_p.h"
 #include "qopcuaerrorstate.h"
 
+#include <QtCore/qpointer.h>
+
 QT_BEGIN_NAMESPACE
 
 QOpcUaClientImpl::QOpcUaClientImpl(QObject *parent)
@@ -29,14 +35,194 @@ bool QOpcUaClientImpl::registerNode(QPointer<QOpcUaNodeImpl> obj)
         if (!m_handles.contains(m_handleCounter)) {
             obj->setHandle(m_handleCounter);
             m_handles[m_handleCounter] = obj;
+            m_nodeIdIndexValid = false;
             return true;
         }
     }
 }
 
+QOpcUaNode *QOpcUaClientImpl::node(const QOpcUaNodeId &nodeId)
+{
+    return node(nodeId.toString());
+}
+
+QOpcUaReadGroup *QOpcUaClientImpl::createReadGroup(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes)
+{
+    Q_UNUSED(nodesToRead);
+    Q_UNUSED(useRegisteredNodes);
+    return nullptr;
+}
+
+QHash<QOpcUaClient::Service, quint32> QOpcUaClientImpl::inFlightRequests() const
+{
+    return {};
+}
+
+bool QOpcUaClientImpl::requestSubscriptionStatistics()
+{
+    return false;
+}
+
+bool QOpcUaClientImpl::readTagAttributes(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes)
+{
+    Q_UNUSED(tags);
+    Q_UNUSED(attributes);
+    return false;
+}
+
+bool QOpcUaClientImpl::writeTagAttribute(const Tag &tag, QOpcUa::NodeAttribute attribute, const QVariant &value,
+                                         QOpcUa::Types type)
+{
+    Q_UNUSED(tag);
+    Q_UNUSED(attribute);
+    Q_UNUSED(value);
+    Q_UNUSED(type);
+    return false;
+}
+
+bool QOpcUaClientImpl::enableTagMonitoring(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes,
+                                           const QOpcUaMonitoringParameters &settings)
+{
+    Q_UNUSED(tags);
+    Q_UNUSED(attributes);
+    Q_UNUSED(settings);
+    return false;
+}
+
+bool QOpcUaClientImpl::disableTagMonitoring(const QList<quint64> &handles, QOpcUa::NodeAttributes attributes)
+{
+    Q_UNUSED(handles);
+    Q_UNUSED(attributes);
+    return false;
+}
+
+bool QOpcUaClientImpl::modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attribute,
+                                            QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    Q_UNUSED(handles);
+    Q_UNUSED(attribute);
+    Q_UNUSED(item);
+    Q_UNUSED(value);
+    return false;
+}
+
+bool QOpcUaClientImpl::handlesForNodes(const QList<QOpcUaNode *> &nodes, QList<quint64> *handles) const
+{
+    handles->reserve(nodes.size());
+
+    for (const auto node : nodes) {
+        if (!node)
+            return false;
+
+        const auto nodeImpl = static_cast<QOpcUaNodePrivate *>(QObjectPrivate::get(node))->m_impl.get();
+        const auto it = m_handles.constFind(nodeImpl->handle());
+        if (it == m_handles.constEnd() || it->data() != nodeImpl)
+            return false;
+
+        handles->push_back(nodeImpl->handle());
+    }
+
+    return true;
+}
+
+QOpcUaTagHandle QOpcUaClientImpl::createTag(const QString &nodeId)
+{
+    if (nodeId.isEmpty() || !QOpcUa::nodeIdStringSplit(nodeId, nullptr, nullptr, nullptr))
+        return QOpcUaTagHandle();
+
+    quint32 index;
+    if (!m_freeTags.isEmpty()) {
+        index = m_freeTags.takeLast();
+    } else {
+        if (m_tags.size() == (std::numeric_limits<quint32>::max)())
+            return QOpcUaTagHandle();
+        index = quint32(m_tags.size());
+        m_tags.emplace_back();
+    }
+
+    auto &slot = m_tags[index];
+    slot.nodeId = nodeId;
+    // The generation distinguishes the handle from the handles of previously released tags in the same slot
+    ++slot.generation;
+
+    return QOpcUaTagHandle(tagHandleFlag | (quint64(slot.generation) << 32) | index);
+}
+
+void QOpcUaClientImpl::releaseTag(QOpcUaTagHandle tag)
+{
+    const auto index = tagSlot(tag.id());
+    if (index < 0)
+        return;
+
+    auto &slot = m_tags[index];
+    if (slot.monitoredAttributes)
+        disableTagMonitoring({tag.id()}, slot.monitoredAttributes);
+
+    slot.nodeId.clear();
+    slot.monitoredAttributes = {};
+
+    // The generation would wrap around and hand out a handle of a released tag again
+    if (slot.generation == maxTagGeneration)
+        ++m_retiredTagCount;
+    else
+        m_freeTags.push_back(index);
+}
+
+QString QOpcUaClientImpl::tagNodeId(QOpcUaTagHandle tag) const
+{
+    const auto index = tagSlot(tag.id());
+    return index < 0 ? QString() : m_tags.at(index).nodeId;
+}
+
+bool QOpcUaClientImpl::tagsForHandles(const QList<QOpcUaTagHandle> &handles, QList<Tag> *tags) const
+{
+    tags->reserve(handles.size());
+
+    for (const auto &handle : handles) {
+        const auto index = tagSlot(handle.id());
+        if (index < 0)
+            return false;
+        tags->push_back({handle.id(), m_tags.at(index).nodeId});
+    }
+
+    return true;
+}
+
+void QOpcUaClientImpl::setTagsMonitored(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes, bool monitored)
+{
+    for (const auto &tag : tags) {
+        const auto index = tagSlot(tag.handle);
+        if (index < 0)
+            continue;
+
+        auto &monitoredAttributes = m_tags[index].monitoredAttributes;
+        if (monitored)
+            monitoredAttributes |= attributes;
+        else
+            monitoredAttributes &= ~attributes;
+    }
+}
+
+qsizetype QOpcUaClientImpl::tagSlot(quint64 handle) const
+{
+    if (!isTagHandle(handle))
+        return -1;
+
+    const qsizetype index = handle & 0xFFFFFFFF;
+    if (index >= m_tags.size())
+        return -1;
+
+    const auto &slot = m_tags.at(index);
+    if (slot.generation != ((handle >> 32) & maxTagGeneration) || slot.nodeId.isEmpty())
+        return -1;
+
+    return index;
+}
+
 void QOpcUaClientImpl::unregisterNode(QPointer<QOpcUaNodeImpl> obj)
 {
     m_handles.remove(obj->handle());
+    m_nodeIdIndexValid = false;
 }
 
 void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
@@ -45,6 +231,7 @@ void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
     connect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this, &QOpcUaClientImpl::stateAndOrErrorChanged);
     connect(backend, &QOpcUaBackend::attributeWritten, this, &QOpcUaClientImpl::handleAttributeWritten);
     connect(backend, &QOpcUaBackend::dataChangeOccurred, this, &QOpcUaClientImpl::handleDataChangeOccurred);
+    connect(backend, &QOpcUaBackend::scalarDataChangeOccurred, this, &QOpcUaClientImpl::handleScalarDataChangeOccurred);
     connect(backend, &QOpcUaBackend::monitoringEnableDisable, this, &QOpcUaClientImpl::handleMonitoringEnableDisable);
     connect(backend, &QOpcUaBackend::monitoringStatusChanged, this, &QOpcUaClientImpl::handleMonitoringStatusChanged);
     connect(backend, &QOpcUaBackend::methodCallFinished, this, &QOpcUaClientImpl::handleMethodCallFinished);
@@ -64,10 +251,102 @@ void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
     connect(backend, &QOpcUaBackend::passwordForPrivateKeyRequired, this, &QOpcUaClientImpl::passwordForPrivateKeyRequired, Qt::BlockingQueuedConnection);
     connect(backend, &QOpcUaBackend::registerNodesFinished, this, &QOpcUaClientImpl::registerNodesFinished);
     connect(backend, &QOpcUaBackend::unregisterNodesFinished, this, &QOpcUaClientImpl::unregisterNodesFinished);
+    connect(backend, &QOpcUaBackend::dataChangesOccurred, this, &QOpcUaClientImpl::dataChangesReceived);
+    connect(backend, &QOpcUaBackend::notificationsAvailable, this, &QOpcUaClientImpl::notificationsAvailable);
+    connect(this, &QOpcUaClientImpl::notificationRingDrained, backend, &QOpcUaBackend::flushNotificationRing);
+    connect(backend, &QOpcUaBackend::requestQueueChanged, this, &QOpcUaClientImpl::requestQueueChanged);
+    connect(backend, &QOpcUaBackend::subscriptionStatisticsReceived, this, &QOpcUaClientImpl::subscriptionStatisticsReceived);
+}
+
+qsizetype QOpcUaClientImpl::drainNotifications(const QOpcUaClient::NotificationHandler &handler)
+{
+    // The handler may destroy the client, the remaining records are dropped in that case
+    const auto ring = m_notificationRing;
+    if (!ring)
+        return 0;
+
+    const QPointer<QOpcUaClientImpl> self(this);
+    const qsizetype count = ring->drain([this, &self, &handler](QOpcUaNotificationRing::Record &record) {
+        if (!self)
+            return;
+
+        if (isTagHandle(record.handle)) {
+            if (!m_tagSink || tagSlot(record.handle) < 0)
+                return;
+            if (record.value.isValid()) {
+                auto result = record.change.toReadResult();
+                result.setValue(record.value);
+                m_tagSink->tagDataChanged(QOpcUaTagHandle(record.handle), result);
+            } else {
+                m_tagSink->tagScalarDataChanged(QOpcUaTagHandle(record.handle), record.change);
+            }
+            return;
+        }
+
+        const auto it = m_handles.constFind(record.handle);
+        if (it == m_handles.constEnd() || it->isNull() || !(*it)->node())
+            return;
+
+        if (m_recorder) {
+            auto result = record.change.toReadResult();
+            if (record.value.isValid())
+                result.setValue(record.value);
+            QOpcUaSubscriptionRecorderPrivate::get(m_recorder)->recordDataChange((*it)->nodeId(), result);
+        }
+
+        handler((*it)->node(), record.change, record.value);
+    });
+
+    // The backend doesn't wait for the consumer, it must be asked to move its backlog to the ring
+    if (self && ring->hasBacklog())
+        emit notificationRingDrained();
+
+    return count;
+}
+
+void QOpcUaClientImpl::replayDataChange(const QString &nodeId, const QOpcUaReadResult &value)
+{
+    // Replayed notifications are not recorded again
+    const auto handles = handlesForNodeId(nodeId);
+    for (const auto handle : handles) {
+        auto it = m_handles.constFind(handle);
+        if (it != m_handles.constEnd() && !it->isNull())
+            emit (*it)->dataChangeOccurred(value.attribute(), value);
+    }
+}
+
+void QOpcUaClientImpl::replayEvent(const QString &nodeId, const QVariantList &eventFields)
+{
+    const auto handles = handlesForNodeId(nodeId);
+    for (const auto handle : handles) {
+        auto it = m_handles.constFind(handle);
+        if (it != m_handles.constEnd() && !it->isNull())
+            emit (*it)->eventOccurred(eventFields);
+    }
+}
+
+QList<quint64> QOpcUaClientImpl::handlesForNodeId(const QString &nodeId)
+{
+    if (!m_nodeIdIndexValid) {
+        m_nodeIdIndex.clear();
+        for (auto it = m_handles.constBegin(); it != m_handles.constEnd(); ++it) {
+            if (!it->isNull())
+                m_nodeIdIndex[(*it)->nodeId()].push_back(it.key());
+        }
+        m_nodeIdIndexValid = true;
+    }
+
+    return m_nodeIdIndex.value(nodeId);
 }
 
 void QOpcUaClientImpl::handleAttributesRead(quint64 handle, QList<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult)
 {
+    if (isTagHandle(handle)) {
+        if (m_tagSink && tagSlot(handle) >= 0)
+            m_tagSink->tagAttributesRead(QOpcUaTagHandle(handle), attr, serviceResult);
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
         emit (*it)->attributesRead(attr, serviceResult);
@@ -75,6 +354,12 @@ void QOpcUaClientImpl::handleAttributesRead(quint64 handle, QList<QOpcUaReadResu
 
 void QOpcUaClientImpl::handleAttributeWritten(quint64 handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode)
 {
+    if (isTagHandle(handle)) {
+        if (m_tagSink && tagSlot(handle) >= 0)
+            m_tagSink->tagAttributeWritten(QOpcUaTagHandle(handle), attr, statusCode);
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
         emit (*it)->attributeWritten(attr, value, statusCode);
@@ -82,13 +367,50 @@ void QOpcUaClientImpl::handleAttributeWritten(quint64 handle, QOpcUa::NodeAttrib
 
 void QOpcUaClientImpl::handleDataChangeOccurred(quint64 handle, const QOpcUaReadResult &value)
 {
+    if (isTagHandle(handle)) {
+        if (m_tagSink && tagSlot(handle) >= 0)
+            m_tagSink->tagDataChanged(QOpcUaTagHandle(handle), value);
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
+    if (it != m_handles.constEnd() && !it->isNull()) {
+        if (m_recorder)
+            QOpcUaSubscriptionRecorderPrivate::get(m_recorder)->recordDataChange((*it)->nodeId(), value);
         emit (*it)->dataChangeOccurred(value.attribute(), value);
+    }
+}
+
+void QOpcUaClientImpl::handleScalarDataChangeOccurred(quint64 handle, const QOpcUaScalarDataChange &change)
+{
+    if (isTagHandle(handle)) {
+        if (m_tagSink && tagSlot(handle) >= 0)
+            m_tagSink->tagScalarDataChanged(QOpcUaTagHandle(handle), change);
+        return;
+    }
+
+    auto it = m_handles.constFind(handle);
+    if (it != m_handles.constEnd() && !it->isNull()) {
+        if (m_recorder)
+            QOpcUaSubscriptionRecorderPrivate::get(m_recorder)->recordDataChange((*it)->nodeId(), change.toReadResult());
+        emit (*it)->scalarDataChangeOccurred(change);
+    }
 }
 
 void QOpcUaClientImpl::handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
 {
+    if (isTagHandle(handle)) {
+        const auto index = tagSlot(handle);
+        if (index < 0)
+            return;
+        // The monitored item doesn't exist if it couldn't be created or has been removed
+        if (!subscribe || status.statusCode() != QOpcUa::UaStatusCode::Good)
+            m_tags[index].monitoredAttributes.setFlag(attr, false);
+        if (m_tagSink)
+            m_tagSink->tagMonitoringChanged(QOpcUaTagHandle(handle), attr, subscribe, status);
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
         emit (*it)->monitoringEnableDisable(attr, subscribe, status);
@@ -96,6 +418,12 @@ void QOpcUaClientImpl::handleMonitoringEnableDisable(quint64 handle, QOpcUa::Nod
 
 void QOpcUaClientImpl::handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items, QOpcUaMonitoringParameters param)
 {
+    if (isTagHandle(handle)) {
+        if (m_tagSink && tagSlot(handle) >= 0)
+            m_tagSink->tagMonitoringStatusChanged(QOpcUaTagHandle(handle), attr, items, param);
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
         emit (*it)->monitoringStatusChanged(attr, items, param);
@@ -125,9 +453,18 @@ void QOpcUaClientImpl::handleResolveBrowsePathFinished(quint64 handle, QList<QOp
 
 void QOpcUaClientImpl::handleNewEvent(quint64 handle, QVariantList eventFields)
 {
+    if (isTagHandle(handle)) {
+        if (m_tagSink && tagSlot(handle) >= 0)
+            m_tagSink->tagEventOccurred(QOpcUaTagHandle(handle), eventFields);
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
-    if (it != m_handles.constEnd() && !it->isNull())
+    if (it != m_handles.constEnd() && !it->isNull()) {
+        if (m_recorder)
+            QOpcUaSubscriptionRecorderPrivate::get(m_recorder)->recordEvent((*it)->nodeId(), eventFields);
         emit (*it)->eventOccurred(eventFields);
+    }
 }
 
 QT_END_NAMESPACE
@@ -18,18 +18,26 @@
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuaendpointdescription.h>
+#include <QtOpcUa/qopcuataghandle.h>
 #include <private/qopcuanodeimpl_p.h>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qset.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 class QOpcUaNode;
 class QOpcUaClient;
 class QOpcUaBackend;
+class QOpcUaNotificationRing;
+class QOpcUaValueTable;
 class QOpcUaMonitoringParameters;
+class QOpcUaReadGroup;
+class QOpcUaSubscriptionRecorder;
+class QOpcUaTagSink;
 
 class Q_OPCUA_EXPORT QOpcUaClientImpl : public QObject
 {
@@ -42,6 +50,7 @@ public:
     virtual void connectToEndpoint(const QOpcUaEndpointDescription &endpoint) = 0;
     virtual void disconnectFromEndpoint() = 0;
     virtual QOpcUaNode *node(const QString &nodeId) = 0;
+    virtual QOpcUaNode *node(const QOpcUaNodeId &nodeId);
     virtual QString backend() const = 0;
     virtual bool requestEndpoints(const QUrl &url) = 0;
     virtual bool findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris) = 0;
@@ -68,12 +77,58 @@ public:
     virtual bool registerNodes(const QStringList &nodesToRegister) = 0;
     virtual bool unregisterNodes(const QStringList &nodesToUnregister) = 0;
 
+    virtual QOpcUaReadGroup *createReadGroup(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes);
+
+    virtual QHash<QOpcUaClient::Service, quint32> inFlightRequests() const;
+    virtual bool requestSubscriptionStatistics();
+
+    qsizetype drainNotifications(const QOpcUaClient::NotificationHandler &handler);
+
+    // Modifies the monitored items of several nodes or tags with as few service calls as possible
+    virtual bool modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attribute,
+                                      QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
+    // Returns false if one of the nodes doesn't belong to this client
+    bool handlesForNodes(const QList<QOpcUaNode *> &nodes, QList<quint64> *handles) const;
+
+    // Tags use the node services of the backend with handles which don't belong to a node object
+    struct Tag {
+        quint64 handle;
+        QString nodeId;
+    };
+
+    virtual bool readTagAttributes(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes);
+    virtual bool writeTagAttribute(const Tag &tag, QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type);
+    virtual bool enableTagMonitoring(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes,
+                                     const QOpcUaMonitoringParameters &settings);
+    virtual bool disableTagMonitoring(const QList<quint64> &handles, QOpcUa::NodeAttributes attributes);
+
+    QOpcUaTagHandle createTag(const QString &nodeId);
+    void releaseTag(QOpcUaTagHandle tag);
+    QString tagNodeId(QOpcUaTagHandle tag) const;
+    qsizetype tagCount() const { return m_tags.size() - m_freeTags.size() - m_retiredTagCount; }
+    // Returns false if one of the tags is invalid
+    bool tagsForHandles(const QList<QOpcUaTagHandle> &handles, QList<Tag> *tags) const;
+    void setTagsMonitored(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes, bool monitored);
+
+    QOpcUaTagSink *m_tagSink = nullptr; // Not owned, see QOpcUaClient::setTagSink()
+
+    // Delivers recorded notifications to all nodes with the node id
+    void replayDataChange(const QString &nodeId, const QOpcUaReadResult &value);
+    void replayEvent(const QString &nodeId, const QVariantList &eventFields);
+
     QOpcUaClient *m_client;
 
+    // Shared with the backend if notifications are delivered by the ring
+    std::shared_ptr<QOpcUaNotificationRing> m_notificationRing;
+    std::shared_ptr<QOpcUaValueTable> m_valueTable;
+
+    QPointer<QOpcUaSubscriptionRecorder> m_recorder;
+
 private Q_SLOTS:
     void handleAttributesRead(quint64 handle, QList<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
     void handleAttributeWritten(quint64 handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode);
     void handleDataChangeOccurred(quint64 handle, const QOpcUaReadResult &value);
+    void handleScalarDataChangeOccurred(quint64 handle, const QOpcUaScalarDataChange &change);
     void handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                                  QOpcUaMonitoringParameters param);
@@ -104,11 +159,39 @@ signals:
     void passwordForPrivateKeyRequired(const QString keyFilePath, QString *password, bool previousTryWasInvalid);
     void registerNodesFinished(QStringList nodesToRegister, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
     void unregisterNodesFinished(QStringList nodesToUnregister, QOpcUa::UaStatusCode statusCode);
+    void dataChangesReceived(QList<QOpcUaReadResult> results);
+    void notificationsAvailable();
+    // The backend moves the records it couldn't post to the drained ring
+    void notificationRingDrained();
+    void requestQueueChanged(int queuedRequests, bool saturated);
+    void subscriptionStatisticsReceived(QList<QOpcUaSubscriptionStatistics> statistics);
 
 private:
     Q_DISABLE_COPY(QOpcUaClientImpl)
+    QList<quint64> handlesForNodeId(const QString &nodeId);
+
+    // Tag handles have the highest bit set, the generation of the slot in bits 32 to 62 and the slot index in the lower bits
+    static constexpr quint64 tagHandleFlag = quint64(1) << 63;
+    static constexpr quint32 maxTagGeneration = 0x7FFFFFFF;
+    static bool isTagHandle(quint64 handle) { return handle & tagHandleFlag; }
+    qsizetype tagSlot(quint64 handle) const;
+
     QHash<quint64, QPointer<QOpcUaNodeImpl>> m_handles;
     quint64 m_handleCounter;
+
+    // Node id -> handles, rebuilt on demand after nodes have been added or removed
+    QHash<QString, QList<quint64>> m_nodeIdIndex;
+    bool m_nodeIdIndexValid = false;
+
+    struct TagSlot {
+        QString nodeId; // Empty for released tags
+        quint32 generation = 0;
+        QOpcUa::NodeAttributes monitoredAttributes;
+    };
+    QList<TagSlot> m_tags;
+    QList<quint32> m_freeTags;
+    // Slots whose generation is exhausted are not reused
+    qsizetype m_retiredTagCount = 0;
 };
 
 #if QT_VERSION >= 0x060000
@@ -29,16 +29,74 @@ QT_BEGIN_NAMESPACE
     This class manages arrays of Qt OPC UA types with associated array dimensions information.
     It is returned as value when a multidimensional array is received from the server. It can also
     be used as a write value or as parameter for filters and method calls.
+
+    Since Qt 6.9, the values of a numeric array can also be stored in a contiguous typed list like
+    QList<double> instead of a QVariantList, see \l setTypedValueArray().
 */
 
 class QOpcUaMultiDimensionalArrayData : public QSharedData
 {
 public:
     QVariantList value;
+    QVariant typedValue; // QList<T> of a numeric type, replaces value if set
     QList<quint32> arrayDimensions;
     quint32 expectedArrayLength{0};
 };
 
+namespace {
+
+template<typename T>
+bool isTypedList(const QVariant &v)
+{
+    return v.metaType() == QMetaType::fromType<QList<T>>();
+}
+
+// Calls f with the typed list stored in v, returns false if v doesn't contain a supported list type
+template<typename F>
+bool visitTypedList(const QVariant &v, F &&f)
+{
+#define VISIT_TYPED_LIST(T) \
+    if (isTypedList<T>(v)) { \
+        f(*static_cast<const QList<T> *>(v.constData())); \
+        return true; \
+    }
+
+    VISIT_TYPED_LIST(double)
+    VISIT_TYPED_LIST(float)
+    VISIT_TYPED_LIST(qint32)
+    VISIT_TYPED_LIST(quint32)
+    VISIT_TYPED_LIST(qint16)
+    VISIT_TYPED_LIST(quint16)
+    VISIT_TYPED_LIST(qint64)
+    VISIT_TYPED_LIST(quint64)
+    VISIT_TYPED_LIST(signed char)
+    VISIT_TYPED_LIST(uchar)
+    VISIT_TYPED_LIST(bool)
+#undef VISIT_TYPED_LIST
+
+    return false;
+}
+
+qsizetype typedListSize(const QVariant &v)
+{
+    qsizetype size = 0;
+    visitTypedList(v, [&size](const auto &list) { size = list.size(); });
+    return size;
+}
+
+QVariantList typedListToVariantList(const QVariant &v)
+{
+    QVariantList result;
+    visitTypedList(v, [&result](const auto &list) {
+        result.reserve(list.size());
+        for (const auto &entry : list)
+            result.append(QVariant::fromValue(entry));
+    });
+    return result;
+}
+
+} // namespace
+
 /*!
     Default constructs a multi dimensional array with no parameters set.
 */
@@ -117,8 +175,13 @@ void QOpcUaMultiDimensionalArray::setArrayDimensions(const QList<quint32> &array
 */
 bool QOpcUaMultiDimensionalArray::operator==(const QOpcUaMultiDimensionalArray &other) const
 {
-    return arrayDimensions() == other.arrayDimensions() &&
-            valueArray() == other.valueArray();
+    if (arrayDimensions() != other.arrayDimensions())
+        return false;
+
+    if (hasTypedValueArray() && other.hasTypedValueArray())
+        return data->typedValue == other.data->typedValue;
+
+    return valueArray() == other.valueArray();
 }
 
 /*!
@@ -134,14 +197,22 @@ QOpcUaMultiDimensionalArray::operator QVariant() const
 */
 QVariantList QOpcUaMultiDimensionalArray::valueArray() const
 {
+    if (data->typedValue.isValid())
+        return typedListToVariantList(data->typedValue);
     return data->value;
 }
 
 /*!
     Returns a reference to the value array of the multidimensional array.
+
+    If the values are stored in a typed value array, they are converted to a QVariantList first.
 */
 QVariantList &QOpcUaMultiDimensionalArray::valueArrayRef()
 {
+    if (data->typedValue.isValid()) {
+        data->value = typedListToVariantList(data->typedValue);
+        data->typedValue.clear();
+    }
     return data->value;
 }
 
@@ -150,9 +221,58 @@ QVariantList &QOpcUaMultiDimensionalArray::valueArrayRef()
 */
 void QOpcUaMultiDimensionalArray::setValueArray(const QVariantList &value)
 {
+    data->typedValue.clear();
     data->value = value;
 }
 
+/*!
+    \since 6.9
+
+    Returns \c true if the values of the multidimensional array are stored in a typed value array.
+
+    \sa typedValueArray() setTypedValueArray()
+*/
+bool QOpcUaMultiDimensionalArray::hasTypedValueArray() const
+{
+    return data->typedValue.isValid();
+}
+
+/*!
+    \since 6.9
+
+    Returns the typed value array of the multidimensional array or an invalid QVariant
+    if the values are stored in a QVariantList.
+
+    \sa setTypedValueArray() valueArray()
+*/
+QVariant QOpcUaMultiDimensionalArray::typedValueArray() const
+{
+    return data->typedValue;
+}
+
+/*!
+    \since 6.9
+
+    Sets the value array of the multidimensional array to the contiguous list in \a typedValueArray.
+
+    Supported are QList<T> for \c bool, \c {signed char}, \c uchar, \c qint16, \c quint16, \c qint32,
+    \c quint32, \c qint64, \c quint64, \c float and \c double. The values of such an array are converted
+    without creating a QVariant per element when they are written to the server.
+
+    Returns \c false and leaves the array unchanged if \a typedValueArray doesn't contain a supported list type.
+
+    \sa typedValueArray() setValueArray()
+*/
+bool QOpcUaMultiDimensionalArray::setTypedValueArray(const QVariant &typedValueArray)
+{
+    if (!visitTypedList(typedValueArray, [](const auto &) {}))
+        return false;
+
+    data->value.clear();
+    data->typedValue = typedValueArray;
+    return true;
+}
+
 /*!
     Returns the array index in \l valueArray() of the element identified by \a indices.
     If \a indices is invalid for the array or if the array's dimensions don't match
@@ -160,14 +280,16 @@ void QOpcUaMultiDimensionalArray::setValueArray(const QVariantList &value)
 */
 int QOpcUaMultiDimensionalArray::arrayIndex(const QList<quint32> &indices) const
 {
+    const qsizetype size = data->typedValue.isValid() ? typedListSize(data->typedValue) : data->value.size();
+
     // A QList can store INT_MAX values. Depending on the platform, this allows a size > UINT32_MAX
     if (data->expectedArrayLength > static_cast<quint64>((std::numeric_limits<int>::max)()) ||
-            static_cast<quint64>(data->value.size()) > (std::numeric_limits<quint32>::max)())
+            static_cast<quint64>(size) > (std::numeric_limits<quint32>::max)())
         return -1;
 
     // Check number of dimensions and data size
     if (indices.size() != data->arrayDimensions.size() ||
-            data->expectedArrayLength != static_cast<quint32>(data->value.size()))
+            data->expectedArrayLength != static_cast<quint32>(size))
         return -1; // Missing array dimensions or array dimensions don't fit the array
 
     quint32 index = 0;
@@ -199,6 +321,14 @@ QVariant QOpcUaMultiDimensionalArray::value(const QList<quint32> &indices) const
     if (index < 0)
         return QVariant();
 
+    if (data->typedValue.isValid()) {
+        QVariant result;
+        visitTypedList(data->typedValue, [&result, index](const auto &list) {
+            result = QVariant::fromValue(list.at(index));
+        });
+        return result;
+    }
+
     return data->value.at(index);
 }
 
@@ -213,7 +343,7 @@ bool QOpcUaMultiDimensionalArray::setValue(const QList<quint32> &indices, const
     if (index < 0)
         return false;
 
-    data->value[index] = value;
+    valueArrayRef()[index] = value;
     return true;
 }
 
@@ -222,8 +352,10 @@ bool QOpcUaMultiDimensionalArray::setValue(const QList<quint32> &indices, const
 */
 bool QOpcUaMultiDimensionalArray::isValid() const
 {
-    return static_cast<quint64>(data->value.size()) == data->expectedArrayLength &&
-            static_cast<quint64>(data->value.size()) <= (std::numeric_limits<quint32>::max)() &&
+    const qsizetype size = data->typedValue.isValid() ? typedListSize(data->typedValue) : data->value.size();
+
+    return static_cast<quint64>(size) == data->expectedArrayLength &&
+            static_cast<quint64>(size) <= (std::numeric_limits<quint32>::max)() &&
             static_cast<quint64>(data->arrayDimensions.size()) <= (std::numeric_limits<quint32>::max)();
 }
 
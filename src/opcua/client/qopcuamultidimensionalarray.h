@@ -27,6 +27,10 @@ public:
     QVariantList &valueArrayRef();
     void setValueArray(const QVariantList &valueArray);
 
+    bool hasTypedValueArray() const;
+    QVariant typedValueArray() const;
+    bool setTypedValueArray(const QVariant &typedValueArray);
+
     int arrayIndex(const QList<quint32> &indices) const;
     QVariant value(const QList<quint32> &indices) const;
     bool setValue(const QList<quint32> &indices, const QVariant &value);
@@ -164,6 +164,21 @@ QT_BEGIN_NAMESPACE
     \sa attribute() attributeError() serverTimestamp() sourceTimestamp() attributeUpdated()
 */
 
+/*!
+    \fn void QOpcUaNode::scalarDataChangeOccurred(const QOpcUaScalarDataChange &change)
+    \since 6.9
+
+    This signal is emitted after a data change notification with a scalar numeric, Boolean or DateTime value
+    has been received and the client has been created with the \c typedDataChanges backend property.
+    \a change contains the attribute, the value, the status code and the timestamps as plain fields.
+
+    In this mode, the \l dataChangeOccurred(), \l attributeUpdated() and \l valueAttributeUpdated() signals are
+    only emitted if they are connected, and the QVariant for the attribute cache is only created when
+    the cached value is requested.
+
+    \sa QOpcUaScalarDataChange attribute()
+*/
+
 /*!
     \fn void QOpcUaNode::enableMonitoringFinished(QOpcUa::NodeAttribute attr, QOpcUa::UaStatusCode statusCode)
 
@@ -256,6 +271,7 @@ QT_BEGIN_NAMESPACE
 QOpcUaNode::QOpcUaNode(QOpcUaNodeImpl *impl, QOpcUaClient *client, QObject *parent)
     : QObject(*new QOpcUaNodePrivate(impl, client), parent)
 {
+    impl->setNode(this);
     d_func()->createConnections();
 }
 
@@ -319,6 +335,10 @@ bool QOpcUaNode::readAttributes(QOpcUa::NodeAttributes attributes)
 QVariant QOpcUaNode::attribute(QOpcUa::NodeAttribute attribute) const
 {
     Q_D(const QOpcUaNode);
+    auto scalar = d->m_scalarAttributes.constFind(attribute);
+    if (scalar != d->m_scalarAttributes.constEnd())
+        return scalar->value();
+
     auto it = d->m_nodeAttributes.constFind(attribute);
     if (it == d->m_nodeAttributes.constEnd())
         return QVariant();
@@ -355,6 +375,10 @@ QVariant QOpcUaNode::valueAttribute() const
 QOpcUa::UaStatusCode QOpcUaNode::attributeError(QOpcUa::NodeAttribute attribute) const
 {
     Q_D(const QOpcUaNode);
+    auto scalar = d->m_scalarAttributes.constFind(attribute);
+    if (scalar != d->m_scalarAttributes.constEnd())
+        return scalar->statusCode();
+
     auto it = d->m_nodeAttributes.constFind(attribute);
     if (it == d->m_nodeAttributes.constEnd())
         return QOpcUa::UaStatusCode::BadNoEntryExists;
@@ -381,6 +405,10 @@ QOpcUa::UaStatusCode QOpcUaNode::valueAttributeError() const
 QDateTime QOpcUaNode::sourceTimestamp(QOpcUa::NodeAttribute attribute) const
 {
     Q_D(const QOpcUaNode);
+    auto scalar = d->m_scalarAttributes.constFind(attribute);
+    if (scalar != d->m_scalarAttributes.constEnd())
+        return QOpcUaScalarDataChange::toDateTime(scalar->sourceTimestamp());
+
     auto it = d->m_nodeAttributes.constFind(attribute);
     if (it == d->m_nodeAttributes.constEnd())
         return QDateTime();
@@ -396,6 +424,10 @@ QDateTime QOpcUaNode::sourceTimestamp(QOpcUa::NodeAttribute attribute) const
 QDateTime QOpcUaNode::serverTimestamp(QOpcUa::NodeAttribute attribute) const
 {
     Q_D(const QOpcUaNode);
+    auto scalar = d->m_scalarAttributes.constFind(attribute);
+    if (scalar != d->m_scalarAttributes.constEnd())
+        return QOpcUaScalarDataChange::toDateTime(scalar->serverTimestamp());
+
     auto it = d->m_nodeAttributes.constFind(attribute);
     if (it == d->m_nodeAttributes.constEnd())
         return QDateTime();
@@ -622,6 +654,80 @@ bool QOpcUaNode::disableMonitoring(QOpcUa::NodeAttributes attr)
   return d->m_impl->disableMonitoring(attr);
 }
 
+/*!
+    \since 6.9
+
+    Assigns the monitored attribute \a attribute to \a slot of the client's value table.
+    From now on, each data change notification for \a attribute is written to the slot in addition
+    to the normal delivery. Passing -1 for \a slot removes the assignment.
+
+    The assignment is independent of the monitored item, it can be made before monitoring is enabled
+    and persists if monitoring is disabled and enabled again.
+
+    Returns \c false if the client has no value table, \a slot is outside the table
+    or the backend doesn't support value tables.
+
+    \sa QOpcUaClient::valueTable() QOpcUaValueTable
+*/
+bool QOpcUaNode::setValueTableSlot(QOpcUa::NodeAttribute attribute, qsizetype slot)
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull())
+        return false;
+
+    const auto table = d->m_client->valueTable();
+    if (!table || slot < -1 || slot >= table->size())
+        return false;
+
+    return d->m_impl->setValueTableSlot(attribute, slot);
+}
+
+/*!
+    \since 6.9
+
+    Creates a trend buffer for up to \a depth samples of the monitored attribute \a attribute.
+    From now on, each data change notification for \a attribute is appended to the buffer in addition
+    to the normal delivery. A previous trend buffer for \a attribute is replaced by the new buffer.
+    Passing 0 for \a depth removes the trend buffer.
+
+    Returns \c false if the trend buffer would exceed the \c trendBufferMemoryBudget of the client
+    or the backend doesn't support trend buffers. The budget is checked before the buffer is allocated.
+
+    \sa trendBuffer() QOpcUaTrendBuffer
+*/
+bool QOpcUaNode::setTrendBufferDepth(QOpcUa::NodeAttribute attribute, qsizetype depth)
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || depth < 0)
+        return false;
+
+    QSharedPointer<QOpcUaTrendBuffer> buffer;
+    if (!d->m_impl->setTrendBufferDepth(attribute, depth, &buffer))
+        return false;
+
+    if (buffer)
+        d->m_trendBuffers.insert(attribute, buffer);
+    else
+        d->m_trendBuffers.remove(attribute);
+
+    return true;
+}
+
+/*!
+    \since 6.9
+
+    Returns the trend buffer for \a attribute or a null pointer if no trend buffer has been
+    created with \l setTrendBufferDepth().
+
+    The buffer can be read from any thread. It stays valid after the node has been destroyed,
+    but no more samples are appended.
+*/
+QSharedPointer<const QOpcUaTrendBuffer> QOpcUaNode::trendBuffer(QOpcUa::NodeAttribute attribute) const
+{
+    Q_D(const QOpcUaNode);
+    return d->m_trendBuffers.value(attribute);
+}
+
 /*!
     Executes a forward browse call starting from the node this method is called on.
     The browse operation collects information about child nodes connected to the node
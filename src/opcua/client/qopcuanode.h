@@ -8,6 +8,8 @@
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 #include <QtOpcUa/qopcuareferencedescription.h>
+#include <QtOpcUa/qopcuascalardatachange.h>
+#include <QtOpcUa/qopcuatrendbuffer.h>
 #include <QtOpcUa/qopcuatype.h>
 #include <QtOpcUa/qopcuabrowsepathtarget.h>
 #include <QtOpcUa/qopcuarelativepathelement.h>
@@ -17,6 +19,7 @@
 #include <QtCore/qvariant.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qmap.h>
+#include <QtCore/qsharedpointer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -61,6 +64,9 @@ public:
     QOpcUaMonitoringParameters monitoringStatus(QOpcUa::NodeAttribute attr);
     bool modifyEventFilter(const QOpcUaMonitoringParameters::EventFilter &eventFilter);
     bool modifyDataChangeFilter(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::DataChangeFilter &filter);
+    bool setValueTableSlot(QOpcUa::NodeAttribute attribute, qsizetype slot);
+    bool setTrendBufferDepth(QOpcUa::NodeAttribute attribute, qsizetype depth);
+    QSharedPointer<const QOpcUaTrendBuffer> trendBuffer(QOpcUa::NodeAttribute attribute) const;
 
     bool browseChildren(QOpcUa::ReferenceTypeId referenceType = QOpcUa::ReferenceTypeId::HierarchicalReferences,
                         QOpcUa::NodeClasses nodeClassMask = QOpcUa::NodeClass::Undefined);
@@ -86,6 +92,7 @@ Q_SIGNALS:
     void dataChangeOccurred(QOpcUa::NodeAttribute attr, QVariant value);
     void attributeUpdated(QOpcUa::NodeAttribute attr, QVariant value);
     void valueAttributeUpdated(const QVariant &value);
+    void scalarDataChangeOccurred(const QOpcUaScalarDataChange &change);
     void eventOccurred(QVariantList eventFields);
 
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
@@ -21,6 +21,7 @@
 #include <private/qopcuanodeimpl_p.h>
 
 #include <private/qobject_p.h>
+#include <QtCore/qmetaobject.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qscopedpointer.h>
 #include <QtCore/qhash.h>
@@ -60,6 +61,7 @@ public:
         m_connections[index++] = QObject::connect(m_impl.get(), &QOpcUaNodeImpl::dataChangeOccurred,
                 q, [this](QOpcUa::NodeAttribute attr, QOpcUaReadResult value)
         {
+            this->m_scalarAttributes.remove(attr);
             this->m_nodeAttributes[attr] = value;
             Q_Q(QOpcUaNode);
             emit q->dataChangeOccurred(attr, value.value());
@@ -69,6 +71,12 @@ public:
                 emit q->valueAttributeUpdated(value.value());
         });
 
+        m_connections[index++] = QObject::connect(m_impl.get(), &QOpcUaNodeImpl::scalarDataChangeOccurred,
+                q, [this](const QOpcUaScalarDataChange &change)
+        {
+            handleScalarDataChange(change);
+        });
+
         m_connections[index++] = QObject::connect(m_impl.get(), &QOpcUaNodeImpl::monitoringEnableDisable,
                q, [this](QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
         {
@@ -121,6 +129,7 @@ public:
         Q_Q(QOpcUaNode);
 
         for (auto &entry : std::as_const(attr)) {
+            m_scalarAttributes.remove(entry.attribute());
             if (serviceResult == QOpcUa::UaStatusCode::Good)
                 m_nodeAttributes.insert(entry.attribute(), entry);
             else {
@@ -143,6 +152,7 @@ public:
     void handleAttributesWritten(QOpcUa::NodeAttribute attr, const QVariant &value,
                                  QOpcUa::UaStatusCode statusCode)
     {
+        materializeScalarAttribute(attr);
         m_nodeAttributes[attr].setStatusCode(statusCode);
         Q_Q(QOpcUaNode);
 
@@ -157,6 +167,43 @@ public:
         emit q->attributeWritten(attr, statusCode);
     }
 
+    void handleScalarDataChange(const QOpcUaScalarDataChange &change)
+    {
+        Q_Q(QOpcUaNode);
+
+        // The QVariant based cache entry is only created if it is requested
+        m_scalarAttributes.insert(change.attribute(), change);
+
+        emit q->scalarDataChangeOccurred(change);
+
+        static const QMetaMethod dataChangeSignal = QMetaMethod::fromSignal(&QOpcUaNode::dataChangeOccurred);
+        static const QMetaMethod attributeUpdatedSignal = QMetaMethod::fromSignal(&QOpcUaNode::attributeUpdated);
+        static const QMetaMethod valueUpdatedSignal = QMetaMethod::fromSignal(&QOpcUaNode::valueAttributeUpdated);
+
+        const bool isValue = change.attribute() == QOpcUa::NodeAttribute::Value;
+        if (!q->isSignalConnected(dataChangeSignal) && !q->isSignalConnected(attributeUpdatedSignal)
+                && !(isValue && q->isSignalConnected(valueUpdatedSignal))) {
+            return;
+        }
+
+        const QVariant value = change.value();
+        emit q->dataChangeOccurred(change.attribute(), value);
+        emit q->attributeUpdated(change.attribute(), value);
+
+        if (isValue)
+            emit q->valueAttributeUpdated(value);
+    }
+
+    void materializeScalarAttribute(QOpcUa::NodeAttribute attr)
+    {
+        auto it = m_scalarAttributes.find(attr);
+        if (it == m_scalarAttributes.end())
+            return;
+
+        m_nodeAttributes.insert(attr, it->toReadResult());
+        m_scalarAttributes.erase(it);
+    }
+
     void handleMonitoringEnableDisable(QOpcUa::NodeAttribute attr, bool subscribe,
                                        const QOpcUaMonitoringParameters &status)
     {
@@ -225,9 +272,11 @@ public:
     QPointer<QOpcUaClient> m_client;
 
     QHash<QOpcUa::NodeAttribute, QOpcUaReadResult> m_nodeAttributes;
+    QHash<QOpcUa::NodeAttribute, QOpcUaScalarDataChange> m_scalarAttributes; // Newer than the entry in m_nodeAttributes
     QHash<QOpcUa::NodeAttribute, QOpcUaMonitoringParameters> m_monitoringStatus;
+    QHash<QOpcUa::NodeAttribute, QSharedPointer<QOpcUaTrendBuffer>> m_trendBuffers;
 
-    std::array<QMetaObject::Connection, 9> m_connections;
+    std::array<QMetaObject::Connection, 10> m_connections;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,409 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuanodeid.h"
+#include "qopcuanodeid_p.h"
+
+#include <QtCore/qdebug.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaNodeIdData : public QSharedData
+{
+public:
+    QByteArray data; // UTF-8 string or opaque identifier
+    QUuid guid;
+    quint32 numeric = 0;
+    quint16 namespaceIndex = 0;
+    QOpcUaNodeId::IdentifierType type = QOpcUaNodeId::IdentifierType::Null;
+};
+
+/*!
+    \class QOpcUaNodeId
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief The OPC UA NodeId as a parsed value type.
+
+    A node id consists of the index of a namespace and an identifier which is either numeric,
+    a string, a GUID or an opaque byte string.
+
+    Throughout the Qt OPC UA API, node ids are passed as strings like \c {ns=2;s=Demo.Static.Scalar.Double}
+    which must be parsed by the backend for every request. QOpcUaNodeId stores the already parsed components
+    and can be used instead of the string for frequently used nodes, for example in \l QOpcUaReadItem,
+    \l QOpcUaWriteItem and \l QOpcUaClient::node(). The backend then converts the node id without
+    parsing a string.
+
+    QOpcUaNodeId objects can be compared and used as keys in a \l QHash.
+
+    \code
+    const QOpcUaNodeId nodeId(2, QStringLiteral("Demo.Static.Scalar.Double"));
+    QList<QOpcUaReadItem> request { QOpcUaReadItem(nodeId) };
+    client->readNodeAttributes(request);
+    \endcode
+*/
+
+/*!
+    \enum QOpcUaNodeId::IdentifierType
+
+    This enum specifies the type of the identifier of a node id.
+
+    \value Null The node id is null.
+    \value Numeric The identifier is a 32 bit unsigned integer.
+    \value String The identifier is a string.
+    \value Guid The identifier is a GUID.
+    \value Opaque The identifier is an opaque byte string.
+*/
+
+/*!
+    Constructs a null node id.
+*/
+QOpcUaNodeId::QOpcUaNodeId()
+    : data(new QOpcUaNodeIdData)
+{
+}
+
+/*!
+    Constructs a node id with namespace index \a namespaceIndex and the numeric identifier \a identifier.
+*/
+QOpcUaNodeId::QOpcUaNodeId(quint16 namespaceIndex, quint32 identifier)
+    : data(new QOpcUaNodeIdData)
+{
+    data->numeric = identifier;
+    data->namespaceIndex = namespaceIndex;
+    data->type = IdentifierType::Numeric;
+}
+
+/*!
+    Constructs a node id with namespace index \a namespaceIndex and the string identifier \a identifier.
+*/
+QOpcUaNodeId::QOpcUaNodeId(quint16 namespaceIndex, const QString &identifier)
+    : data(new QOpcUaNodeIdData)
+{
+    data->data = identifier.toUtf8();
+    data->namespaceIndex = namespaceIndex;
+    data->type = IdentifierType::String;
+}
+
+/*!
+    Constructs a node id with namespace index \a namespaceIndex and the GUID identifier \a identifier.
+*/
+QOpcUaNodeId::QOpcUaNodeId(quint16 namespaceIndex, const QUuid &identifier)
+    : data(new QOpcUaNodeIdData)
+{
+    data->guid = identifier;
+    data->namespaceIndex = namespaceIndex;
+    data->type = IdentifierType::Guid;
+}
+
+/*!
+    Constructs a node id from \a other.
+*/
+QOpcUaNodeId::QOpcUaNodeId(const QOpcUaNodeId &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this node id.
+*/
+QOpcUaNodeId &QOpcUaNodeId::operator=(const QOpcUaNodeId &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaNodeId::~QOpcUaNodeId()
+{
+}
+
+/*!
+    Returns a node id with namespace index \a namespaceIndex and the opaque identifier \a identifier.
+*/
+QOpcUaNodeId QOpcUaNodeId::fromOpaque(quint16 namespaceIndex, const QByteArray &identifier)
+{
+    QOpcUaNodeId result;
+    result.data->data = identifier;
+    result.data->namespaceIndex = namespaceIndex;
+    result.data->type = IdentifierType::Opaque;
+    return result;
+}
+
+/*!
+    Returns a node id with namespace index \a namespaceIndex and the UTF-8 encoded string identifier \a identifier.
+*/
+QOpcUaNodeId QOpcUaNodeId::fromUtf8String(quint16 namespaceIndex, const QByteArray &identifier)
+{
+    QOpcUaNodeId result;
+    result.data->data = identifier;
+    result.data->namespaceIndex = namespaceIndex;
+    result.data->type = IdentifierType::String;
+    return result;
+}
+
+bool qt_opcuaSplitNodeIdString(QStringView nodeIdString, quint16 *nsIndex, QStringView *identifier, char *identifierType)
+{
+    quint16 namespaceIndex = 0;
+
+    const qsizetype separator = nodeIdString.indexOf(u';');
+    QStringView identifierPart = nodeIdString;
+
+    if (separator >= 0) {
+        if (nodeIdString.indexOf(u';', separator + 1) >= 0)
+            return false;
+
+        const QStringView namespacePart = nodeIdString.first(separator);
+        identifierPart = nodeIdString.sliced(separator + 1);
+
+        // A namespace component which doesn't start with "ns=" followed by a digit is ignored
+        if (namespacePart.size() > 3 && namespacePart.startsWith(u"ns=")
+                && namespacePart.at(3) >= u'0' && namespacePart.at(3) <= u'9') {
+            bool success = false;
+            const uint ns = namespacePart.sliced(3).toUInt(&success);
+            if (!success || ns > (std::numeric_limits<quint16>::max)())
+                return false;
+            namespaceIndex = ns;
+        }
+    }
+
+    if (identifierPart.size() < 3 || identifierPart.at(1) != u'=')
+        return false;
+
+    const char16_t type = identifierPart.at(0).unicode();
+    if (type != u'i' && type != u's' && type != u'g' && type != u'b')
+        return false;
+
+    if (nsIndex)
+        *nsIndex = namespaceIndex;
+    if (identifier)
+        *identifier = identifierPart.sliced(2);
+    if (identifierType)
+        *identifierType = static_cast<char>(type);
+
+    return true;
+}
+
+/*!
+    Parses the node id string \a nodeId, for example \c {ns=2;s=MyString}, and returns the node id.
+    If no namespace index is given, namespace 0 is assumed.
+
+    If \a ok is not \c nullptr, it is set to \c true if the string has been parsed successfully.
+    A null node id is returned if \a nodeId is not a valid node id string.
+
+    \sa toString()
+*/
+QOpcUaNodeId QOpcUaNodeId::fromString(QStringView nodeId, bool *ok)
+{
+    if (ok)
+        *ok = false;
+
+    quint16 namespaceIndex = 0;
+    QStringView identifier;
+    char identifierType = 0;
+
+    if (!qt_opcuaSplitNodeIdString(nodeId, &namespaceIndex, &identifier, &identifierType))
+        return QOpcUaNodeId();
+
+    QOpcUaNodeId result;
+
+    switch (identifierType) {
+    case 'i': {
+        bool isNumber = false;
+        const uint numeric = identifier.toUInt(&isNumber);
+        if (!isNumber)
+            return QOpcUaNodeId();
+        result = QOpcUaNodeId(namespaceIndex, static_cast<quint32>(numeric));
+        break;
+    }
+    case 's':
+        result = fromUtf8String(namespaceIndex, identifier.toUtf8());
+        break;
+    case 'g': {
+        const QUuid uuid = QUuid::fromString(identifier);
+        if (uuid.isNull())
+            return QOpcUaNodeId();
+        result = QOpcUaNodeId(namespaceIndex, uuid);
+        break;
+    }
+    case 'b': {
+        const QByteArray opaque = QByteArray::fromBase64(identifier.toLatin1());
+        if (opaque.isEmpty())
+            return QOpcUaNodeId();
+        result = fromOpaque(namespaceIndex, opaque);
+        break;
+    }
+    default:
+        return QOpcUaNodeId();
+    }
+
+    if (ok)
+        *ok = true;
+    return result;
+}
+
+/*!
+    Returns the string representation of this node id, for example \c {ns=2;s=MyString}.
+    An empty string is returned for a null node id.
+
+    \sa fromString()
+*/
+QString QOpcUaNodeId::toString() const
+{
+    QString result = QStringLiteral("ns=%1;").arg(data->namespaceIndex);
+
+    switch (data->type) {
+    case IdentifierType::Numeric:
+        result.append(QLatin1String("i=")).append(QString::number(data->numeric));
+        break;
+    case IdentifierType::String:
+        result.append(QLatin1String("s=")).append(QString::fromUtf8(data->data));
+        break;
+    case IdentifierType::Guid:
+        result.append(QLatin1String("g=")).append(QStringView(data->guid.toString()).mid(1, 36)); // Remove enclosing {...}
+        break;
+    case IdentifierType::Opaque:
+        result.append(QLatin1String("b=")).append(QString::fromLatin1(data->data.toBase64()));
+        break;
+    default:
+        return QString();
+    }
+
+    return result;
+}
+
+/*!
+    Returns \c true if this node id is null.
+*/
+bool QOpcUaNodeId::isNull() const
+{
+    return data->type == IdentifierType::Null;
+}
+
+/*!
+    Returns the namespace index of this node id.
+*/
+quint16 QOpcUaNodeId::namespaceIndex() const
+{
+    return data->namespaceIndex;
+}
+
+/*!
+    Returns the type of the identifier of this node id.
+*/
+QOpcUaNodeId::IdentifierType QOpcUaNodeId::identifierType() const
+{
+    return data->type;
+}
+
+/*!
+    Returns the numeric identifier or \c 0 if the identifier is not numeric.
+*/
+quint32 QOpcUaNodeId::numericIdentifier() const
+{
+    return data->type == IdentifierType::Numeric ? data->numeric : 0;
+}
+
+/*!
+    Returns the string identifier or an empty string if the identifier is not a string.
+*/
+QString QOpcUaNodeId::stringIdentifier() const
+{
+    return data->type == IdentifierType::String ? QString::fromUtf8(data->data) : QString();
+}
+
+/*!
+    Returns the UTF-8 encoded string identifier or an empty byte array if the identifier is not a string.
+*/
+QByteArray QOpcUaNodeId::utf8StringIdentifier() const
+{
+    return data->type == IdentifierType::String ? data->data : QByteArray();
+}
+
+/*!
+    Returns the GUID identifier or a null QUuid if the identifier is not a GUID.
+*/
+QUuid QOpcUaNodeId::guidIdentifier() const
+{
+    return data->type == IdentifierType::Guid ? data->guid : QUuid();
+}
+
+/*!
+    Returns the opaque identifier or an empty byte array if the identifier is not opaque.
+*/
+QByteArray QOpcUaNodeId::opaqueIdentifier() const
+{
+    return data->type == IdentifierType::Opaque ? data->data : QByteArray();
+}
+
+/*!
+    \fn bool QOpcUaNodeId::operator==(const QOpcUaNodeId &lhs, const QOpcUaNodeId &rhs)
+
+    Returns \c true if \a lhs and \a rhs have the same namespace index and identifier.
+*/
+bool operator==(const QOpcUaNodeId &lhs, const QOpcUaNodeId &rhs) noexcept
+{
+    if (lhs.data == rhs.data)
+        return true;
+    if (lhs.data->type != rhs.data->type || lhs.data->namespaceIndex != rhs.data->namespaceIndex)
+        return false;
+
+    switch (lhs.data->type) {
+    case QOpcUaNodeId::IdentifierType::Numeric:
+        return lhs.data->numeric == rhs.data->numeric;
+    case QOpcUaNodeId::IdentifierType::Guid:
+        return lhs.data->guid == rhs.data->guid;
+    case QOpcUaNodeId::IdentifierType::String:
+    case QOpcUaNodeId::IdentifierType::Opaque:
+        return lhs.data->data == rhs.data->data;
+    default:
+        return true;
+    }
+}
+
+/*!
+    \fn bool QOpcUaNodeId::operator!=(const QOpcUaNodeId &lhs, const QOpcUaNodeId &rhs)
+
+    Returns \c true if \a lhs and \a rhs differ in namespace index or identifier.
+*/
+
+/*!
+    \fn size_t QOpcUaNodeId::qHash(const QOpcUaNodeId &key, size_t seed)
+
+    Returns the hash value for \a key, using \a seed to seed the calculation.
+*/
+size_t qHash(const QOpcUaNodeId &key, size_t seed) noexcept
+{
+    switch (key.data->type) {
+    case QOpcUaNodeId::IdentifierType::Numeric:
+        return qHashMulti(seed, key.data->namespaceIndex, key.data->numeric);
+    case QOpcUaNodeId::IdentifierType::Guid:
+        return qHashMulti(seed, key.data->namespaceIndex, key.data->guid);
+    case QOpcUaNodeId::IdentifierType::String:
+    case QOpcUaNodeId::IdentifierType::Opaque:
+        return qHashMulti(seed, key.data->namespaceIndex, static_cast<quint8>(key.data->type), key.data->data);
+    default:
+        return seed;
+    }
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+
+/*!
+    \fn QDebug QOpcUaNodeId::operator<<(QDebug debug, const QOpcUaNodeId &nodeId)
+
+    Writes \a nodeId to the \a debug output.
+
+    \sa QDebug
+*/
+QDebug operator<<(QDebug debug, const QOpcUaNodeId &nodeId)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace().quote() << "QOpcUaNodeId(" << nodeId.toString() << ")";
+    return debug;
+}
+
+#endif
+
+QT_END_NAMESPACE
@@ -0,0 +1,78 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUANODEID_H
+#define QOPCUANODEID_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhashfunctions.h>
+#include <QtCore/qmetatype.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstring.h>
+#include <QtCore/quuid.h>
+
+QT_BEGIN_NAMESPACE
+
+class QDebug;
+
+class QOpcUaNodeIdData;
+class Q_OPCUA_EXPORT QOpcUaNodeId
+{
+public:
+    enum class IdentifierType : quint8 {
+        Null,
+        Numeric,
+        String,
+        Guid,
+        Opaque
+    };
+
+    QOpcUaNodeId();
+    QOpcUaNodeId(quint16 namespaceIndex, quint32 identifier);
+    QOpcUaNodeId(quint16 namespaceIndex, const QString &identifier);
+    QOpcUaNodeId(quint16 namespaceIndex, const QUuid &identifier);
+    QOpcUaNodeId(const QOpcUaNodeId &other);
+    QOpcUaNodeId &operator=(const QOpcUaNodeId &rhs);
+    ~QOpcUaNodeId();
+
+    static QOpcUaNodeId fromOpaque(quint16 namespaceIndex, const QByteArray &identifier);
+    static QOpcUaNodeId fromUtf8String(quint16 namespaceIndex, const QByteArray &identifier);
+    static QOpcUaNodeId fromString(QStringView nodeId, bool *ok = nullptr);
+
+    QString toString() const;
+
+    bool isNull() const;
+
+    quint16 namespaceIndex() const;
+    IdentifierType identifierType() const;
+
+    quint32 numericIdentifier() const;
+    QString stringIdentifier() const;
+    QByteArray utf8StringIdentifier() const;
+    QUuid guidIdentifier() const;
+    QByteArray opaqueIdentifier() const;
+
+private:
+    QSharedDataPointer<QOpcUaNodeIdData> data;
+
+    friend Q_OPCUA_EXPORT bool operator==(const QOpcUaNodeId &lhs, const QOpcUaNodeId &rhs) noexcept;
+    friend inline bool operator!=(const QOpcUaNodeId &lhs, const QOpcUaNodeId &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    friend Q_OPCUA_EXPORT size_t qHash(const QOpcUaNodeId &key, size_t seed) noexcept;
+
+#ifndef QT_NO_DEBUG_STREAM
+    friend Q_OPCUA_EXPORT QDebug operator<<(QDebug debug, const QOpcUaNodeId &nodeId);
+#endif
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaNodeId, Q_RELOCATABLE_TYPE);
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaNodeId)
+
+#endif // QOPCUANODEID_H
@@ -0,0 +1,29 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUANODEID_P_H
+#define QOPCUANODEID_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuanodeid.h>
+
+#include <QtCore/qstringview.h>
+
+QT_BEGIN_NAMESPACE
+
+// Splits a node id string like "ns=1;s=MyString" without allocating, see QOpcUa::nodeIdStringSplit()
+bool qt_opcuaSplitNodeIdString(QStringView nodeIdString, quint16 *nsIndex, QStringView *identifier, char *identifierType);
+
+QT_END_NAMESPACE
+
+#endif // QOPCUANODEID_P_H
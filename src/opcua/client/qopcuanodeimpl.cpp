@@ -35,4 +35,29 @@ void QOpcUaNodeImpl::setRegistered(bool registered)
     m_registered = registered;
 }
 
+QOpcUaNode *QOpcUaNodeImpl::node() const
+{
+    return m_node;
+}
+
+void QOpcUaNodeImpl::setNode(QOpcUaNode *node)
+{
+    m_node = node;
+}
+
+bool QOpcUaNodeImpl::setValueTableSlot(QOpcUa::NodeAttribute attr, qsizetype slot)
+{
+    Q_UNUSED(attr);
+    Q_UNUSED(slot);
+    return false;
+}
+
+bool QOpcUaNodeImpl::setTrendBufferDepth(QOpcUa::NodeAttribute attr, qsizetype depth, QSharedPointer<QOpcUaTrendBuffer> *buffer)
+{
+    Q_UNUSED(attr);
+    Q_UNUSED(depth);
+    Q_UNUSED(buffer);
+    return false;
+}
+
 QT_END_NAMESPACE
@@ -22,6 +22,7 @@
 #include <QtOpcUa/qopcuareaditem.h>
 #include <QtOpcUa/qopcuareadresult.h>
 #include <QtOpcUa/qopcuarelativepathelement.h>
+#include <QtOpcUa/qopcuascalardatachange.h>
 #include <QtOpcUa/qopcuatype.h>
 #include <QtOpcUa/qopcuahistoryreadrawrequest.h>
 
@@ -56,18 +57,26 @@ public:
 
     virtual bool resolveBrowsePath(const QList<QOpcUaRelativePathElement> &path) = 0;
 
+    virtual bool setValueTableSlot(QOpcUa::NodeAttribute attr, qsizetype slot);
+    // Creates the buffer only if it fits into the trend buffer memory budget, depth 0 removes the buffer
+    virtual bool setTrendBufferDepth(QOpcUa::NodeAttribute attr, qsizetype depth, QSharedPointer<QOpcUaTrendBuffer> *buffer);
+
     quint64 handle() const;
     void setHandle(quint64 handle);
 
     bool registered() const;
     void setRegistered(bool registered);
 
+    QOpcUaNode *node() const;
+    void setNode(QOpcUaNode *node);
+
 Q_SIGNALS:
     void attributesRead(QList<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
     void attributeWritten(QOpcUa::NodeAttribute attr, QVariant value, QOpcUa::UaStatusCode statusCode);
     void browseFinished(QList<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
 
     void dataChangeOccurred(QOpcUa::NodeAttribute attr, QOpcUaReadResult value);
+    void scalarDataChangeOccurred(QOpcUaScalarDataChange change);
     void eventOccurred(QVariantList eventFields);
     void monitoringEnableDisable(QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
@@ -80,6 +89,7 @@ Q_SIGNALS:
 private:
     quint64 m_handle;
     bool m_registered;
+    QOpcUaNode *m_node = nullptr; // The node owns this object
 };
 
 QT_END_NAMESPACE
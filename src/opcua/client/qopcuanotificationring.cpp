@@ -0,0 +1,195 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuanotificationring_p.h"
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qthread.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+QOpcUaNotificationRing::QOpcUaNotificationRing(quint32 capacity, OverflowPolicy policy)
+    // The sequence numbers of a slot must not collide, this requires at least two slots
+    : m_capacity(qNextPowerOfTwo(std::max<quint32>(capacity, 2) - 1))
+    , m_mask(m_capacity - 1)
+    , m_policy(policy)
+    , m_slots(new Slot[m_capacity])
+{
+    for (quint32 i = 0; i < m_capacity; ++i)
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+QOpcUaNotificationRing::~QOpcUaNotificationRing() = default;
+
+bool QOpcUaNotificationRing::overflowPolicyFromString(QStringView name, OverflowPolicy *policy)
+{
+    if (name.compare(QLatin1StringView("Block"), Qt::CaseInsensitive) == 0)
+        *policy = OverflowPolicy::Block;
+    else if (name.compare(QLatin1StringView("DropOldest"), Qt::CaseInsensitive) == 0)
+        *policy = OverflowPolicy::DropOldest;
+    else if (name.compare(QLatin1StringView("Conflate"), Qt::CaseInsensitive) == 0)
+        *policy = OverflowPolicy::Conflate;
+    else
+        return false;
+
+    return true;
+}
+
+bool QOpcUaNotificationRing::post(Record &&record)
+{
+    switch (m_policy) {
+    case OverflowPolicy::Block:
+        flushBacklog();
+
+        // Records must not overtake the backlog
+        if (!m_backlog.isEmpty() || !tryEnqueue(record)) {
+            if (m_closed.load(std::memory_order_acquire)) {
+                m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            m_backlog.enqueue(std::move(record));
+        }
+        break;
+    case OverflowPolicy::DropOldest:
+        while (!tryEnqueue(record)) {
+            // The ring is full, the slot of the oldest record is the slot for the new record
+            const quint64 oldest = m_enqueuePosition.load(std::memory_order_relaxed) - m_capacity;
+            Slot &slot = m_slots[oldest & m_mask];
+            quint64 expected = oldest;
+
+            if (slot.sequence.load(std::memory_order_acquire) == oldest + 1
+                    && m_dequeuePosition.compare_exchange_strong(expected, oldest + 1, std::memory_order_relaxed)) {
+                slot.record = Record();
+                slot.sequence.store(oldest + m_capacity, std::memory_order_release);
+                m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                // The consumer is taking the record out of the slot
+                QThread::yieldCurrentThread();
+            }
+        }
+        break;
+    case OverflowPolicy::Conflate:
+        flushBacklog();
+
+        // Records for the same handle must not overtake the conflated records
+        if (!m_conflated.isEmpty() || !tryEnqueue(record)) {
+            auto it = m_conflated.find(record.handle);
+            if (it != m_conflated.end()) {
+                *it = std::move(record);
+                m_conflatedCount.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                m_conflatedOrder.enqueue(record.handle);
+                m_conflated.insert(record.handle, std::move(record));
+            }
+        }
+        break;
+    }
+
+    // The consumer checks the flag after draining, it is set before the consumer is notified
+    if (m_policy != OverflowPolicy::DropOldest)
+        m_backlogPending.store(!m_backlog.isEmpty() || !m_conflatedOrder.isEmpty(), std::memory_order_seq_cst);
+
+    return notifyConsumer();
+}
+
+bool QOpcUaNotificationRing::flush()
+{
+    if (m_policy == OverflowPolicy::DropOldest || !flushBacklog())
+        return false;
+
+    return notifyConsumer();
+}
+
+void QOpcUaNotificationRing::close()
+{
+    m_closed.store(true, std::memory_order_release);
+}
+
+qsizetype QOpcUaNotificationRing::drain(qxp::function_ref<void(Record &record)> handler)
+{
+    // Records posted from now on must trigger a new notification
+    m_consumerNotified.store(false, std::memory_order_seq_cst);
+
+    qsizetype count = 0;
+    Record record;
+    while (tryDequeue(&record)) {
+        handler(record);
+        ++count;
+    }
+
+    return count;
+}
+
+bool QOpcUaNotificationRing::tryEnqueue(Record &record)
+{
+    const quint64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Slot &slot = m_slots[position & m_mask];
+
+    if (slot.sequence.load(std::memory_order_acquire) != position)
+        return false;
+
+    slot.record = std::move(record);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    m_enqueuePosition.store(position + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+bool QOpcUaNotificationRing::tryDequeue(Record *record)
+{
+    quint64 position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+    while (true) {
+        Slot &slot = m_slots[position & m_mask];
+        const auto difference = static_cast<qint64>(slot.sequence.load(std::memory_order_acquire) - (position + 1));
+
+        if (difference < 0)
+            return false;
+
+        if (difference > 0) {
+            // The producer has dropped the record
+            position = m_dequeuePosition.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            *record = std::exchange(slot.record, Record());
+            slot.sequence.store(position + m_capacity, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+bool QOpcUaNotificationRing::notifyConsumer()
+{
+    return !m_consumerNotified.exchange(true, std::memory_order_seq_cst);
+}
+
+bool QOpcUaNotificationRing::flushBacklog()
+{
+    bool enqueued = false;
+
+    while (!m_backlog.isEmpty() && tryEnqueue(m_backlog.head())) {
+        m_backlog.dequeue();
+        enqueued = true;
+    }
+
+    while (!m_conflatedOrder.isEmpty()) {
+        auto it = m_conflated.find(m_conflatedOrder.head());
+        if (!tryEnqueue(*it))
+            break;
+
+        m_conflated.erase(it);
+        m_conflatedOrder.dequeue();
+        enqueued = true;
+    }
+
+    if (enqueued)
+        m_backlogPending.store(!m_backlog.isEmpty() || !m_conflatedOrder.isEmpty(), std::memory_order_seq_cst);
+
+    return enqueued;
+}
+
+QT_END_NAMESPACE
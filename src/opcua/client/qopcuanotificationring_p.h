@@ -0,0 +1,117 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUANOTIFICATIONRING_P_H
+#define QOPCUANOTIFICATIONRING_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuascalardatachange.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qqueue.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qxpfunctional.h>
+
+#include <atomic>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+// Bounded ring of data change notifications from the backend thread (the producer)
+// to the thread of the client (the consumer).
+//
+// The slots carry a sequence number like in D. Vyukov's bounded queue. This allows the producer
+// to remove the oldest record if the ring is full without racing with the consumer.
+//
+// With the Block and Conflate policies, records which don't fit into the ring are kept in a backlog
+// of the producer. The producer never waits for the consumer, it stops producing notifications while
+// isBlocked() returns true and moves the backlog to the ring with flush() when the consumer asks for it.
+// How the producer stops is up to the backend, it may have to pause all of its processing.
+class Q_OPCUA_EXPORT QOpcUaNotificationRing
+{
+public:
+    enum class OverflowPolicy {
+        Block,
+        DropOldest,
+        Conflate
+    };
+
+    struct Record {
+        quint64 handle = 0;
+        QOpcUaScalarDataChange change;
+        QVariant value; // Only set if the value doesn't fit into change
+    };
+
+    QOpcUaNotificationRing(quint32 capacity, OverflowPolicy policy);
+    ~QOpcUaNotificationRing();
+
+    static bool overflowPolicyFromString(QStringView name, OverflowPolicy *policy);
+
+    // Producer side, the return value is true if the consumer must be woken up
+    bool post(Record &&record);
+    bool flush();
+    // True if the ring is full in Block mode, no new records must be posted until flush() has emptied the backlog
+    bool isBlocked() const
+    {
+        return m_policy == OverflowPolicy::Block && !m_backlog.isEmpty() && !m_closed.load(std::memory_order_acquire);
+    }
+    // Records which don't fit are dropped from now on
+    void close();
+
+    // Consumer side, the producer must be asked to flush() if hasBacklog() is true after draining
+    qsizetype drain(qxp::function_ref<void(Record &record)> handler);
+    bool hasBacklog() const { return m_backlogPending.load(std::memory_order_seq_cst); }
+
+    quint32 capacity() const { return m_capacity; }
+    OverflowPolicy overflowPolicy() const { return m_policy; }
+    quint64 droppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+    quint64 conflatedCount() const { return m_conflatedCount.load(std::memory_order_relaxed); }
+
+private:
+    Q_DISABLE_COPY(QOpcUaNotificationRing)
+
+    struct Slot {
+        std::atomic<quint64> sequence;
+        Record record;
+    };
+
+    bool tryEnqueue(Record &record);
+    bool tryDequeue(Record *record);
+    bool notifyConsumer();
+    bool flushBacklog();
+
+    const quint32 m_capacity;
+    const quint64 m_mask;
+    const OverflowPolicy m_policy;
+    std::unique_ptr<Slot[]> m_slots;
+
+    alignas(64) std::atomic<quint64> m_enqueuePosition {0};
+    alignas(64) std::atomic<quint64> m_dequeuePosition {0};
+
+    std::atomic<bool> m_consumerNotified {false};
+    std::atomic<bool> m_backlogPending {false};
+    std::atomic<bool> m_closed {false};
+
+    std::atomic<quint64> m_droppedCount {0};
+    std::atomic<quint64> m_conflatedCount {0};
+
+    // Only accessed by the producer
+    QQueue<Record> m_backlog;
+    QHash<quint64, Record> m_conflated;
+    QQueue<quint64> m_conflatedOrder;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUANOTIFICATIONRING_P_H
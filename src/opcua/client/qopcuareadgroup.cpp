@@ -0,0 +1,172 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuareadgroup.h"
+
+#include "private/qopcuareadgroup_p.h"
+#include "private/qopcuareadgroupimpl_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaReadGroup
+    \inmodule QtOpcUa
+    \brief This class reads a fixed set of attributes repeatedly.
+    \since 6.9
+
+    \l QOpcUaClient::readNodeAttributes() converts the list of read items into a new request
+    for every call. Applications which poll the same set of nodes over and over can use a
+    read group instead. The backend prepares the request once when the group is created
+    and sends the same request for every read.
+
+    If the group has been created with registered nodes, the backend registers the nodes
+    of the group with the server before the first read and uses the node ids assigned by
+    the server in the prepared request. The nodes are unregistered when the group is destroyed.
+
+    A read can be triggered on demand by \l read() or periodically by \l startCyclicRead().
+    A cyclic read is skipped if the previous read of the group has not finished yet.
+
+    The results of the last read are updated in place and can be retrieved by \l results()
+    after \l readFinished() has been emitted. They contain one entry for each item in \l nodesToRead()
+    in the same order. Until the first read has finished, the status code of the results is
+    \l {QOpcUa::UaStatusCode}{BadWaitingForInitialData}.
+
+    Read groups are created by \l QOpcUaClient::createReadGroup().
+
+    \code
+    QOpcUaReadGroup *group = client->createReadGroup(items, true);
+    if (group) {
+        QObject::connect(group, &QOpcUaReadGroup::readFinished, [group](QOpcUa::UaStatusCode serviceResult) {
+            if (serviceResult != QOpcUa::UaStatusCode::Good)
+                return;
+            for (const auto &result : group->results())
+                qInfo() << result.nodeId() << result.value();
+        });
+        group->startCyclicRead(100);
+    }
+    \endcode
+*/
+
+/*!
+    \enum QOpcUaReadGroup::State
+
+    This enum specifies the state of a read group.
+
+    \value Preparing The backend is preparing the request.
+    \value Ready The request has been prepared.
+    \value Error The request could not be prepared or the client has been disconnected.
+           The group can no longer be used.
+*/
+
+/*!
+    \fn QOpcUaReadGroup::readFinished(QOpcUa::UaStatusCode serviceResult)
+
+    This signal is emitted when a read of the group has finished.
+    \a serviceResult contains the service result of the read request.
+
+    \sa results()
+*/
+
+/*!
+    \fn QOpcUaReadGroup::stateChanged(QOpcUaReadGroup::State state)
+
+    This signal is emitted when the state of the group changes to \a state.
+*/
+
+/*!
+    \internal
+*/
+QOpcUaReadGroup::QOpcUaReadGroup(QOpcUaReadGroupImpl *impl)
+    : QObject(*new QOpcUaReadGroupPrivate(impl), nullptr)
+{}
+
+/*!
+    Destroys the read group and releases the prepared request in the backend.
+*/
+QOpcUaReadGroup::~QOpcUaReadGroup()
+{
+}
+
+/*!
+    Returns the current state of the read group.
+*/
+QOpcUaReadGroup::State QOpcUaReadGroup::state() const
+{
+    return d_func()->m_impl->state();
+}
+
+/*!
+    Returns the read items of this group.
+*/
+QList<QOpcUaReadItem> QOpcUaReadGroup::nodesToRead() const
+{
+    return d_func()->m_impl->nodesToRead();
+}
+
+/*!
+    Returns \c true if the group reads the nodes using node ids registered with the server.
+*/
+bool QOpcUaReadGroup::useRegisteredNodes() const
+{
+    return d_func()->m_impl->useRegisteredNodes();
+}
+
+/*!
+    Reads the items of the group once.
+    Returns \c true if the read has been dispatched.
+
+    A read requested while the group is still being prepared is sent as soon as the group is ready.
+
+    \sa readFinished()
+*/
+bool QOpcUaReadGroup::read()
+{
+    return d_func()->m_impl->read();
+}
+
+/*!
+    Starts reading the items of the group every \a interval milliseconds.
+    Returns \c true if the cyclic read has been started.
+
+    \sa stopCyclicRead()
+*/
+bool QOpcUaReadGroup::startCyclicRead(int interval)
+{
+    return d_func()->m_impl->startCyclicRead(interval);
+}
+
+/*!
+    Stops the cyclic read of the group.
+
+    \sa startCyclicRead()
+*/
+void QOpcUaReadGroup::stopCyclicRead()
+{
+    d_func()->m_impl->stopCyclicRead();
+}
+
+/*!
+    Returns the interval of the cyclic read in milliseconds or \c 0 if no cyclic read is active.
+*/
+int QOpcUaReadGroup::cyclicReadInterval() const
+{
+    return d_func()->m_impl->cyclicReadInterval();
+}
+
+/*!
+    Returns the results of the last read.
+*/
+QList<QOpcUaReadResult> QOpcUaReadGroup::results() const
+{
+    return d_func()->m_impl->results();
+}
+
+/*!
+    Returns the service result of the last read or of the preparation of the group.
+*/
+QOpcUa::UaStatusCode QOpcUaReadGroup::serviceResult() const
+{
+    return d_func()->m_impl->serviceResult();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,53 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUAREADGROUP_H
+#define QOPCUAREADGROUP_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuareaditem.h>
+#include <QtOpcUa/qopcuareadresult.h>
+
+#include <QtCore/qobject.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaReadGroupImpl;
+
+class QOpcUaReadGroupPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaReadGroup : public QObject {
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QOpcUaReadGroup)
+public:
+    explicit QOpcUaReadGroup(QOpcUaReadGroupImpl *impl);
+    ~QOpcUaReadGroup();
+
+    enum class State : quint32 {
+        Preparing,
+        Ready,
+        Error,
+    };
+    Q_ENUM(State)
+
+    State state() const;
+
+    QList<QOpcUaReadItem> nodesToRead() const;
+    bool useRegisteredNodes() const;
+
+    bool read();
+    bool startCyclicRead(int interval);
+    void stopCyclicRead();
+    int cyclicReadInterval() const;
+
+    QList<QOpcUaReadResult> results() const;
+    QOpcUa::UaStatusCode serviceResult() const;
+
+Q_SIGNALS:
+    void readFinished(QOpcUa::UaStatusCode serviceResult);
+    void stateChanged(QOpcUaReadGroup::State state);
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAREADGROUP_H
@@ -0,0 +1,53 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#ifndef QOPCUAREADGROUPPRIVATE_H
+#define QOPCUAREADGROUPPRIVATE_H
+
+#include <QtOpcUa/qopcuareadgroup.h>
+
+#include "private/qopcuareadgroupimpl_p.h"
+
+#include <private/qobject_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaReadGroupPrivate : public QObjectPrivate {
+    Q_DECLARE_PUBLIC(QOpcUaReadGroup)
+
+public:
+    QOpcUaReadGroupPrivate(QOpcUaReadGroupImpl *impl)
+        : m_impl(impl)
+    {
+        QObject::connect(impl, &QOpcUaReadGroupImpl::readFinished, impl,
+                         [this](QOpcUa::UaStatusCode serviceResult) {
+            if (q_func())
+                emit q_func()->readFinished(serviceResult);
+        });
+
+        QObject::connect(impl, &QOpcUaReadGroupImpl::stateChanged, impl,
+                         [this](QOpcUaReadGroup::State state) {
+            if (q_func())
+                emit q_func()->stateChanged(state);
+        });
+    }
+
+    ~QOpcUaReadGroupPrivate() = default;
+
+    QScopedPointer<QOpcUaReadGroupImpl> m_impl;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAREADGROUPPRIVATE_H
@@ -0,0 +1,145 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuareadgroupimpl_p.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+quint64 QOpcUaReadGroupImpl::m_currentHandle = 0;
+
+QOpcUaReadGroupImpl::QOpcUaReadGroupImpl(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes)
+    : m_nodesToRead(nodesToRead)
+    , m_useRegisteredNodes(useRegisteredNodes)
+    , m_handle(++m_currentHandle)
+{
+    m_results.reserve(nodesToRead.size());
+    for (const auto &item : nodesToRead) {
+        QOpcUaReadResult result;
+        if (item.parsedNodeId().isNull())
+            result.setNodeId(item.nodeId());
+        else
+            result.setNodeId(item.parsedNodeId());
+        result.setAttribute(item.attribute());
+        result.setIndexRange(item.indexRange());
+        result.setStatusCode(QOpcUa::UaStatusCode::BadWaitingForInitialData);
+        m_results.push_back(result);
+    }
+}
+
+QOpcUaReadGroupImpl::~QOpcUaReadGroupImpl()
+{
+    emit removeRequested(handle());
+}
+
+QOpcUaReadGroup::State QOpcUaReadGroupImpl::state() const
+{
+    return m_state;
+}
+
+QList<QOpcUaReadItem> QOpcUaReadGroupImpl::nodesToRead() const
+{
+    return m_nodesToRead;
+}
+
+bool QOpcUaReadGroupImpl::useRegisteredNodes() const
+{
+    return m_useRegisteredNodes;
+}
+
+bool QOpcUaReadGroupImpl::read()
+{
+    if (m_state == QOpcUaReadGroup::State::Error)
+        return false;
+
+    emit readRequested(handle());
+    return true;
+}
+
+bool QOpcUaReadGroupImpl::startCyclicRead(int interval)
+{
+    if (m_state == QOpcUaReadGroup::State::Error || interval <= 0)
+        return false;
+
+    m_cyclicReadInterval = interval;
+    emit cyclicReadRequested(handle(), interval);
+    return true;
+}
+
+void QOpcUaReadGroupImpl::stopCyclicRead()
+{
+    if (!m_cyclicReadInterval)
+        return;
+
+    m_cyclicReadInterval = 0;
+    emit cyclicReadRequested(handle(), 0);
+}
+
+int QOpcUaReadGroupImpl::cyclicReadInterval() const
+{
+    return m_cyclicReadInterval;
+}
+
+QList<QOpcUaReadResult> QOpcUaReadGroupImpl::results() const
+{
+    return m_results;
+}
+
+QOpcUa::UaStatusCode QOpcUaReadGroupImpl::serviceResult() const
+{
+    return m_serviceResult;
+}
+
+void QOpcUaReadGroupImpl::handleStatusChanged(quint64 handle, QOpcUa::UaStatusCode statusCode)
+{
+    if (handle != this->handle())
+        return;
+
+    m_serviceResult = statusCode;
+
+    if (statusCode == QOpcUa::UaStatusCode::Good) {
+        setState(QOpcUaReadGroup::State::Ready);
+    } else {
+        m_cyclicReadInterval = 0;
+        setState(QOpcUaReadGroup::State::Error);
+    }
+}
+
+void QOpcUaReadGroupImpl::handleReadFinished(quint64 handle, const QList<QOpcUaReadResult> &results,
+                                             QOpcUa::UaStatusCode serviceResult)
+{
+    if (handle != this->handle())
+        return;
+
+    m_serviceResult = serviceResult;
+
+    // Only the changing fields are copied. This keeps the result objects on both sides unshared,
+    // the backend and this object can update them in place without allocating new result data.
+    const qsizetype count = (std::min)(results.size(), m_results.size());
+    for (qsizetype i = 0; i < count; ++i) {
+        const auto &source = results.at(i);
+        auto &target = m_results[i];
+        target.setStatusCode(source.statusCode());
+        target.setValue(source.value());
+        target.setSourceTimestamp(source.sourceTimestamp());
+        target.setServerTimestamp(source.serverTimestamp());
+    }
+
+    emit readFinished(serviceResult);
+}
+
+quint64 QOpcUaReadGroupImpl::handle() const
+{
+    return m_handle;
+}
+
+void QOpcUaReadGroupImpl::setState(QOpcUaReadGroup::State state)
+{
+    if (state != m_state) {
+        m_state = state;
+        emit stateChanged(state);
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,76 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#ifndef QOPCUAREADGROUPIMPL_H
+#define QOPCUAREADGROUPIMPL_H
+
+#include <QtOpcUa/qopcuareadgroup.h>
+#include <QtOpcUa/qopcuareaditem.h>
+#include <QtOpcUa/qopcuareadresult.h>
+
+#include <QtCore/qobject.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaReadGroupImpl : public QObject {
+    Q_OBJECT
+
+public:
+    QOpcUaReadGroupImpl(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes);
+    ~QOpcUaReadGroupImpl();
+
+    QOpcUaReadGroup::State state() const;
+    QList<QOpcUaReadItem> nodesToRead() const;
+    bool useRegisteredNodes() const;
+
+    bool read();
+    bool startCyclicRead(int interval);
+    void stopCyclicRead();
+    int cyclicReadInterval() const;
+
+    QList<QOpcUaReadResult> results() const;
+    QOpcUa::UaStatusCode serviceResult() const;
+
+    Q_INVOKABLE void handleStatusChanged(quint64 handle, QOpcUa::UaStatusCode statusCode);
+    Q_INVOKABLE void handleReadFinished(quint64 handle, const QList<QOpcUaReadResult> &results,
+                                        QOpcUa::UaStatusCode serviceResult);
+
+    quint64 handle() const;
+
+Q_SIGNALS:
+    void readRequested(quint64 handle);
+    void cyclicReadRequested(quint64 handle, int interval);
+    void removeRequested(quint64 handle);
+    void readFinished(QOpcUa::UaStatusCode serviceResult);
+    void stateChanged(QOpcUaReadGroup::State state);
+
+protected:
+    void setState(QOpcUaReadGroup::State state);
+
+private:
+    QOpcUaReadGroup::State m_state = QOpcUaReadGroup::State::Preparing;
+    QList<QOpcUaReadItem> m_nodesToRead;
+    QList<QOpcUaReadResult> m_results;
+    QOpcUa::UaStatusCode m_serviceResult = QOpcUa::UaStatusCode::Good;
+    int m_cyclicReadInterval = 0;
+    bool m_useRegisteredNodes = false;
+
+    static quint64 m_currentHandle;
+
+    quint64 m_handle = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAREADGROUPIMPL_H
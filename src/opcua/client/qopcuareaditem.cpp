@@ -23,6 +23,7 @@ class QOpcUaReadItemData : public QSharedData
 {
 public:
     QString nodeId;
+    QOpcUaNodeId parsedNodeId;
     QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
     QString indexRange;
 };
@@ -55,6 +56,20 @@ QOpcUaReadItem::QOpcUaReadItem(const QString &nodeId, QOpcUa::NodeAttribute attr
     setIndexRange(indexRange);
 }
 
+/*!
+    \since 6.9
+
+    Constructs a read item for the index range \a indexRange of the attribute \a attr of the node
+    with the parsed node id \a nodeId.
+*/
+QOpcUaReadItem::QOpcUaReadItem(const QOpcUaNodeId &nodeId, QOpcUa::NodeAttribute attr, const QString &indexRange)
+    : data(new QOpcUaReadItemData)
+{
+    setNodeId(nodeId);
+    setAttribute(attr);
+    setIndexRange(indexRange);
+}
+
 /*!
     Sets the values from \a rhs in this read item.
 */
@@ -106,6 +121,8 @@ void QOpcUaReadItem::setAttribute(QOpcUa::NodeAttribute attribute)
 */
 QString QOpcUaReadItem::nodeId() const
 {
+    if (data->nodeId.isEmpty() && !data->parsedNodeId.isNull())
+        return data->parsedNodeId.toString();
     return data->nodeId;
 }
 
@@ -115,6 +132,34 @@ QString QOpcUaReadItem::nodeId() const
 void QOpcUaReadItem::setNodeId(const QString &nodeId)
 {
     data->nodeId = nodeId;
+    data->parsedNodeId = QOpcUaNodeId();
+}
+
+/*!
+    \since 6.9
+
+    Sets the node id to the already parsed \a nodeId.
+    The backend uses the parsed node id directly instead of parsing a node id string.
+
+    \sa parsedNodeId()
+*/
+void QOpcUaReadItem::setNodeId(const QOpcUaNodeId &nodeId)
+{
+    data->nodeId.clear();
+    data->parsedNodeId = nodeId;
+}
+
+/*!
+    \since 6.9
+
+    Returns the node id set by \l setNodeId(const QOpcUaNodeId &) or a null node id
+    if the node id has been set as string.
+
+    \sa nodeId()
+*/
+QOpcUaNodeId QOpcUaReadItem::parsedNodeId() const
+{
+    return data->parsedNodeId;
 }
 
 /*!
@@ -127,7 +172,7 @@ void QOpcUaReadItem::setNodeId(const QString &nodeId)
 */
 bool operator==(const QOpcUaReadItem &lhs, const QOpcUaReadItem &rhs) noexcept
 {
-    return lhs.data->nodeId == rhs.data->nodeId &&
+    return lhs.nodeId() == rhs.nodeId() &&
             lhs.data->attribute == rhs.data->attribute &&
             lhs.data->indexRange == rhs.data->indexRange;
 }
@@ -4,6 +4,7 @@
 #ifndef QOPCUAREADITEM_H
 #define QOPCUAREADITEM_H
 
+#include <QtOpcUa/qopcuanodeid.h>
 #include <QtOpcUa/qopcuatype.h>
 #include <QtCore/qshareddata.h>
 
@@ -17,11 +18,15 @@ public:
     QOpcUaReadItem(const QOpcUaReadItem &other);
     QOpcUaReadItem(const QString &nodeId, QOpcUa::NodeAttribute attr = QOpcUa::NodeAttribute::Value,
                    const QString &indexRange = QString());
+    QOpcUaReadItem(const QOpcUaNodeId &nodeId, QOpcUa::NodeAttribute attr = QOpcUa::NodeAttribute::Value,
+                   const QString &indexRange = QString());
     QOpcUaReadItem &operator=(const QOpcUaReadItem &rhs);
     ~QOpcUaReadItem();
 
     QString nodeId() const;
     void setNodeId(const QString &nodeId);
+    void setNodeId(const QOpcUaNodeId &nodeId);
+    QOpcUaNodeId parsedNodeId() const;
 
     QOpcUa::NodeAttribute attribute() const;
     void setAttribute(QOpcUa::NodeAttribute attribute);
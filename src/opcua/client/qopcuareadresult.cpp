@@ -30,6 +30,7 @@ public:
     QDateTime sourceTimestamp;
     QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
     QString nodeId;
+    QOpcUaNodeId parsedNodeId;
     QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
     QString indexRange;
     QVariant value;
@@ -118,6 +119,8 @@ void QOpcUaReadResult::setIndexRange(const QString &indexRange)
 */
 QString QOpcUaReadResult::nodeId() const
 {
+    if (data->nodeId.isEmpty() && !data->parsedNodeId.isNull())
+        return data->parsedNodeId.toString();
     return data->nodeId;
 }
 
@@ -127,6 +130,34 @@ QString QOpcUaReadResult::nodeId() const
 void QOpcUaReadResult::setNodeId(const QString &nodeId)
 {
     data->nodeId = nodeId;
+    data->parsedNodeId = QOpcUaNodeId();
+}
+
+/*!
+    \since 6.9
+
+    Sets the node id to the already parsed \a nodeId.
+    The backend uses the parsed node id directly instead of parsing a node id string.
+
+    \sa parsedNodeId()
+*/
+void QOpcUaReadResult::setNodeId(const QOpcUaNodeId &nodeId)
+{
+    data->nodeId.clear();
+    data->parsedNodeId = nodeId;
+}
+
+/*!
+    \since 6.9
+
+    Returns the node id set by \l setNodeId(const QOpcUaNodeId &) or a null node id
+    if the node id has been set as string.
+
+    \sa nodeId()
+*/
+QOpcUaNodeId QOpcUaReadResult::parsedNodeId() const
+{
+    return data->parsedNodeId;
 }
 
 /*!
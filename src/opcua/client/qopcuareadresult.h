@@ -4,6 +4,7 @@
 #ifndef QOPCUAREADRESULT_H
 #define QOPCUAREADRESULT_H
 
+#include <QtOpcUa/qopcuanodeid.h>
 #include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/qdatetime.h>
@@ -30,6 +31,8 @@ public:
 
     QString nodeId() const;
     void setNodeId(const QString &nodeId);
+    void setNodeId(const QOpcUaNodeId &nodeId);
+    QOpcUaNodeId parsedNodeId() const;
 
     QOpcUa::NodeAttribute attribute() const;
     void setAttribute(QOpcUa::NodeAttribute attribute);
@@ -0,0 +1,516 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuarecordingplayer.h"
+#include "qopcuarecordingplayer_p.h"
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <private/qopcuaclient_p.h>
+#include <private/qopcuaclientimpl_p.h>
+
+#include <QtCore/qloggingcategory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaRecordingPlayer
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class replays a recording of \l QOpcUaSubscriptionRecorder.
+
+    The player delivers the recorded notifications to the nodes of a \l QOpcUaClient which
+    have the recorded node id. The notifications take the same path as the notifications of the
+    server: the attribute cache of the nodes is updated and \l QOpcUaNode::dataChangeOccurred() and
+    \l QOpcUaNode::eventOccurred() are emitted. This allows load testing the consumers of the
+    notifications without a server. The client doesn't need to be connected.
+
+    \code
+    QOpcUaRecordingPlayer player;
+    player.open(u"notifications.qopcuarec"_s);
+    player.setSpeed(0); // As fast as possible
+    QScopedPointer<QOpcUaNode> node(client->node(u"ns=2;s=Machine.Temperature"_s));
+    connect(node.get(), &QOpcUaNode::dataChangeOccurred, ...);
+    player.start(client);
+    \endcode
+
+    The file is mapped into memory. Records are decoded one chunk at a time when they are replayed.
+
+    \sa QOpcUaSubscriptionRecorder
+*/
+
+/*!
+    \fn void QOpcUaRecordingPlayer::finished()
+
+    This signal is emitted after the last record has been replayed.
+*/
+
+using namespace QOpcUaRecordingFormat;
+
+// Number of records which are replayed at maximum speed before the event loop is entered again
+constexpr int maximumSpeedBatchSize = 1024;
+
+QOpcUaRecordingReader::~QOpcUaRecordingReader()
+{
+    close();
+}
+
+bool QOpcUaRecordingReader::open(const QString &fileName)
+{
+    close();
+
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        qCWarning(QT_OPCUA) << "Failed to open the recording" << fileName << m_file.errorString();
+        return false;
+    }
+
+    m_size = m_file.size();
+    m_data = m_size >= fileHeaderSize ? m_file.map(0, m_size) : nullptr;
+    if (!m_data || std::memcmp(m_data, fileMagic, sizeof(fileMagic))) {
+        qCWarning(QT_OPCUA) << fileName << "is not a recording";
+        close();
+        return false;
+    }
+
+    QByteArray header = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data) + sizeof(fileMagic),
+                                                fileHeaderSize - sizeof(fileMagic));
+    QOpcUaBinaryDataEncoding decoder(&header);
+    bool success = true;
+    const auto fileVersion = decoder.decode<quint32>(success);
+    const auto startTime = decoder.decode<qint64>(success);
+    if (!success || fileVersion != version) {
+        qCWarning(QT_OPCUA) << "Unsupported version of the recording" << fileName;
+        close();
+        return false;
+    }
+    m_startTime = QDateTime::fromMSecsSinceEpoch(startTime, QTimeZone::UTC);
+
+    if (!readIndex())
+        scanChunks();
+
+    m_recordCount = 0;
+    for (const auto &chunk : std::as_const(m_chunks))
+        m_recordCount += chunk.recordCount;
+
+    seek(0);
+
+    return true;
+}
+
+void QOpcUaRecordingReader::close()
+{
+    m_chunks.clear();
+    m_chunkData.clear();
+    m_recordCount = 0;
+    m_hasNext = false;
+    m_startTime = QDateTime();
+    if (m_data)
+        m_file.unmap(const_cast<uchar *>(m_data));
+    m_data = nullptr;
+    m_size = 0;
+    m_file.close();
+}
+
+qint64 QOpcUaRecordingReader::duration() const
+{
+    return m_chunks.isEmpty() ? 0 : m_chunks.constLast().lastTime;
+}
+
+void QOpcUaRecordingReader::seek(qint64 time)
+{
+    // The index finds the chunk of the position without decoding the previous chunks
+    const auto chunk = std::lower_bound(m_chunks.cbegin(), m_chunks.cend(), time,
+                                        [](const ChunkInfo &info, qint64 time) {
+        return info.lastTime < time;
+    });
+    m_chunkIndex = std::distance(m_chunks.cbegin(), chunk) - 1;
+    m_remainingRecords = 0;
+
+    readRecordHeader();
+    while (m_hasNext && m_nextTime < time) {
+        if (!readNext(nullptr))
+            break;
+    }
+}
+
+bool QOpcUaRecordingReader::readNext(Record *record)
+{
+    if (!m_hasNext)
+        return false;
+
+    QOpcUaBinaryDataEncoding decoder(&m_chunkData);
+    decoder.setOffset(m_offset);
+    bool success = true;
+
+    Record temp;
+    if (!record)
+        record = &temp;
+
+    record->type = m_nextType;
+    record->time = m_nextTime;
+    record->nodeId = decoder.decode<QString>(success);
+
+    switch (m_nextType) {
+    case RecordType::DataChange: {
+        auto &result = record->dataChange;
+        result = QOpcUaReadResult();
+        result.setNodeId(record->nodeId);
+        result.setAttribute(static_cast<QOpcUa::NodeAttribute>(decoder.decode<quint32>(success)));
+        result.setStatusCode(decoder.decode<QOpcUa::UaStatusCode>(success));
+        result.setSourceTimestamp(decoder.decode<QDateTime>(success));
+        result.setServerTimestamp(decoder.decode<QDateTime>(success));
+        result.setValue(decodeValue(decoder, success));
+        break;
+    }
+    case RecordType::Event: {
+        const auto fieldCount = decoder.decode<qint32>(success);
+        record->eventFields.clear();
+        for (qint32 i = 0; success && i < fieldCount; ++i)
+            record->eventFields.push_back(decodeValue(decoder, success));
+        break;
+    }
+    default:
+        success = false;
+    }
+
+    if (!success) {
+        qCWarning(QT_OPCUA) << "The recording" << m_file.fileName() << "is corrupt";
+        m_hasNext = false;
+        return false;
+    }
+
+    m_offset = decoder.offset();
+    readRecordHeader();
+
+    return true;
+}
+
+bool QOpcUaRecordingReader::readIndex()
+{
+    if (m_size < fileHeaderSize + trailerSize)
+        return false;
+
+    const auto trailer = m_data + m_size - trailerSize;
+    if (std::memcmp(trailer + 8, trailerMagic, sizeof(trailerMagic)))
+        return false;
+
+    QByteArray data = QByteArray::fromRawData(reinterpret_cast<const char *>(trailer), trailerSize);
+    QOpcUaBinaryDataEncoding decoder(&data);
+    bool success = true;
+    const auto indexOffset = decoder.decode<qint64>(success);
+    if (!success || indexOffset < fileHeaderSize || indexOffset > m_size - trailerSize - 8)
+        return false;
+
+    data = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data + indexOffset),
+                                   m_size - trailerSize - indexOffset);
+    decoder = QOpcUaBinaryDataEncoding(&data);
+    if (decoder.decode<quint32>(success) != indexMagic || !success)
+        return false;
+
+    const auto chunkCount = decoder.decode<quint32>(success);
+    if (!success || chunkCount > (data.size() - 8) / indexEntrySize)
+        return false;
+
+    QList<ChunkInfo> chunks;
+    chunks.reserve(chunkCount);
+    for (quint32 i = 0; i < chunkCount; ++i) {
+        ChunkInfo chunk;
+        chunk.fileOffset = decoder.decode<qint64>(success);
+        chunk.firstTime = decoder.decode<qint64>(success);
+        chunk.lastTime = decoder.decode<qint64>(success);
+        chunk.recordCount = decoder.decode<quint32>(success);
+        if (!success || chunk.fileOffset < fileHeaderSize || chunk.fileOffset > indexOffset - chunkHeaderSize)
+            return false;
+        chunks.push_back(chunk);
+    }
+
+    m_chunks = std::move(chunks);
+    return true;
+}
+
+void QOpcUaRecordingReader::scanChunks()
+{
+    m_chunks.clear();
+
+    qint64 offset = fileHeaderSize;
+    while (offset + chunkHeaderSize <= m_size) {
+        QByteArray data = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data + offset), chunkHeaderSize);
+        QOpcUaBinaryDataEncoding decoder(&data);
+        bool success = true;
+
+        if (decoder.decode<quint32>(success) != chunkMagic)
+            break;
+
+        ChunkInfo chunk;
+        chunk.fileOffset = offset;
+        const auto payloadSize = decoder.decode<quint32>(success);
+        chunk.recordCount = decoder.decode<quint32>(success);
+        chunk.firstTime = decoder.decode<qint64>(success);
+        chunk.lastTime = decoder.decode<qint64>(success);
+
+        // The last chunk is incomplete if the recording has not been closed
+        if (!success || offset + chunkHeaderSize + payloadSize > m_size)
+            break;
+
+        m_chunks.push_back(chunk);
+        offset += chunkHeaderSize + payloadSize;
+    }
+}
+
+bool QOpcUaRecordingReader::loadChunk(qsizetype index)
+{
+    if (index >= m_chunks.size())
+        return false;
+
+    const auto &chunk = m_chunks.at(index);
+    QByteArray header = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data + chunk.fileOffset), chunkHeaderSize);
+    QOpcUaBinaryDataEncoding decoder(&header);
+    bool success = true;
+    if (decoder.decode<quint32>(success) != chunkMagic)
+        return false;
+    const auto payloadSize = decoder.decode<quint32>(success);
+    if (!success || chunk.fileOffset + chunkHeaderSize + payloadSize > m_size)
+        return false;
+
+    m_chunkIndex = index;
+    m_chunkData = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data + chunk.fileOffset + chunkHeaderSize),
+                                          payloadSize);
+    m_offset = 0;
+    m_remainingRecords = chunk.recordCount;
+
+    return true;
+}
+
+bool QOpcUaRecordingReader::readRecordHeader()
+{
+    m_hasNext = false;
+
+    while (!m_remainingRecords) {
+        if (!loadChunk(m_chunkIndex + 1))
+            return false;
+    }
+
+    QOpcUaBinaryDataEncoding decoder(&m_chunkData);
+    decoder.setOffset(m_offset);
+    bool success = true;
+    m_nextType = static_cast<RecordType>(decoder.decode<quint8>(success));
+    m_nextTime = decoder.decode<qint64>(success);
+    if (!success)
+        return false;
+
+    m_offset = decoder.offset();
+    --m_remainingRecords;
+    m_hasNext = true;
+
+    return true;
+}
+
+QOpcUaRecordingPlayerPrivate::QOpcUaRecordingPlayerPrivate()
+{
+    m_timer.setSingleShot(true);
+    m_timer.setTimerType(Qt::PreciseTimer);
+}
+
+void QOpcUaRecordingPlayerPrivate::replayDueRecords()
+{
+    Q_Q(QOpcUaRecordingPlayer);
+
+    // The handlers of the notifications may stop the player or destroy the client
+    const bool maximumSpeed = qFuzzyIsNull(m_speed);
+    const qint64 now = maximumSpeed ? 0 : m_startPosition + static_cast<qint64>(m_clock.nsecsElapsed() * m_speed);
+    QOpcUaRecordingReader::Record record;
+    int batch = 0;
+
+    while (m_playing && m_reader.hasNext()
+           && (maximumSpeed ? batch < maximumSpeedBatchSize : m_reader.nextTime() <= now)) {
+        if (!m_client || !m_reader.readNext(&record))
+            break;
+
+        auto impl = static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(m_client))->m_impl.get();
+        if (record.type == RecordType::DataChange)
+            impl->replayDataChange(record.nodeId, record.dataChange);
+        else
+            impl->replayEvent(record.nodeId, record.eventFields);
+
+        ++m_replayedRecordCount;
+        ++batch;
+    }
+
+    if (!m_playing)
+        return;
+
+    if (!m_client || !m_reader.hasNext()) {
+        m_playing = false;
+        emit q->finished();
+        return;
+    }
+
+    if (maximumSpeed) {
+        m_timer.start(0);
+    } else {
+        const double delay = (m_reader.nextTime() - m_startPosition) / m_speed - m_clock.nsecsElapsed();
+        m_timer.start(std::chrono::milliseconds(qMax<qint64>(0, static_cast<qint64>(std::ceil(delay / 1e6)))));
+    }
+}
+
+/*!
+    Constructs a player with parent \a parent.
+*/
+QOpcUaRecordingPlayer::QOpcUaRecordingPlayer(QObject *parent)
+    : QObject(*new QOpcUaRecordingPlayerPrivate(), parent)
+{
+    Q_D(QOpcUaRecordingPlayer);
+    connect(&d->m_timer, &QTimer::timeout, this, [d] { d->replayDueRecords(); });
+}
+
+/*!
+    Destroys the player.
+*/
+QOpcUaRecordingPlayer::~QOpcUaRecordingPlayer()
+{
+    close();
+}
+
+/*!
+    Opens the recording \a fileName. A file which is already open is closed first.
+
+    Returns \c false if the file can't be opened or is not a recording.
+*/
+bool QOpcUaRecordingPlayer::open(const QString &fileName)
+{
+    Q_D(QOpcUaRecordingPlayer);
+
+    stop();
+    return d->m_reader.open(fileName);
+}
+
+/*!
+    Stops replaying and closes the recording.
+*/
+void QOpcUaRecordingPlayer::close()
+{
+    Q_D(QOpcUaRecordingPlayer);
+
+    stop();
+    d->m_reader.close();
+}
+
+/*!
+    Returns \c true if a recording has been opened.
+*/
+bool QOpcUaRecordingPlayer::isOpen() const
+{
+    Q_D(const QOpcUaRecordingPlayer);
+    return d->m_reader.isOpen();
+}
+
+/*!
+    Returns the time at which the recording has been started.
+*/
+QDateTime QOpcUaRecordingPlayer::startTime() const
+{
+    Q_D(const QOpcUaRecordingPlayer);
+    return d->m_reader.startTime();
+}
+
+/*!
+    Returns the time between the start of the recording and the last record in milliseconds.
+*/
+qint64 QOpcUaRecordingPlayer::duration() const
+{
+    Q_D(const QOpcUaRecordingPlayer);
+    return d->m_reader.duration() / 1000000;
+}
+
+/*!
+    Returns the number of records in the recording.
+*/
+quint64 QOpcUaRecordingPlayer::recordCount() const
+{
+    Q_D(const QOpcUaRecordingPlayer);
+    return d->m_reader.recordCount();
+}
+
+/*!
+    Returns the replay speed.
+*/
+double QOpcUaRecordingPlayer::speed() const
+{
+    Q_D(const QOpcUaRecordingPlayer);
+    return d->m_speed;
+}
+
+/*!
+    Sets the replay speed to \a speed. The default value 1 replays the records with the original
+    timing, 2 replays them twice as fast. For 0, the records are replayed as fast as possible.
+
+    The speed must be set before \l start() is called.
+*/
+void QOpcUaRecordingPlayer::setSpeed(double speed)
+{
+    Q_D(QOpcUaRecordingPlayer);
+    d->m_speed = qMax(0.0, speed);
+}
+
+/*!
+    Starts replaying the recording to the nodes of \a client. Records which have been recorded
+    less than \a position milliseconds after the start of the recording are skipped.
+
+    Returns \c false if no recording is open.
+
+    \sa finished()
+*/
+bool QOpcUaRecordingPlayer::start(QOpcUaClient *client, qint64 position)
+{
+    Q_D(QOpcUaRecordingPlayer);
+
+    stop();
+
+    if (!d->m_reader.isOpen() || !client)
+        return false;
+
+    d->m_client = client;
+    d->m_startPosition = qMax<qint64>(0, position) * 1000000;
+    d->m_replayedRecordCount = 0;
+    d->m_reader.seek(d->m_startPosition);
+
+    d->m_playing = true;
+    d->m_clock.start();
+    d->m_timer.start(0);
+
+    return true;
+}
+
+/*!
+    Stops replaying. \l finished() is not emitted.
+*/
+void QOpcUaRecordingPlayer::stop()
+{
+    Q_D(QOpcUaRecordingPlayer);
+    d->m_playing = false;
+    d->m_timer.stop();
+}
+
+/*!
+    Returns \c true if the recording is being replayed.
+*/
+bool QOpcUaRecordingPlayer::isPlaying() const
+{
+    Q_D(const QOpcUaRecordingPlayer);
+    return d->m_playing;
+}
+
+/*!
+    Returns the number of records which have been replayed since \l start() has been called.
+*/
+quint64 QOpcUaRecordingPlayer::replayedRecordCount() const
+{
+    Q_D(const QOpcUaRecordingPlayer);
+    return d->m_replayedRecordCount;
+}
+
+QT_END_NAMESPACE
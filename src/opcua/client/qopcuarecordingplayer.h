@@ -0,0 +1,48 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUARECORDINGPLAYER_H
+#define QOPCUARECORDINGPLAYER_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qobject.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClient;
+
+class QOpcUaRecordingPlayerPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaRecordingPlayer : public QObject
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QOpcUaRecordingPlayer)
+public:
+    explicit QOpcUaRecordingPlayer(QObject *parent = nullptr);
+    ~QOpcUaRecordingPlayer() override;
+
+    bool open(const QString &fileName);
+    void close();
+    bool isOpen() const;
+
+    QDateTime startTime() const;
+    qint64 duration() const;
+    quint64 recordCount() const;
+
+    double speed() const;
+    void setSpeed(double speed);
+
+    bool start(QOpcUaClient *client, qint64 position = 0);
+    void stop();
+    bool isPlaying() const;
+    quint64 replayedRecordCount() const;
+
+Q_SIGNALS:
+    void finished();
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUARECORDINGPLAYER_H
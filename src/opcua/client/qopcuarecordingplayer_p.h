@@ -0,0 +1,109 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUARECORDINGPLAYER_P_H
+#define QOPCUARECORDINGPLAYER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaclient.h>
+#include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuarecordingplayer.h>
+#include <private/qopcuasubscriptionrecorder_p.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qtimer.h>
+#include <private/qobject_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// Reads the records of a recording of QOpcUaSubscriptionRecorder in order of their time
+class Q_OPCUA_EXPORT QOpcUaRecordingReader
+{
+public:
+    struct Record {
+        QOpcUaRecordingFormat::RecordType type = QOpcUaRecordingFormat::RecordType::DataChange;
+        qint64 time = 0; // Nanoseconds since the start of the recording
+        QString nodeId;
+        QOpcUaReadResult dataChange;
+        QVariantList eventFields;
+    };
+
+    QOpcUaRecordingReader() = default;
+    ~QOpcUaRecordingReader();
+
+    bool open(const QString &fileName);
+    void close();
+    bool isOpen() const { return m_data != nullptr; }
+
+    QDateTime startTime() const { return m_startTime; }
+    qint64 duration() const; // Nanoseconds
+    quint64 recordCount() const { return m_recordCount; }
+
+    // Positions the reader on the first record at or after time
+    void seek(qint64 time);
+    bool hasNext() const { return m_hasNext; }
+    qint64 nextTime() const { return m_nextTime; }
+    // Decodes the next record into record, the record is skipped if record is nullptr
+    bool readNext(Record *record);
+
+private:
+    Q_DISABLE_COPY(QOpcUaRecordingReader)
+
+    bool readIndex();
+    void scanChunks();
+    bool loadChunk(qsizetype index);
+    bool readRecordHeader();
+
+    QFile m_file;
+    const uchar *m_data = nullptr;
+    qint64 m_size = 0;
+    QDateTime m_startTime;
+    QList<QOpcUaRecordingFormat::ChunkInfo> m_chunks;
+    quint64 m_recordCount = 0;
+
+    // Position of the next record
+    qsizetype m_chunkIndex = 0;
+    quint32 m_remainingRecords = 0;
+    QByteArray m_chunkData;
+    int m_offset = 0;
+    QOpcUaRecordingFormat::RecordType m_nextType = QOpcUaRecordingFormat::RecordType::DataChange;
+    qint64 m_nextTime = 0;
+    bool m_hasNext = false;
+};
+
+class QOpcUaRecordingPlayerPrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QOpcUaRecordingPlayer)
+
+public:
+    QOpcUaRecordingPlayerPrivate();
+
+    void replayDueRecords();
+
+    QOpcUaRecordingReader m_reader;
+
+    double m_speed = 1.0;
+    QPointer<QOpcUaClient> m_client;
+    QTimer m_timer;
+    QElapsedTimer m_clock;
+    qint64 m_startPosition = 0; // Nanoseconds since the start of the recording
+    bool m_playing = false;
+    quint64 m_replayedRecordCount = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUARECORDINGPLAYER_P_H
@@ -0,0 +1,381 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuascalardatachange.h"
+
+#include <QtCore/qtimezone.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaScalarDataChange
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class stores a data change notification for a scalar numeric value without boxing it into a QVariant.
+
+    Most monitored variables in automation systems carry a single Boolean, integer, floating point or
+    DateTime value. Converting each of these notifications into a \l QOpcUaReadResult requires a
+    \l QVariant and two \l QDateTime objects. This class holds the value, the status code and the
+    timestamps as plain fields so a notification can be delivered with a single allocation.
+
+    Timestamps are stored in the OPC UA DateTime encoding as the number of 100 nanosecond intervals
+    since January 1, 1601 (UTC). A timestamp of 0 means that the server did not send the timestamp.
+    \l toDateTime() converts such a value to a \l QDateTime.
+
+    \l value() and \l toReadResult() create the QVariant based representations on demand for consumers
+    which need them.
+
+    Objects of this class are delivered by the \l QOpcUaNode::scalarDataChangeOccurred() signal if the
+    \c typedDataChanges backend property has been set for the client.
+
+    \sa QOpcUaNode::scalarDataChangeOccurred() QOpcUaReadResult
+*/
+class QOpcUaScalarDataChangeData : public QSharedData
+{
+public:
+    union {
+        bool b;
+        qint64 i;
+        quint64 u;
+        double d;
+    } value {};
+    qint64 sourceTimestamp = 0;
+    qint64 serverTimestamp = 0;
+    QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+    QOpcUa::Types valueType = QOpcUa::Types::Undefined;
+    QOpcUa::NodeAttribute attribute = QOpcUa::NodeAttribute::Value;
+};
+
+/*!
+    Default constructs a data change without a value for the Value attribute with status code Good.
+*/
+QOpcUaScalarDataChange::QOpcUaScalarDataChange()
+    : data(new QOpcUaScalarDataChangeData)
+{
+}
+
+/*!
+    Constructs a data change from \a other.
+*/
+QOpcUaScalarDataChange::QOpcUaScalarDataChange(const QOpcUaScalarDataChange &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this data change.
+*/
+QOpcUaScalarDataChange &QOpcUaScalarDataChange::operator=(const QOpcUaScalarDataChange &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaScalarDataChange::~QOpcUaScalarDataChange()
+{
+}
+
+/*!
+    Returns the attribute this data change belongs to.
+*/
+QOpcUa::NodeAttribute QOpcUaScalarDataChange::attribute() const
+{
+    return data->attribute;
+}
+
+/*!
+    Sets the attribute to \a attribute.
+*/
+void QOpcUaScalarDataChange::setAttribute(QOpcUa::NodeAttribute attribute)
+{
+    data->attribute = attribute;
+}
+
+/*!
+    Returns the status code of the value.
+*/
+QOpcUa::UaStatusCode QOpcUaScalarDataChange::statusCode() const
+{
+    return data->statusCode;
+}
+
+/*!
+    Sets the status code to \a statusCode.
+*/
+void QOpcUaScalarDataChange::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    data->statusCode = statusCode;
+}
+
+/*!
+    Returns the OPC UA type of the stored value or \l {QOpcUa::Types} {Undefined} if there is no value.
+*/
+QOpcUa::Types QOpcUaScalarDataChange::valueType() const
+{
+    return data->valueType;
+}
+
+/*!
+    Returns \c true if this data change contains a value.
+*/
+bool QOpcUaScalarDataChange::hasValue() const
+{
+    return data->valueType != QOpcUa::Types::Undefined;
+}
+
+/*!
+    Returns the source timestamp in OPC UA DateTime encoding or 0 if it was not sent by the server.
+
+    \sa toDateTime()
+*/
+qint64 QOpcUaScalarDataChange::sourceTimestamp() const
+{
+    return data->sourceTimestamp;
+}
+
+/*!
+    Sets the source timestamp to \a timestamp.
+*/
+void QOpcUaScalarDataChange::setSourceTimestamp(qint64 timestamp)
+{
+    data->sourceTimestamp = timestamp;
+}
+
+/*!
+    Returns the server timestamp in OPC UA DateTime encoding or 0 if it was not sent by the server.
+
+    \sa toDateTime()
+*/
+qint64 QOpcUaScalarDataChange::serverTimestamp() const
+{
+    return data->serverTimestamp;
+}
+
+/*!
+    Sets the server timestamp to \a timestamp.
+*/
+void QOpcUaScalarDataChange::setServerTimestamp(qint64 timestamp)
+{
+    data->serverTimestamp = timestamp;
+}
+
+/*!
+    Returns the value as bool.
+    Numeric values are \c true if they are not zero.
+*/
+bool QOpcUaScalarDataChange::toBool() const
+{
+    switch (data->valueType) {
+    case QOpcUa::Types::Boolean:
+        return data->value.b;
+    case QOpcUa::Types::Float:
+    case QOpcUa::Types::Double:
+        return data->value.d != 0;
+    case QOpcUa::Types::Undefined:
+        return false;
+    default:
+        return data->value.u != 0;
+    }
+}
+
+/*!
+    Returns the value converted to qint64.
+    Floating point values are truncated.
+*/
+qint64 QOpcUaScalarDataChange::toLongLong() const
+{
+    switch (data->valueType) {
+    case QOpcUa::Types::Boolean:
+        return data->value.b ? 1 : 0;
+    case QOpcUa::Types::Float:
+    case QOpcUa::Types::Double:
+        return static_cast<qint64>(data->value.d);
+    case QOpcUa::Types::Byte:
+    case QOpcUa::Types::UInt16:
+    case QOpcUa::Types::UInt32:
+    case QOpcUa::Types::UInt64:
+    case QOpcUa::Types::StatusCode:
+        return static_cast<qint64>(data->value.u);
+    case QOpcUa::Types::Undefined:
+        return 0;
+    default:
+        return data->value.i;
+    }
+}
+
+/*!
+    Returns the value converted to quint64.
+    Floating point values are truncated.
+*/
+quint64 QOpcUaScalarDataChange::toULongLong() const
+{
+    switch (data->valueType) {
+    case QOpcUa::Types::Boolean:
+        return data->value.b ? 1 : 0;
+    case QOpcUa::Types::Float:
+    case QOpcUa::Types::Double:
+        return static_cast<quint64>(data->value.d);
+    case QOpcUa::Types::SByte:
+    case QOpcUa::Types::Int16:
+    case QOpcUa::Types::Int32:
+    case QOpcUa::Types::Int64:
+    case QOpcUa::Types::DateTime:
+        return static_cast<quint64>(data->value.i);
+    case QOpcUa::Types::Undefined:
+        return 0;
+    default:
+        return data->value.u;
+    }
+}
+
+/*!
+    Returns the value converted to double.
+*/
+double QOpcUaScalarDataChange::toDouble() const
+{
+    switch (data->valueType) {
+    case QOpcUa::Types::Boolean:
+        return data->value.b ? 1 : 0;
+    case QOpcUa::Types::Float:
+    case QOpcUa::Types::Double:
+        return data->value.d;
+    case QOpcUa::Types::Byte:
+    case QOpcUa::Types::UInt16:
+    case QOpcUa::Types::UInt32:
+    case QOpcUa::Types::UInt64:
+    case QOpcUa::Types::StatusCode:
+        return static_cast<double>(data->value.u);
+    case QOpcUa::Types::Undefined:
+        return 0;
+    default:
+        return static_cast<double>(data->value.i);
+    }
+}
+
+/*!
+    Sets the value to the Boolean \a value.
+*/
+void QOpcUaScalarDataChange::setBoolean(bool value)
+{
+    data->value.u = 0;
+    data->value.b = value;
+    data->valueType = QOpcUa::Types::Boolean;
+}
+
+/*!
+    Sets the value to the signed integer \a value of OPC UA type \a type.
+*/
+void QOpcUaScalarDataChange::setSignedInteger(qint64 value, QOpcUa::Types type)
+{
+    data->value.i = value;
+    data->valueType = type;
+}
+
+/*!
+    Sets the value to the unsigned integer \a value of OPC UA type \a type.
+*/
+void QOpcUaScalarDataChange::setUnsignedInteger(quint64 value, QOpcUa::Types type)
+{
+    data->value.u = value;
+    data->valueType = type;
+}
+
+/*!
+    Sets the value to the floating point number \a value of OPC UA type \a type.
+*/
+void QOpcUaScalarDataChange::setFloatingPoint(double value, QOpcUa::Types type)
+{
+    data->value.d = value;
+    data->valueType = type;
+}
+
+/*!
+    Sets the value to the DateTime \a value in OPC UA DateTime encoding.
+*/
+void QOpcUaScalarDataChange::setDateTime(qint64 value)
+{
+    data->value.i = value;
+    data->valueType = QOpcUa::Types::DateTime;
+}
+
+/*!
+    Removes the value.
+*/
+void QOpcUaScalarDataChange::clearValue()
+{
+    data->value.u = 0;
+    data->valueType = QOpcUa::Types::Undefined;
+}
+
+/*!
+    Converts \a timestamp from OPC UA DateTime encoding to a QDateTime in local time.
+    A null QDateTime is returned for 0 and the minimum and maximum values.
+*/
+QDateTime QOpcUaScalarDataChange::toDateTime(qint64 timestamp)
+{
+    // OPC UA 1.05 part 6, 5.1.4
+    if (timestamp == 0 || timestamp == (std::numeric_limits<qint64>::min)()
+            || timestamp == (std::numeric_limits<qint64>::max)())
+        return QDateTime();
+
+    const QDateTime epochStart(QDate(1601, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    return epochStart.addMSecs(timestamp / 10000).toLocalTime();
+}
+
+/*!
+    Returns the value as QVariant with the same type a \l QOpcUaReadResult would contain for this data change.
+*/
+QVariant QOpcUaScalarDataChange::value() const
+{
+    switch (data->valueType) {
+    case QOpcUa::Types::Boolean:
+        return QVariant::fromValue(data->value.b);
+    case QOpcUa::Types::SByte:
+        return QVariant::fromValue(static_cast<signed char>(data->value.i));
+    case QOpcUa::Types::Byte:
+        return QVariant::fromValue(static_cast<uchar>(data->value.u));
+    case QOpcUa::Types::Int16:
+        return QVariant::fromValue(static_cast<qint16>(data->value.i));
+    case QOpcUa::Types::UInt16:
+        return QVariant::fromValue(static_cast<quint16>(data->value.u));
+    case QOpcUa::Types::Int32:
+        return QVariant::fromValue(static_cast<qint32>(data->value.i));
+    case QOpcUa::Types::UInt32:
+        return QVariant::fromValue(static_cast<quint32>(data->value.u));
+    case QOpcUa::Types::Int64:
+        return QVariant::fromValue(static_cast<qlonglong>(data->value.i));
+    case QOpcUa::Types::UInt64:
+        return QVariant::fromValue(static_cast<qulonglong>(data->value.u));
+    case QOpcUa::Types::Float:
+        return QVariant::fromValue(static_cast<float>(data->value.d));
+    case QOpcUa::Types::Double:
+        return QVariant::fromValue(data->value.d);
+    case QOpcUa::Types::DateTime:
+        return toDateTime(data->value.i);
+    case QOpcUa::Types::StatusCode:
+        return QVariant::fromValue(static_cast<quint32>(data->value.u));
+    default:
+        return QVariant();
+    }
+}
+
+/*!
+    Returns a \l QOpcUaReadResult containing the attribute, value, status code and timestamps of this data change.
+*/
+QOpcUaReadResult QOpcUaScalarDataChange::toReadResult() const
+{
+    QOpcUaReadResult result;
+    result.setAttribute(data->attribute);
+    result.setStatusCode(data->statusCode);
+    result.setValue(value());
+    if (data->sourceTimestamp)
+        result.setSourceTimestamp(toDateTime(data->sourceTimestamp));
+    if (data->serverTimestamp)
+        result.setServerTimestamp(toDateTime(data->serverTimestamp));
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUASCALARDATACHANGE_H
+#define QOPCUASCALARDATACHANGE_H
+
+#include <QtOpcUa/qopcuatype.h>
+#include <QtOpcUa/qopcuareadresult.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaScalarDataChangeData;
+class Q_OPCUA_EXPORT QOpcUaScalarDataChange
+{
+public:
+    QOpcUaScalarDataChange();
+    QOpcUaScalarDataChange(const QOpcUaScalarDataChange &other);
+    QOpcUaScalarDataChange &operator=(const QOpcUaScalarDataChange &rhs);
+    ~QOpcUaScalarDataChange();
+
+    QOpcUa::NodeAttribute attribute() const;
+    void setAttribute(QOpcUa::NodeAttribute attribute);
+
+    QOpcUa::UaStatusCode statusCode() const;
+    void setStatusCode(QOpcUa::UaStatusCode statusCode);
+
+    QOpcUa::Types valueType() const;
+    bool hasValue() const;
+
+    bool toBool() const;
+    qint64 toLongLong() const;
+    quint64 toULongLong() const;
+    double toDouble() const;
+
+    void setBoolean(bool value);
+    void setSignedInteger(qint64 value, QOpcUa::Types type);
+    void setUnsignedInteger(quint64 value, QOpcUa::Types type);
+    void setFloatingPoint(double value, QOpcUa::Types type);
+    void setDateTime(qint64 value);
+    void clearValue();
+
+    qint64 sourceTimestamp() const;
+    void setSourceTimestamp(qint64 timestamp);
+
+    qint64 serverTimestamp() const;
+    void setServerTimestamp(qint64 timestamp);
+
+    static QDateTime toDateTime(qint64 timestamp);
+
+    QVariant value() const;
+    QOpcUaReadResult toReadResult() const;
+
+private:
+    QSharedDataPointer<QOpcUaScalarDataChangeData> data;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaScalarDataChange)
+
+#endif // QOPCUASCALARDATACHANGE_H
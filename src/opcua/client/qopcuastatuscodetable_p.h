@@ -0,0 +1,366 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+// This file is generated by qtopcua-internalgenerator from StatusCode.csv, do not edit.
+
+#ifndef QOPCUASTATUSCODETABLE_P_H
+#define QOPCUASTATUSCODETABLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qglobal.h>
+
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+// Lookup table for QOpcUa::UaStatusCode which doesn't require the meta object
+namespace QOpcUaStatusCodeTable {
+
+// Sorted by code
+inline constexpr quint32 codes[] = {
+    0x00000000, 0x002D0000, 0x002E0000, 0x002F0000, 0x00300000, 0x00960000, 0x00A20000, 0x00A30000,
+    0x00A50000, 0x00A60000, 0x00A70000, 0x00A80000, 0x00A90000, 0x00AA0000, 0x00BA0000, 0x00D90000,
+    0x00DC0000, 0x00DD0000, 0x00DF0000, 0x00E00000, 0x01160000, 0x01170000, 0x01180000, 0x04010000,
+    0x04020000, 0x04030000, 0x04040000, 0x04070000, 0x04080000, 0x04090000, 0x40000000, 0x406C0000,
+    0x408F0000, 0x40900000, 0x40910000, 0x40920000, 0x40930000, 0x40940000, 0x40950000, 0x40A40000,
+    0x40BC0000, 0x40C00000, 0x40DE0000, 0x40E20000, 0x42080000, 0x42090000, 0x420A0000, 0x420F0000,
+    0x80000000, 0x80010000, 0x80020000, 0x80030000, 0x80040000, 0x80050000, 0x80060000, 0x80070000,
+    0x80080000, 0x80090000, 0x800A0000, 0x800B0000, 0x800C0000, 0x800D0000, 0x800E0000, 0x800F0000,
+    0x80100000, 0x80110000, 0x80120000, 0x80130000, 0x80140000, 0x80150000, 0x80160000, 0x80170000,
+    0x80180000, 0x80190000, 0x801A0000, 0x801B0000, 0x801C0000, 0x801D0000, 0x801E0000, 0x801F0000,
+    0x80200000, 0x80210000, 0x80220000, 0x80230000, 0x80240000, 0x80250000, 0x80260000, 0x80270000,
+    0x80280000, 0x802A0000, 0x802B0000, 0x802C0000, 0x80310000, 0x80320000, 0x80330000, 0x80340000,
+    0x80350000, 0x80360000, 0x80370000, 0x80380000, 0x80390000, 0x803A0000, 0x803B0000, 0x803C0000,
+    0x803D0000, 0x803E0000, 0x803F0000, 0x80400000, 0x80410000, 0x80420000, 0x80430000, 0x80440000,
+    0x80450000, 0x80460000, 0x80470000, 0x80480000, 0x80490000, 0x804A0000, 0x804B0000, 0x804C0000,
+    0x804D0000, 0x804E0000, 0x804F0000, 0x80500000, 0x80510000, 0x80520000, 0x80530000, 0x80540000,
+    0x80550000, 0x80560000, 0x80570000, 0x80580000, 0x80590000, 0x805A0000, 0x805B0000, 0x805C0000,
+    0x805D0000, 0x805E0000, 0x805F0000, 0x80600000, 0x80610000, 0x80620000, 0x80630000, 0x80640000,
+    0x80650000, 0x80660000, 0x80670000, 0x80680000, 0x80690000, 0x806A0000, 0x806B0000, 0x806D0000,
+    0x806E0000, 0x806F0000, 0x80700000, 0x80710000, 0x80720000, 0x80730000, 0x80740000, 0x80750000,
+    0x80760000, 0x80770000, 0x80780000, 0x80790000, 0x807A0000, 0x807B0000, 0x807C0000, 0x807D0000,
+    0x807E0000, 0x807F0000, 0x80800000, 0x80810000, 0x80820000, 0x80830000, 0x80840000, 0x80850000,
+    0x80860000, 0x80870000, 0x80880000, 0x80890000, 0x808A0000, 0x808B0000, 0x808C0000, 0x808D0000,
+    0x808E0000, 0x80970000, 0x80980000, 0x80990000, 0x809A0000, 0x809B0000, 0x809D0000, 0x809E0000,
+    0x809F0000, 0x80A00000, 0x80A10000, 0x80AB0000, 0x80AC0000, 0x80AD0000, 0x80AE0000, 0x80AF0000,
+    0x80B00000, 0x80B10000, 0x80B20000, 0x80B30000, 0x80B40000, 0x80B50000, 0x80B60000, 0x80B70000,
+    0x80B80000, 0x80B90000, 0x80BB0000, 0x80BD0000, 0x80BE0000, 0x80BF0000, 0x80C10000, 0x80C20000,
+    0x80C30000, 0x80C40000, 0x80C50000, 0x80C60000, 0x80C80000, 0x80C90000, 0x80CA0000, 0x80CB0000,
+    0x80CC0000, 0x80CD0000, 0x80CE0000, 0x80CF0000, 0x80D00000, 0x80D10000, 0x80D20000, 0x80D30000,
+    0x80D40000, 0x80D50000, 0x80D60000, 0x80D70000, 0x80D80000, 0x80DA0000, 0x80DB0000, 0x80E10000,
+    0x80E30000, 0x80E40000, 0x80E50000, 0x80E60000, 0x80E70000, 0x810D0000, 0x810E0000, 0x810F0000,
+    0x81100000, 0x81110000, 0x81120000, 0x81130000, 0x81140000, 0x81150000, 0x81190000, 0x811A0000,
+    0x811B0000, 0x811C0000, 0x811D0000, 0x811E0000, 0x811F0000, 0x81200000,
+};
+
+// Offsets of the names in names, in the same order
+inline constexpr quint32 nameOffsets[] = {
+    0, 5, 33, 61, 74, 86, 104, 122, 140, 151, 164, 187, 205, 219, 242, 269,
+    285, 296, 317, 353, 379, 412, 444, 498, 536, 569, 591, 614, 635, 658, 670, 680,
+    710, 750, 775, 800, 822, 849, 883, 902, 925, 954, 984, 1014, 1045, 1073, 1097, 1124,
+    1152, 1156, 1175, 1192, 1207, 1230, 1252, 1269, 1286, 1312, 1331, 1342, 1364, 1376, 1398, 1414,
+    1429, 1450, 1471, 1493, 1517, 1543, 1575, 1605, 1630, 1658, 1692, 1716, 1748, 1786, 1808, 1836,
+    1856, 1880, 1905, 1931, 1951, 1967, 1987, 2004, 2027, 2052, 2076, 2105, 2133, 2152, 2177, 2194,
+    2211, 2233, 2254, 2274, 2297, 2324, 2339, 2354, 2368, 2384, 2396, 2413, 2431, 2456, 2482, 2512,
+    2546, 2566, 2586, 2608, 2632, 2656, 2684, 2708, 2734, 2760, 2777, 2797, 2818, 2841, 2865, 2887,
+    2911, 2937, 2956, 2980, 3011, 3034, 3063, 3086, 3109, 3127, 3143, 3163, 3184, 3208, 3233, 3258,
+    3281, 3304, 3336, 3360, 3382, 3400, 3422, 3439, 3457, 3476, 3487, 3504, 3531, 3562, 3583, 3599,
+    3616, 3636, 3660, 3686, 3704, 3729, 3752, 3781, 3801, 3826, 3853, 3875, 3900, 3920, 3945, 3967,
+    3985, 4008, 4037, 4062, 4084, 4100, 4117, 4134, 4150, 4175, 4196, 4224, 4245, 4263, 4273, 4285,
+    4304, 4319, 4336, 4361, 4380, 4402, 4416, 4436, 4452, 4467, 4486, 4508, 4530, 4555, 4569, 4584,
+    4609, 4628, 4648, 4675, 4703, 4733, 4751, 4776, 4805, 4835, 4859, 4883, 4913, 4934, 4958, 4983,
+    5005, 5032, 5051, 5076, 5107, 5142, 5169, 5192, 5218, 5243, 5268, 5294, 5311, 5332, 5366, 5391,
+    5415, 5440, 5461, 5481, 5509, 5529, 5559, 5577, 5602, 5625, 5642, 5661, 5683, 5715, 5732, 5753,
+    5780, 5815, 5857, 5914, 5978, 5996,
+};
+
+// The names, each terminated by \0
+inline constexpr char names[] =
+    "Good\0"
+    "GoodSubscriptionTransferred\0"
+    "GoodCompletesAsynchronously\0"
+    "GoodOverload\0"
+    "GoodClamped\0"
+    "GoodLocalOverride\0"
+    "GoodEntryInserted\0"
+    "GoodEntryReplaced\0"
+    "GoodNoData\0"
+    "GoodMoreData\0"
+    "GoodCommunicationEvent\0"
+    "GoodShutdownEvent\0"
+    "GoodCallAgain\0"
+    "GoodNonCriticalTimeout\0"
+    "GoodResultsMayBeIncomplete\0"
+    "GoodDataIgnored\0"
+    "GoodEdited\0"
+    "GoodPostActionFailed\0"
+    "GoodRetransmissionQueueNotSupported\0"
+    "GoodDependentValueChanged\0"
+    "GoodEdited_DependentValueChanged\0"
+    "GoodEdited_DominantValueChanged\0"
+    "GoodEdited_DominantValueChanged_DependentValueChanged\0"
+    "GoodCascadeInitializationAcknowledged\0"
+    "GoodCascadeInitializationRequest\0"
+    "GoodCascadeNotInvited\0"
+    "GoodCascadeNotSelected\0"
+    "GoodFaultStateActive\0"
+    "GoodInitiateFaultState\0"
+    "GoodCascade\0"
+    "Uncertain\0"
+    "UncertainReferenceOutOfServer\0"
+    "UncertainNoCommunicationLastUsableValue\0"
+    "UncertainLastUsableValue\0"
+    "UncertainSubstituteValue\0"
+    "UncertainInitialValue\0"
+    "UncertainSensorNotAccurate\0"
+    "UncertainEngineeringUnitsExceeded\0"
+    "UncertainSubNormal\0"
+    "UncertainDataSubNormal\0"
+    "UncertainReferenceNotDeleted\0"
+    "UncertainNotAllNodesAvailable\0"
+    "UncertainDominantValueChanged\0"
+    "UncertainDependentValueChanged\0"
+    "UncertainTransducerInManual\0"
+    "UncertainSimulatedValue\0"
+    "UncertainSensorCalibration\0"
+    "UncertainConfigurationError\0"
+    "Bad\0"
+    "BadUnexpectedError\0"
+    "BadInternalError\0"
+    "BadOutOfMemory\0"
+    "BadResourceUnavailable\0"
+    "BadCommunicationError\0"
+    "BadEncodingError\0"
+    "BadDecodingError\0"
+    "BadEncodingLimitsExceeded\0"
+    "BadUnknownResponse\0"
+    "BadTimeout\0"
+    "BadServiceUnsupported\0"
+    "BadShutdown\0"
+    "BadServerNotConnected\0"
+    "BadServerHalted\0"
+    "BadNothingToDo\0"
+    "BadTooManyOperations\0"
+    "BadDataTypeIdUnknown\0"
+    "BadCertificateInvalid\0"
+    "BadSecurityChecksFailed\0"
+    "BadCertificateTimeInvalid\0"
+    "BadCertificateIssuerTimeInvalid\0"
+    "BadCertificateHostNameInvalid\0"
+    "BadCertificateUriInvalid\0"
+    "BadCertificateUseNotAllowed\0"
+    "BadCertificateIssuerUseNotAllowed\0"
+    "BadCertificateUntrusted\0"
+    "BadCertificateRevocationUnknown\0"
+    "BadCertificateIssuerRevocationUnknown\0"
+    "BadCertificateRevoked\0"
+    "BadCertificateIssuerRevoked\0"
+    "BadUserAccessDenied\0"
+    "BadIdentityTokenInvalid\0"
+    "BadIdentityTokenRejected\0"
+    "BadSecureChannelIdInvalid\0"
+    "BadInvalidTimestamp\0"
+    "BadNonceInvalid\0"
+    "BadSessionIdInvalid\0"
+    "BadSessionClosed\0"
+    "BadSessionNotActivated\0"
+    "BadSubscriptionIdInvalid\0"
+    "BadRequestHeaderInvalid\0"
+    "BadTimestampsToReturnInvalid\0"
+    "BadRequestCancelledByClient\0"
+    "BadNoCommunication\0"
+    "BadWaitingForInitialData\0"
+    "BadNodeIdInvalid\0"
+    "BadNodeIdUnknown\0"
+    "BadAttributeIdInvalid\0"
+    "BadIndexRangeInvalid\0"
+    "BadIndexRangeNoData\0"
+    "BadDataEncodingInvalid\0"
+    "BadDataEncodingUnsupported\0"
+    "BadNotReadable\0"
+    "BadNotWritable\0"
+    "BadOutOfRange\0"
+    "BadNotSupported\0"
+    "BadNotFound\0"
+    "BadObjectDeleted\0"
+    "BadNotImplemented\0"
+    "BadMonitoringModeInvalid\0"
+    "BadMonitoredItemIdInvalid\0"
+    "BadMonitoredItemFilterInvalid\0"
+    "BadMonitoredItemFilterUnsupported\0"
+    "BadFilterNotAllowed\0"
+    "BadStructureMissing\0"
+    "BadEventFilterInvalid\0"
+    "BadContentFilterInvalid\0"
+    "BadFilterOperandInvalid\0"
+    "BadContinuationPointInvalid\0"
+    "BadNoContinuationPoints\0"
+    "BadReferenceTypeIdInvalid\0"
+    "BadBrowseDirectionInvalid\0"
+    "BadNodeNotInView\0"
+    "BadServerUriInvalid\0"
+    "BadServerNameMissing\0"
+    "BadDiscoveryUrlMissing\0"
+    "BadSempahoreFileMissing\0"
+    "BadRequestTypeInvalid\0"
+    "BadSecurityModeRejected\0"
+    "BadSecurityPolicyRejected\0"
+    "BadTooManySessions\0"
+    "BadUserSignatureInvalid\0"
+    "BadApplicationSignatureInvalid\0"
+    "BadNoValidCertificates\0"
+    "BadRequestCancelledByRequest\0"
+    "BadParentNodeIdInvalid\0"
+    "BadReferenceNotAllowed\0"
+    "BadNodeIdRejected\0"
+    "BadNodeIdExists\0"
+    "BadNodeClassInvalid\0"
+    "BadBrowseNameInvalid\0"
+    "BadBrowseNameDuplicated\0"
+    "BadNodeAttributesInvalid\0"
+    "BadTypeDefinitionInvalid\0"
+    "BadSourceNodeIdInvalid\0"
+    "BadTargetNodeIdInvalid\0"
+    "BadDuplicateReferenceNotAllowed\0"
+    "BadInvalidSelfReference\0"
+    "BadReferenceLocalOnly\0"
+    "BadNoDeleteRights\0"
+    "BadServerIndexInvalid\0"
+    "BadViewIdUnknown\0"
+    "BadTooManyMatches\0"
+    "BadQueryTooComplex\0"
+    "BadNoMatch\0"
+    "BadMaxAgeInvalid\0"
+    "BadHistoryOperationInvalid\0"
+    "BadHistoryOperationUnsupported\0"
+    "BadWriteNotSupported\0"
+    "BadTypeMismatch\0"
+    "BadMethodInvalid\0"
+    "BadArgumentsMissing\0"
+    "BadTooManySubscriptions\0"
+    "BadTooManyPublishRequests\0"
+    "BadNoSubscription\0"
+    "BadSequenceNumberUnknown\0"
+    "BadMessageNotAvailable\0"
+    "BadInsufficientClientProfile\0"
+    "BadTcpServerTooBusy\0"
+    "BadTcpMessageTypeInvalid\0"
+    "BadTcpSecureChannelUnknown\0"
+    "BadTcpMessageTooLarge\0"
+    "BadTcpNotEnoughResources\0"
+    "BadTcpInternalError\0"
+    "BadTcpEndpointUrlInvalid\0"
+    "BadRequestInterrupted\0"
+    "BadRequestTimeout\0"
+    "BadSecureChannelClosed\0"
+    "BadSecureChannelTokenUnknown\0"
+    "BadSequenceNumberInvalid\0"
+    "BadConfigurationError\0"
+    "BadNotConnected\0"
+    "BadDeviceFailure\0"
+    "BadSensorFailure\0"
+    "BadOutOfService\0"
+    "BadDeadbandFilterInvalid\0"
+    "BadRefreshInProgress\0"
+    "BadConditionAlreadyDisabled\0"
+    "BadConditionDisabled\0"
+    "BadEventIdUnknown\0"
+    "BadNoData\0"
+    "BadDataLost\0"
+    "BadDataUnavailable\0"
+    "BadEntryExists\0"
+    "BadNoEntryExists\0"
+    "BadTimestampNotSupported\0"
+    "BadInvalidArgument\0"
+    "BadConnectionRejected\0"
+    "BadDisconnect\0"
+    "BadConnectionClosed\0"
+    "BadInvalidState\0"
+    "BadEndOfStream\0"
+    "BadNoDataAvailable\0"
+    "BadWaitingForResponse\0"
+    "BadOperationAbandoned\0"
+    "BadExpectedStreamToBlock\0"
+    "BadWouldBlock\0"
+    "BadSyntaxError\0"
+    "BadMaxConnectionsReached\0"
+    "BadRequestTooLarge\0"
+    "BadResponseTooLarge\0"
+    "BadEventNotAcknowledgeable\0"
+    "BadInvalidTimestampArgument\0"
+    "BadProtocolVersionUnsupported\0"
+    "BadStateNotActive\0"
+    "BadFilterOperatorInvalid\0"
+    "BadFilterOperatorUnsupported\0"
+    "BadFilterOperandCountMismatch\0"
+    "BadFilterElementInvalid\0"
+    "BadFilterLiteralInvalid\0"
+    "BadIdentityChangeNotSupported\0"
+    "BadNotTypeDefinition\0"
+    "BadViewTimestampInvalid\0"
+    "BadViewParameterMismatch\0"
+    "BadViewVersionInvalid\0"
+    "BadConditionAlreadyEnabled\0"
+    "BadDialogNotActive\0"
+    "BadDialogResponseInvalid\0"
+    "BadConditionBranchAlreadyAcked\0"
+    "BadConditionBranchAlreadyConfirmed\0"
+    "BadConditionAlreadyShelved\0"
+    "BadConditionNotShelved\0"
+    "BadShelvingTimeOutOfRange\0"
+    "BadAggregateListMismatch\0"
+    "BadAggregateNotSupported\0"
+    "BadAggregateInvalidInputs\0"
+    "BadBoundNotFound\0"
+    "BadBoundNotSupported\0"
+    "BadAggregateConfigurationRejected\0"
+    "BadTooManyMonitoredItems\0"
+    "BadDominantValueChanged\0"
+    "BadDependentValueChanged\0"
+    "BadRequestNotAllowed\0"
+    "BadTooManyArguments\0"
+    "BadSecurityModeInsufficient\0"
+    "BadDataSetIdInvalid\0"
+    "BadCertificateChainIncomplete\0"
+    "BadLicenseExpired\0"
+    "BadLicenseLimitsExceeded\0"
+    "BadLicenseNotAvailable\0"
+    "BadNotExecutable\0"
+    "BadNumericOverflow\0"
+    "BadRequestNotComplete\0"
+    "BadCertificatePolicyCheckFailed\0"
+    "BadAlreadyExists\0"
+    "BadEdited_OutOfRange\0"
+    "BadInitialValue_OutOfRange\0"
+    "BadOutOfRange_DominantValueChanged\0"
+    "BadEdited_OutOfRange_DominantValueChanged\0"
+    "BadOutOfRange_DominantValueChanged_DependentValueChanged\0"
+    "BadEdited_OutOfRange_DominantValueChanged_DependentValueChanged\0"
+    "BadTicketRequired\0"
+    "BadTicketInvalid\0";
+
+static_assert(sizeof(names) == 6014);
+static_assert(std::size(nameOffsets) == 262);
+
+constexpr const char *name(qsizetype index)
+{
+    return names + nameOffsets[index];
+}
+
+static_assert(std::size(codes) == std::size(nameOffsets));
+
+} // namespace QOpcUaStatusCodeTable
+
+QT_END_NAMESPACE
+
+#endif // QOPCUASTATUSCODETABLE_P_H
@@ -0,0 +1,478 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuasubscriptionrecorder.h"
+#include "qopcuasubscriptionrecorder_p.h"
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuaexpandednodeid.h>
+#include <QtOpcUa/qopcuaextensionobject.h>
+#include <QtOpcUa/qopcualocalizedtext.h>
+#include <QtOpcUa/qopcuaqualifiedname.h>
+#include <QtOpcUa/qopcuavariant.h>
+#include <private/qopcuaclient_p.h>
+#include <private/qopcuaclientimpl_p.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qsequentialiterable.h>
+#include <QtCore/quuid.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaSubscriptionRecorder
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class records the data change and event notifications of a client to a file.
+
+    Problems which only occur with the notification traffic of a production system are hard to
+    reproduce without access to the servers. A recorder writes all data change and event
+    notifications received by a \l QOpcUaClient to a file. \l QOpcUaRecordingPlayer replays
+    the file later without a server.
+
+    \code
+    QOpcUaSubscriptionRecorder recorder(client);
+    recorder.open(u"notifications.qopcuarec"_s);
+    ...
+    recorder.close();
+    \endcode
+
+    Each record contains the time at which the notification has been received, the node id, the attribute,
+    the status code, the timestamps and the value in the OPC UA binary encoding. Records are collected in
+    chunks of \l chunkSize() bytes which are appended to the file. An index of the chunks is written when the
+    recording is closed. A recording which has not been closed, for example because the application has
+    crashed, can still be replayed up to the last complete chunk.
+
+    Values of structured types which have been decoded by the backend, for example \l QOpcUaRange,
+    are not recorded. The record contains the status code and the timestamps without the value and
+    \l skippedValueCount() is incremented.
+
+    \sa QOpcUaRecordingPlayer
+*/
+
+using namespace QOpcUaRecordingFormat;
+
+static QOpcUaVariant::ValueType valueTypeFromMetaType(QMetaType type)
+{
+    using ValueType = QOpcUaVariant::ValueType;
+
+    switch (type.id()) {
+    case QMetaType::Bool:
+        return ValueType::Boolean;
+    case QMetaType::Char:
+    case QMetaType::SChar:
+        return ValueType::SByte;
+    case QMetaType::UChar:
+        return ValueType::Byte;
+    case QMetaType::Short:
+        return ValueType::Int16;
+    case QMetaType::UShort:
+        return ValueType::UInt16;
+    case QMetaType::Int:
+        return ValueType::Int32;
+    case QMetaType::UInt:
+        return ValueType::UInt32;
+    case QMetaType::LongLong:
+        return ValueType::Int64;
+    case QMetaType::ULongLong:
+        return ValueType::UInt64;
+    case QMetaType::Float:
+        return ValueType::Float;
+    case QMetaType::Double:
+        return ValueType::Double;
+    case QMetaType::QString:
+        return ValueType::String;
+    case QMetaType::QDateTime:
+        return ValueType::DateTime;
+    case QMetaType::QUuid:
+        return ValueType::Guid;
+    case QMetaType::QByteArray:
+        return ValueType::ByteString;
+    default:
+        break;
+    }
+
+    if (type == QMetaType::fromType<QOpcUaExpandedNodeId>())
+        return ValueType::ExpandedNodeId;
+    if (type == QMetaType::fromType<QOpcUa::UaStatusCode>())
+        return ValueType::StatusCode;
+    if (type == QMetaType::fromType<QOpcUaQualifiedName>())
+        return ValueType::QualifiedName;
+    if (type == QMetaType::fromType<QOpcUaLocalizedText>())
+        return ValueType::LocalizedText;
+    if (type == QMetaType::fromType<QOpcUaExtensionObject>())
+        return ValueType::ExtensionObject;
+
+    return ValueType::Unknown;
+}
+
+static bool encodeElement(QOpcUaBinaryDataEncoding &encoder, QOpcUaVariant::ValueType type, const QVariant &value)
+{
+    using ValueType = QOpcUaVariant::ValueType;
+
+    switch (type) {
+    case ValueType::Boolean:
+        return encoder.encode<bool>(value.toBool());
+    case ValueType::SByte:
+        return encoder.encode<qint8>(value.value<qint8>());
+    case ValueType::Byte:
+        return encoder.encode<quint8>(value.value<quint8>());
+    case ValueType::Int16:
+        return encoder.encode<qint16>(value.value<qint16>());
+    case ValueType::UInt16:
+        return encoder.encode<quint16>(value.value<quint16>());
+    case ValueType::Int32:
+        return encoder.encode<qint32>(value.value<qint32>());
+    case ValueType::UInt32:
+        return encoder.encode<quint32>(value.value<quint32>());
+    case ValueType::Int64:
+        return encoder.encode<qint64>(value.value<qint64>());
+    case ValueType::UInt64:
+        return encoder.encode<quint64>(value.value<quint64>());
+    case ValueType::Float:
+        return encoder.encode<float>(value.toFloat());
+    case ValueType::Double:
+        return encoder.encode<double>(value.toDouble());
+    case ValueType::String:
+        return encoder.encode<QString>(value.toString());
+    case ValueType::DateTime:
+        return encoder.encode<QDateTime>(value.toDateTime());
+    case ValueType::Guid:
+        return encoder.encode<QUuid>(value.toUuid());
+    case ValueType::ByteString:
+        return encoder.encode<QByteArray>(value.toByteArray());
+    case ValueType::ExpandedNodeId:
+        return encoder.encode<QOpcUaExpandedNodeId>(value.value<QOpcUaExpandedNodeId>());
+    case ValueType::StatusCode:
+        return encoder.encode<QOpcUa::UaStatusCode>(value.value<QOpcUa::UaStatusCode>());
+    case ValueType::QualifiedName:
+        return encoder.encode<QOpcUaQualifiedName>(value.value<QOpcUaQualifiedName>());
+    case ValueType::LocalizedText:
+        return encoder.encode<QOpcUaLocalizedText>(value.value<QOpcUaLocalizedText>());
+    case ValueType::ExtensionObject:
+        return encoder.encode<QOpcUaExtensionObject>(value.value<QOpcUaExtensionObject>());
+    default:
+        return false;
+    }
+}
+
+// Encodes value as flags followed by an OPC UA Variant.
+// Returns false for unsupported values, the encoder may contain a partial encoding in this case.
+bool QOpcUaRecordingFormat::encodeValue(QOpcUaBinaryDataEncoding &encoder, const QVariant &value)
+{
+    if (!value.isValid())
+        return encoder.encode<quint8>(NullValue);
+
+    auto type = valueTypeFromMetaType(value.metaType());
+    if (type != QOpcUaVariant::ValueType::Unknown) {
+        return encoder.encode<quint8>(0) && encoder.encode<quint8>(static_cast<quint8>(type))
+                && encodeElement(encoder, type, value);
+    }
+
+    quint8 flags = 0;
+    QVariantList elements;
+    if (value.metaType() == QMetaType::fromType<QVariantList>()) {
+        flags |= VariantListValue;
+        elements = value.toList();
+    } else if (value.canConvert<QSequentialIterable>()) {
+        for (const auto &element : value.value<QSequentialIterable>())
+            elements.push_back(element);
+    } else {
+        return false;
+    }
+
+    type = elements.isEmpty() ? QOpcUaVariant::ValueType::Boolean
+                              : valueTypeFromMetaType(elements.constFirst().metaType());
+    const bool supported = type != QOpcUaVariant::ValueType::Unknown
+            && std::all_of(elements.cbegin(), elements.cend(), [type](const QVariant &element) {
+                   return valueTypeFromMetaType(element.metaType()) == type;
+               });
+    if (!supported)
+        return false;
+
+    if (!encoder.encode<quint8>(flags) || !encoder.encode<quint8>(static_cast<quint8>(type) | (1 << 7))
+            || !encoder.encode<qint32>(static_cast<qint32>(elements.size())))
+        return false;
+
+    for (const auto &element : std::as_const(elements)) {
+        if (!encodeElement(encoder, type, element))
+            return false;
+    }
+
+    return true;
+}
+
+QVariant QOpcUaRecordingFormat::decodeValue(QOpcUaBinaryDataEncoding &decoder, bool &success)
+{
+    const auto flags = decoder.decode<quint8>(success);
+    if (!success || (flags & NullValue))
+        return QVariant();
+
+    const auto variant = decoder.decode<QOpcUaVariant>(success);
+    if (!success)
+        return QVariant();
+
+    if (flags & VariantListValue) {
+        QVariantList list;
+        for (const auto &element : variant.value().value<QSequentialIterable>())
+            list.push_back(element);
+        return list;
+    }
+
+    return variant.value();
+}
+
+QOpcUaSubscriptionRecorderPrivate::QOpcUaSubscriptionRecorderPrivate(QOpcUaClient *client)
+    : m_client(client)
+{
+}
+
+void QOpcUaSubscriptionRecorderPrivate::recordDataChange(const QString &nodeId, const QOpcUaReadResult &result)
+{
+    QOpcUaBinaryDataEncoding encoder(&m_chunk);
+    startRecord(RecordType::DataChange, nodeId, encoder);
+
+    encoder.encode<quint32>(static_cast<quint32>(result.attribute()));
+    encoder.encode<QOpcUa::UaStatusCode>(result.statusCode());
+    encoder.encode<QDateTime>(result.sourceTimestamp());
+    encoder.encode<QDateTime>(result.serverTimestamp());
+    recordValue(encoder, result.value());
+
+    finishRecord();
+}
+
+void QOpcUaSubscriptionRecorderPrivate::recordEvent(const QString &nodeId, const QVariantList &eventFields)
+{
+    QOpcUaBinaryDataEncoding encoder(&m_chunk);
+    startRecord(RecordType::Event, nodeId, encoder);
+
+    encoder.encode<qint32>(static_cast<qint32>(eventFields.size()));
+    for (const auto &field : eventFields)
+        recordValue(encoder, field);
+
+    finishRecord();
+}
+
+// Values are encoded into a separate buffer, a value which fails in the middle must not leave
+// a partial encoding in the chunk. Unsupported values are recorded as null.
+void QOpcUaSubscriptionRecorderPrivate::recordValue(QOpcUaBinaryDataEncoding &encoder, const QVariant &value)
+{
+    m_valueBuffer.resize(0); // Keeps the capacity
+    QOpcUaBinaryDataEncoding valueEncoder(&m_valueBuffer);
+
+    if (encodeValue(valueEncoder, value)) {
+        m_chunk.append(m_valueBuffer);
+    } else {
+        ++m_skippedValueCount;
+        encoder.encode<quint8>(NullValue);
+    }
+}
+
+void QOpcUaSubscriptionRecorderPrivate::startRecord(RecordType type, const QString &nodeId,
+                                                    QOpcUaBinaryDataEncoding &encoder)
+{
+    m_recordTime = m_clock.nsecsElapsed();
+    if (!m_currentChunk.recordCount)
+        m_currentChunk.firstTime = m_recordTime;
+
+    encoder.encode<quint8>(static_cast<quint8>(type));
+    encoder.encode<qint64>(m_recordTime);
+    encoder.encode<QString>(nodeId);
+}
+
+void QOpcUaSubscriptionRecorderPrivate::finishRecord()
+{
+    m_currentChunk.lastTime = m_recordTime;
+    ++m_currentChunk.recordCount;
+    ++m_recordCount;
+
+    if (m_chunk.size() >= m_chunkSize)
+        flushChunk();
+}
+
+bool QOpcUaSubscriptionRecorderPrivate::flushChunk()
+{
+    if (!m_currentChunk.recordCount)
+        return true;
+
+    QByteArray header;
+    QOpcUaBinaryDataEncoding encoder(&header);
+    encoder.encode<quint32>(chunkMagic);
+    encoder.encode<quint32>(static_cast<quint32>(m_chunk.size()));
+    encoder.encode<quint32>(m_currentChunk.recordCount);
+    encoder.encode<qint64>(m_currentChunk.firstTime);
+    encoder.encode<qint64>(m_currentChunk.lastTime);
+
+    m_currentChunk.fileOffset = m_file.pos();
+    const bool success = m_file.write(header) == header.size() && m_file.write(m_chunk) == m_chunk.size();
+    if (!success)
+        qCWarning(QT_OPCUA) << "Failed to write to the recording" << m_file.fileName() << m_file.errorString();
+    else
+        m_chunks.push_back(m_currentChunk);
+
+    m_chunk.clear();
+    m_currentChunk = ChunkInfo();
+
+    return success;
+}
+
+bool QOpcUaSubscriptionRecorderPrivate::writeIndex()
+{
+    const qint64 indexOffset = m_file.pos();
+
+    QByteArray index;
+    QOpcUaBinaryDataEncoding encoder(&index);
+    encoder.encode<quint32>(indexMagic);
+    encoder.encode<quint32>(static_cast<quint32>(m_chunks.size()));
+    for (const auto &chunk : std::as_const(m_chunks)) {
+        encoder.encode<qint64>(chunk.fileOffset);
+        encoder.encode<qint64>(chunk.firstTime);
+        encoder.encode<qint64>(chunk.lastTime);
+        encoder.encode<quint32>(chunk.recordCount);
+    }
+    encoder.encode<qint64>(indexOffset);
+    index.append(trailerMagic, sizeof(trailerMagic));
+
+    return m_file.write(index) == index.size();
+}
+
+/*!
+    Constructs a recorder for the notifications received by \a client with parent \a parent.
+*/
+QOpcUaSubscriptionRecorder::QOpcUaSubscriptionRecorder(QOpcUaClient *client, QObject *parent)
+    : QObject(*new QOpcUaSubscriptionRecorderPrivate(client), parent)
+{
+}
+
+/*!
+    Closes the recording and destroys the recorder.
+*/
+QOpcUaSubscriptionRecorder::~QOpcUaSubscriptionRecorder()
+{
+    close();
+}
+
+/*!
+    Creates the file \a fileName and starts recording. An existing file is overwritten.
+    A recording which is in progress is closed first.
+
+    Returns \c true if the file has been created.
+*/
+bool QOpcUaSubscriptionRecorder::open(const QString &fileName)
+{
+    Q_D(QOpcUaSubscriptionRecorder);
+
+    close();
+
+    if (!d->m_client)
+        return false;
+
+    d->m_file.setFileName(fileName);
+    if (!d->m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(QT_OPCUA) << "Failed to create the recording" << fileName << d->m_file.errorString();
+        return false;
+    }
+
+    QByteArray header(fileMagic, sizeof(fileMagic));
+    QOpcUaBinaryDataEncoding encoder(&header);
+    encoder.encode<quint32>(version);
+    encoder.encode<qint64>(QDateTime::currentMSecsSinceEpoch());
+    if (d->m_file.write(header) != header.size()) {
+        qCWarning(QT_OPCUA) << "Failed to write to the recording" << fileName << d->m_file.errorString();
+        d->m_file.close();
+        return false;
+    }
+
+    d->m_recordCount = 0;
+    d->m_skippedValueCount = 0;
+    d->m_chunks.clear();
+    d->m_chunk.reserve(d->m_chunkSize);
+    d->m_clock.start();
+
+    // Batched data changes bypass the nodes and are recorded from the signal of the client
+    d->m_batchConnection = connect(d->m_client, &QOpcUaClient::dataChangesReceived, this,
+                                   [d](const QList<QOpcUaReadResult> &results) {
+        for (const auto &result : results)
+            d->recordDataChange(result.nodeId(), result);
+    });
+
+    static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(d->m_client))->m_impl->m_recorder = this;
+
+    return true;
+}
+
+/*!
+    Writes the remaining records and the index and closes the file.
+*/
+void QOpcUaSubscriptionRecorder::close()
+{
+    Q_D(QOpcUaSubscriptionRecorder);
+
+    if (!d->m_file.isOpen())
+        return;
+
+    if (d->m_client) {
+        auto impl = static_cast<QOpcUaClientPrivate *>(QObjectPrivate::get(d->m_client))->m_impl.get();
+        if (impl->m_recorder == this)
+            impl->m_recorder = nullptr;
+    }
+    disconnect(d->m_batchConnection);
+
+    if (!d->flushChunk() || !d->writeIndex())
+        qCWarning(QT_OPCUA) << "Failed to finish the recording" << d->m_file.fileName() << d->m_file.errorString();
+
+    d->m_file.close();
+}
+
+/*!
+    Returns \c true if a recording is in progress.
+*/
+bool QOpcUaSubscriptionRecorder::isOpen() const
+{
+    Q_D(const QOpcUaSubscriptionRecorder);
+    return d->m_file.isOpen();
+}
+
+/*!
+    Returns the size of a chunk in bytes.
+*/
+qsizetype QOpcUaSubscriptionRecorder::chunkSize() const
+{
+    Q_D(const QOpcUaSubscriptionRecorder);
+    return d->m_chunkSize;
+}
+
+/*!
+    Sets the size of a chunk to \a chunkSize bytes. The default value is 64 KiB.
+
+    Records are written to the file when the chunk is full. Smaller chunks lose less records
+    if the application crashes, larger chunks need less write operations.
+*/
+void QOpcUaSubscriptionRecorder::setChunkSize(qsizetype chunkSize)
+{
+    Q_D(QOpcUaSubscriptionRecorder);
+    d->m_chunkSize = qMax<qsizetype>(1, chunkSize);
+}
+
+/*!
+    Returns the number of records since the recording has been opened.
+*/
+quint64 QOpcUaSubscriptionRecorder::recordCount() const
+{
+    Q_D(const QOpcUaSubscriptionRecorder);
+    return d->m_recordCount;
+}
+
+/*!
+    Returns the number of values which have not been recorded because their type is not supported.
+*/
+quint64 QOpcUaSubscriptionRecorder::skippedValueCount() const
+{
+    Q_D(const QOpcUaSubscriptionRecorder);
+    return d->m_skippedValueCount;
+}
+
+QT_END_NAMESPACE
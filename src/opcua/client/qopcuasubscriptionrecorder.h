@@ -0,0 +1,38 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUASUBSCRIPTIONRECORDER_H
+#define QOPCUASUBSCRIPTIONRECORDER_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qobject.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClient;
+
+class QOpcUaSubscriptionRecorderPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaSubscriptionRecorder : public QObject
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QOpcUaSubscriptionRecorder)
+public:
+    explicit QOpcUaSubscriptionRecorder(QOpcUaClient *client, QObject *parent = nullptr);
+    ~QOpcUaSubscriptionRecorder() override;
+
+    bool open(const QString &fileName);
+    void close();
+    bool isOpen() const;
+
+    qsizetype chunkSize() const;
+    void setChunkSize(qsizetype chunkSize);
+
+    quint64 recordCount() const;
+    quint64 skippedValueCount() const;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUASUBSCRIPTIONRECORDER_H
@@ -0,0 +1,121 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUASUBSCRIPTIONRECORDER_P_H
+#define QOPCUASUBSCRIPTIONRECORDER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuaclient.h>
+#include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuasubscriptionrecorder.h>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qpointer.h>
+#include <private/qobject_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaBinaryDataEncoding;
+
+// Layout of a recording, all numbers are little endian:
+//
+// File header: magic "QOPCUARC", quint32 version, qint64 start time in ms since the epoch
+// Chunks:      quint32 chunkMagic, quint32 payload size, quint32 record count,
+//              qint64 time of the first record, qint64 time of the last record, payload
+// Index:       quint32 indexMagic, quint32 chunk count,
+//              per chunk qint64 file offset, qint64 first time, qint64 last time, quint32 record count
+// Trailer:     qint64 file offset of the index, magic "QOPCUAIX"
+//
+// Record times are nanoseconds since the start of the recording. A record starts with the
+// RecordType, the time and the node id. Values are stored as an OPC UA Variant which
+// is preceded by a flags byte.
+// If the recording has not been closed, the index and the trailer are missing and the
+// chunks are found by scanning the file.
+namespace QOpcUaRecordingFormat {
+
+constexpr char fileMagic[8] = {'Q', 'O', 'P', 'C', 'U', 'A', 'R', 'C'};
+constexpr char trailerMagic[8] = {'Q', 'O', 'P', 'C', 'U', 'A', 'I', 'X'};
+constexpr quint32 version = 1;
+constexpr quint32 chunkMagic = 0x48435551; // "QUCH"
+constexpr quint32 indexMagic = 0x58495551; // "QUIX"
+
+constexpr qsizetype fileHeaderSize = 8 + 4 + 8;
+constexpr qsizetype chunkHeaderSize = 4 + 4 + 4 + 8 + 8;
+constexpr qsizetype indexEntrySize = 8 + 8 + 8 + 4;
+constexpr qsizetype trailerSize = 8 + 8;
+
+enum class RecordType : quint8 {
+    DataChange = 1,
+    Event = 2,
+};
+
+enum ValueFlag : quint8 {
+    NullValue = 0x01,
+    VariantListValue = 0x02, // The array has been delivered as QVariantList instead of QList<T>
+};
+
+struct ChunkInfo {
+    qint64 fileOffset = 0;
+    qint64 firstTime = 0;
+    qint64 lastTime = 0;
+    quint32 recordCount = 0;
+};
+
+bool encodeValue(QOpcUaBinaryDataEncoding &encoder, const QVariant &value);
+QVariant decodeValue(QOpcUaBinaryDataEncoding &decoder, bool &success);
+
+}
+
+class QOpcUaSubscriptionRecorderPrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QOpcUaSubscriptionRecorder)
+
+public:
+    QOpcUaSubscriptionRecorderPrivate(QOpcUaClient *client);
+
+    static QOpcUaSubscriptionRecorderPrivate *get(QOpcUaSubscriptionRecorder *recorder)
+    {
+        return recorder->d_func();
+    }
+
+    void recordDataChange(const QString &nodeId, const QOpcUaReadResult &result);
+    void recordEvent(const QString &nodeId, const QVariantList &eventFields);
+    void recordValue(QOpcUaBinaryDataEncoding &encoder, const QVariant &value);
+
+    void startRecord(QOpcUaRecordingFormat::RecordType type, const QString &nodeId,
+                     QOpcUaBinaryDataEncoding &encoder);
+    void finishRecord();
+    bool flushChunk();
+    bool writeIndex();
+
+    QPointer<QOpcUaClient> m_client;
+    QFile m_file;
+    QElapsedTimer m_clock;
+    qsizetype m_chunkSize = 64 * 1024;
+
+    QByteArray m_chunk;
+    QByteArray m_valueBuffer;
+    QOpcUaRecordingFormat::ChunkInfo m_currentChunk;
+    QList<QOpcUaRecordingFormat::ChunkInfo> m_chunks;
+    qint64 m_recordTime = 0;
+
+    quint64 m_recordCount = 0;
+    quint64 m_skippedValueCount = 0;
+    QMetaObject::Connection m_batchConnection;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUASUBSCRIPTIONRECORDER_P_H
@@ -0,0 +1,230 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuasubscriptionstatistics.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaSubscriptionStatistics
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class contains the statistics of a subscription on the server.
+
+    A backend may spread the monitored items of a shared subscription with the same
+    publishing interval over several subscriptions on the server. Each of them has its
+    own publish pipeline and its own limits for the number of notifications per publish response.
+
+    Objects of this class are returned in the \l QOpcUaClient::subscriptionStatisticsReceived()
+    signal and allow an application to check how the monitored items are distributed and how
+    many notifications each subscription has delivered.
+
+    \sa QOpcUaClient::requestSubscriptionStatistics()
+*/
+class QOpcUaSubscriptionStatisticsData : public QSharedData
+{
+public:
+    quint32 subscriptionId = 0;
+    double publishingInterval = 0;
+    quint32 monitoredItemCount = 0;
+    double expectedNotificationsPerPublish = 0;
+    quint64 dataChangeNotifications = 0;
+    quint64 eventNotifications = 0;
+    quint64 sequenceGaps = 0;
+    quint64 republishedMessages = 0;
+    quint64 unrecoverableMessages = 0;
+};
+
+/*!
+    Default constructs a subscription statistics object with no parameters set.
+*/
+QOpcUaSubscriptionStatistics::QOpcUaSubscriptionStatistics()
+    : data(new QOpcUaSubscriptionStatisticsData)
+{
+}
+
+/*!
+    Constructs subscription statistics from \a other.
+*/
+QOpcUaSubscriptionStatistics::QOpcUaSubscriptionStatistics(const QOpcUaSubscriptionStatistics &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this subscription statistics object.
+*/
+QOpcUaSubscriptionStatistics &QOpcUaSubscriptionStatistics::operator=(const QOpcUaSubscriptionStatistics &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaSubscriptionStatistics::~QOpcUaSubscriptionStatistics()
+{
+}
+
+/*!
+    Returns the id of the subscription on the server.
+*/
+quint32 QOpcUaSubscriptionStatistics::subscriptionId() const
+{
+    return data->subscriptionId;
+}
+
+/*!
+    Sets the subscription id to \a subscriptionId.
+*/
+void QOpcUaSubscriptionStatistics::setSubscriptionId(quint32 subscriptionId)
+{
+    data->subscriptionId = subscriptionId;
+}
+
+/*!
+    Returns the publishing interval of the subscription as revised by the server.
+*/
+double QOpcUaSubscriptionStatistics::publishingInterval() const
+{
+    return data->publishingInterval;
+}
+
+/*!
+    Sets the publishing interval to \a publishingInterval.
+*/
+void QOpcUaSubscriptionStatistics::setPublishingInterval(double publishingInterval)
+{
+    data->publishingInterval = publishingInterval;
+}
+
+/*!
+    Returns the number of monitored items in the subscription.
+
+    Monitored items which are shared by several nodes are counted once.
+*/
+quint32 QOpcUaSubscriptionStatistics::monitoredItemCount() const
+{
+    return data->monitoredItemCount;
+}
+
+/*!
+    Sets the number of monitored items to \a monitoredItemCount.
+*/
+void QOpcUaSubscriptionStatistics::setMonitoredItemCount(quint32 monitoredItemCount)
+{
+    data->monitoredItemCount = monitoredItemCount;
+}
+
+/*!
+    Returns the number of notifications the subscription is expected to deliver per publishing
+    interval if all monitored items change as fast as they are sampled.
+
+    The estimate of a data change item is the ratio of publishing interval and sampling interval,
+    limited by the queue size. Event items and items with a monitoring mode other than
+    \l {QOpcUaMonitoringParameters::MonitoringMode} {Reporting} are estimated with one
+    and zero notifications.
+*/
+double QOpcUaSubscriptionStatistics::expectedNotificationsPerPublish() const
+{
+    return data->expectedNotificationsPerPublish;
+}
+
+/*!
+    Sets the expected number of notifications per publishing interval to \a expectedNotifications.
+*/
+void QOpcUaSubscriptionStatistics::setExpectedNotificationsPerPublish(double expectedNotifications)
+{
+    data->expectedNotificationsPerPublish = expectedNotifications;
+}
+
+/*!
+    Returns the number of data change notifications received since the subscription has been created.
+*/
+quint64 QOpcUaSubscriptionStatistics::dataChangeNotifications() const
+{
+    return data->dataChangeNotifications;
+}
+
+/*!
+    Sets the number of data change notifications to \a dataChangeNotifications.
+*/
+void QOpcUaSubscriptionStatistics::setDataChangeNotifications(quint64 dataChangeNotifications)
+{
+    data->dataChangeNotifications = dataChangeNotifications;
+}
+
+/*!
+    Returns the number of event notifications received since the subscription has been created.
+*/
+quint64 QOpcUaSubscriptionStatistics::eventNotifications() const
+{
+    return data->eventNotifications;
+}
+
+/*!
+    Sets the number of event notifications to \a eventNotifications.
+*/
+void QOpcUaSubscriptionStatistics::setEventNotifications(quint64 eventNotifications)
+{
+    data->eventNotifications = eventNotifications;
+}
+
+/*!
+    Returns the number of gaps in the sequence numbers of the notification messages of the subscription.
+
+    Sequence numbers are only tracked if the backend has been created with the
+    \c recoverMissingNotifications backend property, see \l QOpcUaProvider::createClient().
+    A gap may consist of several missing messages.
+
+    \sa republishedMessages() unrecoverableMessages()
+*/
+quint64 QOpcUaSubscriptionStatistics::sequenceGaps() const
+{
+    return data->sequenceGaps;
+}
+
+/*!
+    Sets the number of sequence number gaps to \a sequenceGaps.
+*/
+void QOpcUaSubscriptionStatistics::setSequenceGaps(quint64 sequenceGaps)
+{
+    data->sequenceGaps = sequenceGaps;
+}
+
+/*!
+    Returns the number of missing notification messages which have been recovered
+    from the retransmission queue of the server with the Republish service.
+*/
+quint64 QOpcUaSubscriptionStatistics::republishedMessages() const
+{
+    return data->republishedMessages;
+}
+
+/*!
+    Sets the number of republished messages to \a republishedMessages.
+*/
+void QOpcUaSubscriptionStatistics::setRepublishedMessages(quint64 republishedMessages)
+{
+    data->republishedMessages = republishedMessages;
+}
+
+/*!
+    Returns the number of missing notification messages which were no longer available on the server.
+
+    The notifications of these messages are lost. Nodes which depend on them should read
+    their current values.
+*/
+quint64 QOpcUaSubscriptionStatistics::unrecoverableMessages() const
+{
+    return data->unrecoverableMessages;
+}
+
+/*!
+    Sets the number of unrecoverable messages to \a unrecoverableMessages.
+*/
+void QOpcUaSubscriptionStatistics::setUnrecoverableMessages(quint64 unrecoverableMessages)
+{
+    data->unrecoverableMessages = unrecoverableMessages;
+}
+
+QT_END_NAMESPACE
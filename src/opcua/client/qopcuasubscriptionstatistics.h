@@ -0,0 +1,58 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUASUBSCRIPTIONSTATISTICS_H
+#define QOPCUASUBSCRIPTIONSTATISTICS_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qlist.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaSubscriptionStatisticsData;
+class Q_OPCUA_EXPORT QOpcUaSubscriptionStatistics
+{
+public:
+    QOpcUaSubscriptionStatistics();
+    QOpcUaSubscriptionStatistics(const QOpcUaSubscriptionStatistics &other);
+    QOpcUaSubscriptionStatistics &operator=(const QOpcUaSubscriptionStatistics &rhs);
+    ~QOpcUaSubscriptionStatistics();
+
+    quint32 subscriptionId() const;
+    void setSubscriptionId(quint32 subscriptionId);
+
+    double publishingInterval() const;
+    void setPublishingInterval(double publishingInterval);
+
+    quint32 monitoredItemCount() const;
+    void setMonitoredItemCount(quint32 monitoredItemCount);
+
+    double expectedNotificationsPerPublish() const;
+    void setExpectedNotificationsPerPublish(double expectedNotifications);
+
+    quint64 dataChangeNotifications() const;
+    void setDataChangeNotifications(quint64 dataChangeNotifications);
+
+    quint64 eventNotifications() const;
+    void setEventNotifications(quint64 eventNotifications);
+
+    quint64 sequenceGaps() const;
+    void setSequenceGaps(quint64 sequenceGaps);
+
+    quint64 republishedMessages() const;
+    void setRepublishedMessages(quint64 republishedMessages);
+
+    quint64 unrecoverableMessages() const;
+    void setUnrecoverableMessages(quint64 unrecoverableMessages);
+
+private:
+    QSharedDataPointer<QOpcUaSubscriptionStatisticsData> data;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaSubscriptionStatistics)
+
+#endif // QOPCUASUBSCRIPTIONSTATISTICS_H
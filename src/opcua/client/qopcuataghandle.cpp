@@ -0,0 +1,68 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuataghandle.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaTagHandle
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class identifies a node which is accessed without a \l QOpcUaNode object.
+
+    A \l QOpcUaNode is a QObject with its own signals and an attribute cache. Applications
+    which access a large number of variables, for example a data logger for 100000 tags,
+    spend a lot of memory and setup time on these objects.
+
+    A tag handle is a plain value which identifies a node id registered with
+    \l QOpcUaClient::createTags(). It is used to read, write and monitor the node with the
+    tag functions of \l QOpcUaClient. The results are passed to the \l QOpcUaTagSink of the client
+    instead of being emitted by a node object. The client stores only the node id and a
+    few bytes of state per tag.
+
+    A handle stays valid until the tag is released with \l QOpcUaClient::releaseTags().
+    Results for a released tag are discarded. The storage of a released tag is reused for
+    new tags, but each reuse gets a new generation number which is part of the handle.
+    A handle of a released tag is therefore not returned again by the same client.
+
+    \sa QOpcUaTagSink QOpcUaClient::createTags()
+*/
+
+/*!
+    \fn QOpcUaTagHandle::QOpcUaTagHandle()
+
+    Constructs an invalid tag handle.
+*/
+
+/*!
+    \fn bool QOpcUaTagHandle::isValid() const
+
+    Returns \c true if this handle has been returned by \l QOpcUaClient::createTags().
+*/
+
+/*!
+    \fn quint64 QOpcUaTagHandle::id() const
+
+    Returns the numeric id of this handle. The id is unique for the client which created the tag.
+*/
+
+/*!
+    \fn bool QOpcUaTagHandle::operator==(QOpcUaTagHandle lhs, QOpcUaTagHandle rhs)
+
+    Returns \c true if \a lhs and \a rhs refer to the same tag.
+*/
+
+/*!
+    \fn bool QOpcUaTagHandle::operator!=(QOpcUaTagHandle lhs, QOpcUaTagHandle rhs)
+
+    Returns \c true if \a lhs and \a rhs refer to different tags.
+*/
+
+/*!
+    \fn size_t QOpcUaTagHandle::qHash(QOpcUaTagHandle key, size_t seed)
+
+    Returns the hash value for \a key, using \a seed to seed the calculation.
+*/
+
+QT_END_NAMESPACE
@@ -0,0 +1,41 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUATAGHANDLE_H
+#define QOPCUATAGHANDLE_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+
+#include <QtCore/qhashfunctions.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaClientImpl;
+
+class QOpcUaTagHandle
+{
+public:
+    constexpr QOpcUaTagHandle() noexcept = default;
+
+    constexpr bool isValid() const noexcept { return m_id != 0; }
+    constexpr quint64 id() const noexcept { return m_id; }
+
+    friend constexpr bool operator==(QOpcUaTagHandle lhs, QOpcUaTagHandle rhs) noexcept
+    { return lhs.m_id == rhs.m_id; }
+    friend constexpr bool operator!=(QOpcUaTagHandle lhs, QOpcUaTagHandle rhs) noexcept
+    { return lhs.m_id != rhs.m_id; }
+    friend size_t qHash(QOpcUaTagHandle key, size_t seed = 0) noexcept
+    { return qHash(key.m_id, seed); }
+
+private:
+    friend class QOpcUaClientImpl;
+    constexpr explicit QOpcUaTagHandle(quint64 id) noexcept : m_id(id) {}
+
+    quint64 m_id = 0;
+};
+
+Q_DECLARE_TYPEINFO(QOpcUaTagHandle, Q_PRIMITIVE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATAGHANDLE_H
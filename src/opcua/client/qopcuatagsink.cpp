@@ -0,0 +1,129 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuatagsink.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaTagSink
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class receives the results of the tag functions of QOpcUaClient.
+
+    The results of reading, writing and monitoring nodes with \l QOpcUaTagHandle are not emitted
+    as signals but passed to a single sink per client which is set with \l QOpcUaClient::setTagSink().
+    The functions are called in the thread of the client.
+
+    The sink is not owned by the client. It must not be destroyed before it has been replaced
+    with \l QOpcUaClient::setTagSink() or the client has been destroyed.
+
+    Subclasses reimplement the functions for the results they are interested in, the default
+    implementations do nothing.
+
+    Data change notifications are passed to \l tagDataChanged(). If the \c typedDataChanges
+    or \c notificationRingCapacity backend properties are set, notifications with a scalar numeric,
+    Boolean, DateTime or StatusCode value are passed to \l tagScalarDataChanged() instead.
+    If the \c batchDataChanges backend property is set, data changes of tags are emitted
+    in \l QOpcUaClient::dataChangesReceived() like the data changes of nodes.
+
+    \sa QOpcUaTagHandle QOpcUaClient::setTagSink()
+*/
+
+/*!
+    Destroys the sink.
+*/
+QOpcUaTagSink::~QOpcUaTagSink()
+{
+}
+
+/*!
+    This function is called when reading the attributes of \a tag has finished.
+    \a results contains one entry per requested attribute, \a serviceResult is the status code of the read service.
+
+    \sa QOpcUaClient::readTags()
+*/
+void QOpcUaTagSink::tagAttributesRead(QOpcUaTagHandle tag, const QList<QOpcUaReadResult> &results,
+                                      QOpcUa::UaStatusCode serviceResult)
+{
+    Q_UNUSED(tag);
+    Q_UNUSED(results);
+    Q_UNUSED(serviceResult);
+}
+
+/*!
+    This function is called when writing \a attribute of \a tag has finished with \a statusCode.
+
+    \sa QOpcUaClient::writeTag()
+*/
+void QOpcUaTagSink::tagAttributeWritten(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute,
+                                        QOpcUa::UaStatusCode statusCode)
+{
+    Q_UNUSED(tag);
+    Q_UNUSED(attribute);
+    Q_UNUSED(statusCode);
+}
+
+/*!
+    This function is called when monitoring of \a attribute of \a tag has been enabled or disabled.
+    \a enabled is \c true if monitoring has been enabled. The status code and the revised
+    parameters are part of \a status.
+
+    \sa QOpcUaClient::enableTagMonitoring() QOpcUaClient::disableTagMonitoring()
+*/
+void QOpcUaTagSink::tagMonitoringChanged(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute, bool enabled,
+                                         const QOpcUaMonitoringParameters &status)
+{
+    Q_UNUSED(tag);
+    Q_UNUSED(attribute);
+    Q_UNUSED(enabled);
+    Q_UNUSED(status);
+}
+
+/*!
+    This function is called when the parameters in \a items of the monitored item for \a attribute of \a tag
+    have been modified. The status code and the revised parameters are part of \a status.
+
+    \sa QOpcUaClient::modifyTagMonitoring() QOpcUaClient::setTagMonitoringMode()
+*/
+void QOpcUaTagSink::tagMonitoringStatusChanged(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute,
+                                               QOpcUaMonitoringParameters::Parameters items,
+                                               const QOpcUaMonitoringParameters &status)
+{
+    Q_UNUSED(tag);
+    Q_UNUSED(attribute);
+    Q_UNUSED(items);
+    Q_UNUSED(status);
+}
+
+/*!
+    This function is called for a data change notification of a monitored attribute of \a tag.
+    The attribute, the value and the timestamps are part of \a value.
+*/
+void QOpcUaTagSink::tagDataChanged(QOpcUaTagHandle tag, const QOpcUaReadResult &value)
+{
+    Q_UNUSED(tag);
+    Q_UNUSED(value);
+}
+
+/*!
+    This function is called for a data change notification with a scalar value of a
+    monitored attribute of \a tag which has been delivered as \a change without a QVariant.
+
+    The default implementation converts \a change and calls \l tagDataChanged().
+*/
+void QOpcUaTagSink::tagScalarDataChanged(QOpcUaTagHandle tag, const QOpcUaScalarDataChange &change)
+{
+    tagDataChanged(tag, change.toReadResult());
+}
+
+/*!
+    This function is called for an event of \a tag with the values of the select clauses in \a eventFields.
+*/
+void QOpcUaTagSink::tagEventOccurred(QOpcUaTagHandle tag, const QVariantList &eventFields)
+{
+    Q_UNUSED(tag);
+    Q_UNUSED(eventFields);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,40 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUATAGSINK_H
+#define QOPCUATAGSINK_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuascalardatachange.h>
+#include <QtOpcUa/qopcuataghandle.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qlist.h>
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaTagSink
+{
+public:
+    virtual ~QOpcUaTagSink();
+
+    virtual void tagAttributesRead(QOpcUaTagHandle tag, const QList<QOpcUaReadResult> &results,
+                                   QOpcUa::UaStatusCode serviceResult);
+    virtual void tagAttributeWritten(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute,
+                                     QOpcUa::UaStatusCode statusCode);
+    virtual void tagMonitoringChanged(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute, bool enabled,
+                                      const QOpcUaMonitoringParameters &status);
+    virtual void tagMonitoringStatusChanged(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute,
+                                            QOpcUaMonitoringParameters::Parameters items,
+                                            const QOpcUaMonitoringParameters &status);
+    virtual void tagDataChanged(QOpcUaTagHandle tag, const QOpcUaReadResult &value);
+    virtual void tagScalarDataChanged(QOpcUaTagHandle tag, const QOpcUaScalarDataChange &change);
+    virtual void tagEventOccurred(QOpcUaTagHandle tag, const QVariantList &eventFields);
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATAGSINK_H
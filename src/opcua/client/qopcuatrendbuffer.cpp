@@ -0,0 +1,338 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuatrendbuffer_p.h"
+
+#include <QtCore/qnumeric.h>
+
+#include <algorithm>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaTrendBuffer
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class keeps the most recent numeric values of a monitored attribute for trending.
+
+    Trend displays need the values of a monitored item for a time window. Instead of accumulating
+    data change notifications in the application or reading the history from the server, the
+    backend can write the values to a trend buffer while it processes the publish responses.
+
+    A trend buffer is created with \l QOpcUaNode::setTrendBufferDepth() and returned by
+    \l QOpcUaNode::trendBuffer(). It holds up to \l depth() samples, the oldest sample is
+    overwritten when the buffer is full. The memory used by all trend buffers of a client
+    can be limited with the \c trendBufferMemoryBudget backend property, see \l QOpcUaProvider::createClient().
+
+    Each sample stores the value converted to \c double, the status code and the source timestamp.
+    If the server didn't send a source timestamp, the server timestamp is used.
+    Timestamps are in the OPC UA DateTime encoding like in \l QOpcUaScalarDataChange.
+    Values which are not numeric are stored as NaN.
+
+    \l statistics() for all samples in the buffer is updated with each sample and doesn't need to
+    iterate the buffer. Samples with a bad status code or a NaN value are not included in the statistics.
+
+    All functions are thread-safe, the buffer is written by the backend thread and can be read
+    from any thread.
+
+    \sa QOpcUaNode::setTrendBufferDepth() QOpcUaNode::trendBuffer()
+*/
+
+/*!
+    \class QOpcUaTrendBuffer::Sample
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief A single value of a trend buffer.
+
+    \variable QOpcUaTrendBuffer::Sample::timestamp
+    \brief The source timestamp of the value, or the server timestamp if there is no source timestamp.
+
+    \variable QOpcUaTrendBuffer::Sample::value
+    \brief The value converted to \c double.
+
+    \variable QOpcUaTrendBuffer::Sample::statusCode
+    \brief The status code of the value.
+*/
+
+/*!
+    \class QOpcUaTrendBuffer::Statistics
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief The minimum, maximum and average of the samples in a window of a trend buffer.
+
+    \variable QOpcUaTrendBuffer::Statistics::count
+    \brief The number of samples which are included in the statistics.
+
+    \variable QOpcUaTrendBuffer::Statistics::minimum
+    \brief The smallest value, 0 if \c count is 0.
+
+    \variable QOpcUaTrendBuffer::Statistics::maximum
+    \brief The largest value, 0 if \c count is 0.
+
+    \variable QOpcUaTrendBuffer::Statistics::average
+    \brief The arithmetic mean of the values, 0 if \c count is 0.
+*/
+
+static bool isStatisticsSample(const QOpcUaTrendBuffer::Sample &sample)
+{
+    return !(static_cast<quint32>(sample.statusCode) & 0x80000000) && !qIsNaN(sample.value);
+}
+
+QOpcUaTrendBufferPrivate::QOpcUaTrendBufferPrivate(qsizetype depth)
+    : m_depth(qMax<qsizetype>(1, depth))
+    , m_samples(new Sample[m_depth])
+{
+    m_minimum.positions.reset(new quint64[m_depth]);
+    m_maximum.positions.reset(new quint64[m_depth]);
+}
+
+QOpcUaTrendBufferPrivate::~QOpcUaTrendBufferPrivate() = default;
+
+QSharedPointer<QOpcUaTrendBuffer> QOpcUaTrendBufferPrivate::create(qsizetype depth)
+{
+    return QSharedPointer<QOpcUaTrendBuffer>(new QOpcUaTrendBuffer(depth));
+}
+
+/*!
+    \internal
+*/
+QOpcUaTrendBuffer::QOpcUaTrendBuffer(qsizetype depth)
+    : d_ptr(new QOpcUaTrendBufferPrivate(depth))
+{
+}
+
+/*!
+    Destroys the trend buffer.
+*/
+QOpcUaTrendBuffer::~QOpcUaTrendBuffer() = default;
+
+/*!
+    Returns the number of bytes used by a trend buffer with \a depth samples.
+
+    The result saturates at the largest value of \c qsizetype for depths which can't be allocated.
+*/
+qsizetype QOpcUaTrendBuffer::memoryUsage(qsizetype depth)
+{
+    constexpr qsizetype fixedSize = sizeof(QOpcUaTrendBuffer) + sizeof(QOpcUaTrendBufferPrivate);
+    constexpr qsizetype sampleSize = sizeof(Sample) + 2 * sizeof(quint64);
+
+    depth = qMax<qsizetype>(1, depth);
+    if (depth > ((std::numeric_limits<qsizetype>::max)() - fixedSize) / sampleSize)
+        return (std::numeric_limits<qsizetype>::max)();
+
+    return fixedSize + depth * sampleSize;
+}
+
+/*!
+    Returns the maximum number of samples in the buffer.
+*/
+qsizetype QOpcUaTrendBuffer::depth() const
+{
+    Q_D(const QOpcUaTrendBuffer);
+    return d->m_depth;
+}
+
+/*!
+    Returns the number of samples in the buffer.
+*/
+qsizetype QOpcUaTrendBuffer::size() const
+{
+    Q_D(const QOpcUaTrendBuffer);
+    QMutexLocker locker(&d->m_mutex);
+    return d->m_size;
+}
+
+/*!
+    Returns the number of samples which have been appended to the buffer since it has been created
+    or cleared, including the samples which have been overwritten.
+*/
+quint64 QOpcUaTrendBuffer::totalCount() const
+{
+    Q_D(const QOpcUaTrendBuffer);
+    QMutexLocker locker(&d->m_mutex);
+    return d->m_totalCount;
+}
+
+/*!
+    Returns the newest \a count samples, the oldest sample comes first.
+*/
+QList<QOpcUaTrendBuffer::Sample> QOpcUaTrendBuffer::last(qsizetype count) const
+{
+    Q_D(const QOpcUaTrendBuffer);
+    QMutexLocker locker(&d->m_mutex);
+    return d->copyLast(std::clamp<qsizetype>(count, 0, d->m_size));
+}
+
+/*!
+    Returns the newest samples with a timestamp not older than \a timestamp, the oldest sample comes first.
+
+    The samples are kept in the order in which they have been received. The window starts after the
+    newest sample which is older than \a timestamp.
+*/
+QList<QOpcUaTrendBuffer::Sample> QOpcUaTrendBuffer::since(qint64 timestamp) const
+{
+    Q_D(const QOpcUaTrendBuffer);
+    QMutexLocker locker(&d->m_mutex);
+    return d->copyLast(d->windowStart(timestamp));
+}
+
+/*!
+    Returns the statistics of all samples in the buffer.
+
+    The statistics are updated incrementally when a sample is appended,
+    this function doesn't iterate the buffer.
+*/
+QOpcUaTrendBuffer::Statistics QOpcUaTrendBuffer::statistics() const
+{
+    Q_D(const QOpcUaTrendBuffer);
+    QMutexLocker locker(&d->m_mutex);
+    return d->bufferStatistics();
+}
+
+/*!
+    Returns the statistics of the samples returned by \l since() for \a since.
+*/
+QOpcUaTrendBuffer::Statistics QOpcUaTrendBuffer::statistics(qint64 since) const
+{
+    Q_D(const QOpcUaTrendBuffer);
+    QMutexLocker locker(&d->m_mutex);
+
+    const qsizetype count = d->windowStart(since);
+    if (count == d->m_size)
+        return d->bufferStatistics();
+
+    Statistics result;
+    double sum = 0;
+    for (quint64 position = d->m_totalCount - count; position < d->m_totalCount; ++position) {
+        const Sample &sample = d->sampleAt(position);
+        if (!isStatisticsSample(sample))
+            continue;
+
+        if (!result.count++) {
+            result.minimum = result.maximum = sample.value;
+        } else {
+            result.minimum = qMin(result.minimum, sample.value);
+            result.maximum = qMax(result.maximum, sample.value);
+        }
+        sum += sample.value;
+    }
+
+    if (result.count)
+        result.average = sum / result.count;
+
+    return result;
+}
+
+void QOpcUaTrendBufferPrivate::append(const Sample &sample)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_size == m_depth) {
+        const quint64 oldest = m_totalCount - m_depth;
+        const Sample &removed = sampleAt(oldest);
+        if (isStatisticsSample(removed)) {
+            m_sum -= removed.value;
+            --m_valueCount;
+            evict(m_minimum, oldest);
+            evict(m_maximum, oldest);
+        }
+    } else {
+        ++m_size;
+    }
+
+    const quint64 position = m_totalCount++;
+    m_samples[position % m_depth] = sample;
+
+    if (isStatisticsSample(sample)) {
+        m_sum += sample.value;
+        ++m_valueCount;
+        push(m_minimum, position, true);
+        push(m_maximum, position, false);
+    }
+
+    // Limits the rounding errors accumulated by subtracting the removed values
+    if (m_totalCount % m_depth == 0)
+        recalculateSum();
+}
+
+void QOpcUaTrendBufferPrivate::clear()
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_size = 0;
+    m_totalCount = 0;
+    m_sum = 0;
+    m_valueCount = 0;
+    m_minimum.head = m_minimum.count = 0;
+    m_maximum.head = m_maximum.count = 0;
+}
+
+QList<QOpcUaTrendBuffer::Sample> QOpcUaTrendBufferPrivate::copyLast(qsizetype count) const
+{
+    QList<Sample> result;
+    result.reserve(count);
+    for (quint64 position = m_totalCount - count; position < m_totalCount; ++position)
+        result.push_back(sampleAt(position));
+
+    return result;
+}
+
+QOpcUaTrendBuffer::Statistics QOpcUaTrendBufferPrivate::bufferStatistics() const
+{
+    Statistics result;
+    if (!m_valueCount)
+        return result;
+
+    result.count = m_valueCount;
+    result.minimum = sampleAt(m_minimum.positions[m_minimum.head]).value;
+    result.maximum = sampleAt(m_maximum.positions[m_maximum.head]).value;
+    result.average = m_sum / m_valueCount;
+
+    return result;
+}
+
+qsizetype QOpcUaTrendBufferPrivate::windowStart(qint64 since) const
+{
+    qsizetype count = 0;
+    while (count < m_size && sampleAt(m_totalCount - count - 1).timestamp >= since)
+        ++count;
+
+    return count;
+}
+
+void QOpcUaTrendBufferPrivate::push(MonotonicQueue &queue, quint64 position, bool minimum)
+{
+    const double value = sampleAt(position).value;
+
+    // Values which can never be the minimum or maximum again are removed from the back
+    while (queue.count) {
+        const double back = sampleAt(queue.positions[(queue.head + queue.count - 1) % m_depth]).value;
+        if (minimum ? back < value : back > value)
+            break;
+        --queue.count;
+    }
+
+    queue.positions[(queue.head + queue.count) % m_depth] = position;
+    ++queue.count;
+}
+
+void QOpcUaTrendBufferPrivate::evict(MonotonicQueue &queue, quint64 position)
+{
+    if (queue.count && queue.positions[queue.head] == position) {
+        queue.head = (queue.head + 1) % m_depth;
+        --queue.count;
+    }
+}
+
+void QOpcUaTrendBufferPrivate::recalculateSum()
+{
+    m_sum = 0;
+    for (quint64 position = m_totalCount - m_size; position < m_totalCount; ++position) {
+        const Sample &sample = sampleAt(position);
+        if (isStatisticsSample(sample))
+            m_sum += sample.value;
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,60 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUATRENDBUFFER_H
+#define QOPCUATRENDBUFFER_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qlist.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaTrendBufferPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaTrendBuffer
+{
+    Q_DECLARE_PRIVATE(QOpcUaTrendBuffer)
+public:
+    struct Sample {
+        qint64 timestamp = 0;
+        double value = 0;
+        QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+    };
+
+    struct Statistics {
+        qsizetype count = 0;
+        double minimum = 0;
+        double maximum = 0;
+        double average = 0;
+    };
+
+    ~QOpcUaTrendBuffer();
+
+    static qsizetype memoryUsage(qsizetype depth);
+
+    qsizetype depth() const;
+    qsizetype size() const;
+    quint64 totalCount() const;
+
+    QList<Sample> last(qsizetype count) const;
+    QList<Sample> since(qint64 timestamp) const;
+
+    Statistics statistics() const;
+    Statistics statistics(qint64 since) const;
+
+private:
+    Q_DISABLE_COPY_MOVE(QOpcUaTrendBuffer)
+    friend class QOpcUaTrendBufferPrivate;
+
+    explicit QOpcUaTrendBuffer(qsizetype depth);
+
+    std::unique_ptr<QOpcUaTrendBufferPrivate> d_ptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATRENDBUFFER_H
@@ -0,0 +1,73 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUATRENDBUFFER_P_H
+#define QOPCUATRENDBUFFER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuatrendbuffer.h>
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qsharedpointer.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaTrendBufferPrivate
+{
+public:
+    using Sample = QOpcUaTrendBuffer::Sample;
+    using Statistics = QOpcUaTrendBuffer::Statistics;
+
+    explicit QOpcUaTrendBufferPrivate(qsizetype depth);
+    ~QOpcUaTrendBufferPrivate();
+
+    static QSharedPointer<QOpcUaTrendBuffer> create(qsizetype depth);
+    static QOpcUaTrendBufferPrivate *get(QOpcUaTrendBuffer *buffer) { return buffer->d_func(); }
+
+    // Only called by the backend which owns the buffer, the oldest sample is overwritten if the buffer is full
+    void append(const Sample &sample);
+    void clear();
+
+    // Positions of samples with increasing (minimum) or decreasing (maximum) values
+    struct MonotonicQueue {
+        std::unique_ptr<quint64[]> positions;
+        qsizetype head = 0;
+        qsizetype count = 0;
+    };
+
+    const Sample &sampleAt(quint64 position) const { return m_samples[position % m_depth]; }
+    QList<Sample> copyLast(qsizetype count) const;
+    Statistics bufferStatistics() const;
+    qsizetype windowStart(qint64 since) const;
+    void push(MonotonicQueue &queue, quint64 position, bool minimum);
+    void evict(MonotonicQueue &queue, quint64 position);
+    void recalculateSum();
+
+    const qsizetype m_depth;
+    mutable QMutex m_mutex;
+    std::unique_ptr<Sample[]> m_samples;
+    qsizetype m_size = 0;
+    quint64 m_totalCount = 0;
+
+    // Incrementally updated statistics of all samples in the buffer
+    double m_sum = 0;
+    qsizetype m_valueCount = 0;
+    MonotonicQueue m_minimum;
+    MonotonicQueue m_maximum;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATRENDBUFFER_P_H
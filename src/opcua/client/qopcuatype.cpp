@@ -2,13 +2,20 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qopcuatype.h"
+#include "qopcuanodeid_p.h"
+#include "qopcuastatuscodetable_p.h"
+
+#ifndef QT_OPCUA_NO_NS0IDNAMES
+#include "qopcuanodeidtable_p.h"
+#endif
 
-#include <QMetaEnum>
-#include <QRegularExpression>
 #include <QUuid>
 #include <QString>
 #include <QList>
 
+#include <algorithm>
+#include <iterator>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -732,35 +739,12 @@ QString QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId referenceType)
 */
 bool QOpcUa::nodeIdStringSplit(const QString &nodeIdString, quint16 *nsIndex, QString *identifier, char *identifierType)
 {
-    quint16 namespaceIndex = 0;
-
-    QStringList components = nodeIdString.split(QLatin1String(";"));
-
-    if (components.size() > 2)
-        return false;
-
-    static const QRegularExpression namespaceRegex(QLatin1String("^ns=[0-9]+"));
-    if (components.size() == 2 && components.at(0).contains(namespaceRegex)) {
-        bool success = false;
-        uint ns = QStringView(components.at(0)).mid(3).toUInt(&success);
-        if (!success || ns > (std::numeric_limits<quint16>::max)())
-            return false;
-        namespaceIndex = ns;
-    }
-
-    if (components.last().size() < 3)
-        return false;
-
-    static const QRegularExpression identifierRegex(QLatin1String("^[isgb]="));
-    if (!components.last().contains(identifierRegex))
+    QStringView identifierView;
+    if (!qt_opcuaSplitNodeIdString(nodeIdString, nsIndex, &identifierView, identifierType))
         return false;
 
-    if (nsIndex)
-        *nsIndex = namespaceIndex;
     if (identifier)
-        *identifier = QStringView(components.last()).mid(2).toString();
-    if (identifierType)
-        *identifierType = components.last().at(0).toLatin1();
+        *identifier = identifierView.toString();
 
     return true;
 }
@@ -789,6 +773,17 @@ QString QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0 id)
     return QStringLiteral("ns=0;i=%1").arg(quint32(id));
 }
 
+#ifndef QT_OPCUA_NO_NS0IDNAMES
+// Returns the index of id in QOpcUaNodeIdTable or -1 if it is unknown
+static qsizetype namespace0TableIndex(quint32 id)
+{
+    using namespace QOpcUaNodeIdTable;
+
+    const auto it = std::lower_bound(std::begin(ids), std::end(ids), id);
+    return it != std::end(ids) && *it == id ? it - std::begin(ids) : -1;
+}
+#endif
+
 /*!
     Returns the enum value from \l QOpcUa::NodeIds::Namespace0 for \a nodeId.
 
@@ -816,7 +811,7 @@ QOpcUa::NodeIds::Namespace0 QOpcUa::namespace0IdFromNodeId(const QString &nodeId
         return QOpcUa::NodeIds::Namespace0::Unknown;
 
 #ifndef QT_OPCUA_NO_NS0IDNAMES
-    if (!QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>().valueToKey(identifier))
+    if (namespace0TableIndex(identifier) < 0)
         return QOpcUa::NodeIds::Namespace0::Unknown;
 #endif
 
@@ -837,7 +832,42 @@ QString QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0 id)
 #else
     if (id == QOpcUa::NodeIds::Namespace0::Unknown)
         return QString();
-    return QString::fromUtf8(QMetaEnum::fromType<QOpcUa::NodeIds::Namespace0>().valueToKey(quint32(id)));
+    const qsizetype index = namespace0TableIndex(quint32(id));
+    return index >= 0 ? QString::fromLatin1(QOpcUaNodeIdTable::name(index)) : QString();
+#endif
+}
+
+/*!
+    \since 6.9
+
+    Returns the enum value from \l QOpcUa::NodeIds::Namespace0 for the node id name \a name.
+    This is the reverse operation of \l namespace0IdName().
+
+    The names are taken from the OPC Foundation's NodeIds.csv file. For nodes which are
+    direct children of the Objects folder or which are types, the name is the browse name
+    of the node. The names of other nodes are the browse path from the parent type
+    or object with '_' as separator, for example \c Server_ServerStatus_State.
+
+    If \a name is unknown or Qt OPC UA has been configured with -no-feature-ns0idnames,
+    \l {QOpcUa::NodeIds::Namespace0} {Unknown} is returned.
+*/
+QOpcUa::NodeIds::Namespace0 QOpcUa::namespace0IdFromName(const QString &name)
+{
+#ifdef QT_OPCUA_NO_NS0IDNAMES
+    Q_UNUSED(name);
+    return QOpcUa::NodeIds::Namespace0::Unknown;
+#else
+    using namespace QOpcUaNodeIdTable;
+
+    const auto it = std::lower_bound(std::begin(entriesByName), std::end(entriesByName), name,
+                                     [](quint16 index, const QString &key) {
+        return QLatin1StringView(QOpcUaNodeIdTable::name(index)) < key;
+    });
+
+    if (it == std::end(entriesByName) || QLatin1StringView(QOpcUaNodeIdTable::name(*it)) != name)
+        return QOpcUa::NodeIds::Namespace0::Unknown;
+
+    return QOpcUa::NodeIds::Namespace0(ids[*it]);
 #endif
 }
 
@@ -858,10 +888,12 @@ QString QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0 id)
 */
 QString QOpcUa::statusToString(QOpcUa::UaStatusCode statusCode)
 {
-    const auto enumerator = QMetaEnum::fromType<QOpcUa::UaStatusCode>();
-    const auto key = enumerator.valueToKey(statusCode);
-    if (key)
-        return QString::fromLatin1(key);
+    using namespace QOpcUaStatusCodeTable;
+
+    const auto it = std::lower_bound(std::begin(codes), std::end(codes), quint32(statusCode));
+
+    if (it != std::end(codes) && *it == quint32(statusCode))
+        return QString::fromLatin1(QOpcUaStatusCodeTable::name(it - std::begin(codes)));
     else
         return QLatin1String("Invalid enum value for UaStatusCode");
 }
@@ -554,6 +554,7 @@ Q_OPCUA_EXPORT bool nodeIdEquals(const QString &first, const QString &second);
 Q_OPCUA_EXPORT QString namespace0Id(QOpcUa::NodeIds::Namespace0 id);
 Q_OPCUA_EXPORT QOpcUa::NodeIds::Namespace0 namespace0IdFromNodeId(const QString &nodeId);
 Q_OPCUA_EXPORT QString namespace0IdName(QOpcUa::NodeIds::Namespace0 id);
+Q_OPCUA_EXPORT QOpcUa::NodeIds::Namespace0 namespace0IdFromName(const QString &name);
 
 typedef QPair<QVariant, QOpcUa::Types> TypedVariant;
 
@@ -0,0 +1,278 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopcuavaluetable_p.h"
+
+#include <QtCore/qthread.h>
+#include <QtCore/qyieldcpu.h>
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaValueTable
+    \inmodule QtOpcUa
+    \since 6.9
+    \brief This class holds the latest value of a fixed number of monitored items and can be read from any thread.
+
+    Many consumers of data changes only need the latest value of each monitored item, for example
+    a render loop of a user interface or an exporter which samples all values periodically.
+    Instead of receiving every data change notification, such consumers can read the values
+    from a value table.
+
+    A value table is created for a client if the \c valueTableSize backend property is set, see
+    \l QOpcUaProvider::createClient(). It is returned by \l QOpcUaClient::valueTable().
+    A monitored attribute is assigned to a slot of the table with \l QOpcUaNode::setValueTableSlot().
+    Each data change notification for this attribute then overwrites the value in the slot.
+
+    The table has a fixed size and is written by a single thread. Each slot is protected by a
+    sequence counter, a reader retries if the slot has been modified while it was copied.
+    This allows any number of threads to read consistent values without locks, signals or
+    memory allocations.
+
+    Only values which fit into a \l QOpcUaScalarDataChange are stored in the table.
+    For other values, the slot contains the status code and the timestamps without a value.
+
+    \sa QOpcUaClient::valueTable() QOpcUaNode::setValueTableSlot()
+*/
+
+namespace {
+
+// Trivially copyable representation of a QOpcUaScalarDataChange
+struct StoredValue {
+    quint64 bits;
+    qint64 sourceTimestamp;
+    qint64 serverTimestamp;
+    quint32 statusCode;
+    qint32 valueType;
+    qint32 attribute;
+};
+
+static_assert(std::is_trivially_copyable_v<StoredValue>);
+
+constexpr size_t valueWordCount = (sizeof(StoredValue) + sizeof(quint64) - 1) / sizeof(quint64);
+
+StoredValue toStoredValue(const QOpcUaScalarDataChange &value)
+{
+    StoredValue result {};
+    switch (value.valueType()) {
+    case QOpcUa::Types::Float:
+    case QOpcUa::Types::Double: {
+        const double d = value.toDouble();
+        std::memcpy(&result.bits, &d, sizeof(d));
+        break;
+    }
+    case QOpcUa::Types::SByte:
+    case QOpcUa::Types::Int16:
+    case QOpcUa::Types::Int32:
+    case QOpcUa::Types::Int64:
+    case QOpcUa::Types::DateTime:
+        result.bits = static_cast<quint64>(value.toLongLong());
+        break;
+    default:
+        result.bits = value.toULongLong();
+        break;
+    }
+    result.sourceTimestamp = value.sourceTimestamp();
+    result.serverTimestamp = value.serverTimestamp();
+    result.statusCode = static_cast<quint32>(value.statusCode());
+    result.valueType = static_cast<qint32>(value.valueType());
+    result.attribute = static_cast<qint32>(value.attribute());
+    return result;
+}
+
+void fromStoredValue(const StoredValue &stored, QOpcUaScalarDataChange *value)
+{
+    const auto type = static_cast<QOpcUa::Types>(stored.valueType);
+    switch (type) {
+    case QOpcUa::Types::Undefined:
+        value->clearValue();
+        break;
+    case QOpcUa::Types::Boolean:
+        value->setBoolean(stored.bits != 0);
+        break;
+    case QOpcUa::Types::Float:
+    case QOpcUa::Types::Double: {
+        double d;
+        std::memcpy(&d, &stored.bits, sizeof(d));
+        value->setFloatingPoint(d, type);
+        break;
+    }
+    case QOpcUa::Types::DateTime:
+        value->setDateTime(static_cast<qint64>(stored.bits));
+        break;
+    case QOpcUa::Types::SByte:
+    case QOpcUa::Types::Int16:
+    case QOpcUa::Types::Int32:
+    case QOpcUa::Types::Int64:
+        value->setSignedInteger(static_cast<qint64>(stored.bits), type);
+        break;
+    default:
+        value->setUnsignedInteger(stored.bits, type);
+        break;
+    }
+    value->setSourceTimestamp(stored.sourceTimestamp);
+    value->setServerTimestamp(stored.serverTimestamp);
+    value->setStatusCode(static_cast<QOpcUa::UaStatusCode>(stored.statusCode));
+    value->setAttribute(static_cast<QOpcUa::NodeAttribute>(stored.attribute));
+}
+
+}
+
+// The value is stored as relaxed atomic words, the sequence counter is odd while the slot is written
+struct alignas(64) QOpcUaValueTablePrivate::Slot {
+    std::atomic<quint64> sequence {0};
+    std::atomic<quint64> words[valueWordCount] {};
+};
+
+QOpcUaValueTablePrivate::QOpcUaValueTablePrivate(qsizetype size)
+    : m_size(qMax<qsizetype>(0, size))
+    , m_slots(new Slot[m_size])
+{
+}
+
+QOpcUaValueTablePrivate::~QOpcUaValueTablePrivate() = default;
+
+std::shared_ptr<QOpcUaValueTable> QOpcUaValueTablePrivate::create(qsizetype size)
+{
+    return std::shared_ptr<QOpcUaValueTable>(new QOpcUaValueTable(size));
+}
+
+/*!
+    \internal
+*/
+QOpcUaValueTable::QOpcUaValueTable(qsizetype size)
+    : d_ptr(new QOpcUaValueTablePrivate(size))
+{
+}
+
+/*!
+    Destroys the value table.
+*/
+QOpcUaValueTable::~QOpcUaValueTable() = default;
+
+/*!
+    Returns the number of slots of this table.
+*/
+qsizetype QOpcUaValueTable::size() const
+{
+    Q_D(const QOpcUaValueTable);
+    return d->m_size;
+}
+
+/*!
+    Returns the number of writes to \a slot.
+
+    Comparing the version with a previously read version is a cheap way to check if a slot
+    has changed. 0 is returned if \a slot has never been written or doesn't exist.
+*/
+quint64 QOpcUaValueTable::version(qsizetype slot) const
+{
+    Q_D(const QOpcUaValueTable);
+    if (slot < 0 || slot >= d->m_size)
+        return 0;
+
+    return d->m_slots[slot].sequence.load(std::memory_order_acquire) / 2;
+}
+
+/*!
+    Copies the value of \a slot into \a value. If \a version is not \c nullptr, the number of
+    writes to the slot which are contained in the value is stored in it.
+
+    Returns \c false if \a slot doesn't exist or has never been written.
+
+    This function can be called from any thread.
+*/
+bool QOpcUaValueTable::read(qsizetype slot, QOpcUaScalarDataChange *value, quint64 *version) const
+{
+    Q_D(const QOpcUaValueTable);
+    if (slot < 0 || slot >= d->m_size || !value)
+        return false;
+
+    // The writer only needs a few instructions for a slot, a reader spins with an increasing
+    // number of pauses before it gives up its time slice to a writer which has been preempted
+    constexpr int maxSpinShift = 6;
+
+    const auto &s = d->m_slots[slot];
+    quint64 words[valueWordCount];
+    quint64 sequence;
+
+    for (int attempt = 0; ; ++attempt) {
+        sequence = s.sequence.load(std::memory_order_acquire);
+        if (!(sequence & 1)) {
+            for (size_t i = 0; i < valueWordCount; ++i)
+                words[i] = s.words[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.sequence.load(std::memory_order_relaxed) == sequence)
+                break;
+        }
+
+        if (attempt < maxSpinShift) {
+            for (int i = 0; i < 1 << attempt; ++i)
+                qYieldCpu();
+        } else {
+            QThread::yieldCurrentThread();
+        }
+    }
+
+    if (!sequence)
+        return false;
+
+    StoredValue stored;
+    std::memcpy(&stored, words, sizeof(StoredValue));
+    fromStoredValue(stored, value);
+    if (version)
+        *version = sequence / 2;
+
+    return true;
+}
+
+/*!
+    Copies the values of the slots starting at \a first into \a values.
+    Slots which have never been written are returned as default constructed \l QOpcUaScalarDataChange.
+
+    Returns the number of copied values, which is less than the size of \a values if the
+    table ends before.
+
+    Each value is consistent on its own, but the values may belong to different publish responses.
+*/
+qsizetype QOpcUaValueTable::read(qsizetype first, QSpan<QOpcUaScalarDataChange> values) const
+{
+    Q_D(const QOpcUaValueTable);
+    if (first < 0 || first >= d->m_size)
+        return 0;
+
+    const qsizetype count = qMin(values.size(), d->m_size - first);
+    for (qsizetype i = 0; i < count; ++i) {
+        if (!read(first + i, &values[i]))
+            values[i] = QOpcUaScalarDataChange();
+    }
+
+    return count;
+}
+
+void QOpcUaValueTablePrivate::write(qsizetype slot, const QOpcUaScalarDataChange &value)
+{
+    if (slot < 0 || slot >= m_size)
+        return;
+
+    Slot &s = m_slots[slot];
+    const StoredValue stored = toStoredValue(value);
+    quint64 words[valueWordCount] = {};
+    std::memcpy(words, &stored, sizeof(StoredValue));
+
+    const quint64 sequence = s.sequence.load(std::memory_order_relaxed);
+    s.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < valueWordCount; ++i)
+        s.words[i].store(words[i], std::memory_order_relaxed);
+
+    s.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,41 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUAVALUETABLE_H
+#define QOPCUAVALUETABLE_H
+
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuascalardatachange.h>
+
+#include <QtCore/qspan.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaValueTablePrivate;
+
+class Q_OPCUA_EXPORT QOpcUaValueTable
+{
+    Q_DECLARE_PRIVATE(QOpcUaValueTable)
+public:
+    ~QOpcUaValueTable();
+
+    qsizetype size() const;
+
+    quint64 version(qsizetype slot) const;
+    bool read(qsizetype slot, QOpcUaScalarDataChange *value, quint64 *version = nullptr) const;
+    qsizetype read(qsizetype first, QSpan<QOpcUaScalarDataChange> values) const;
+
+private:
+    Q_DISABLE_COPY_MOVE(QOpcUaValueTable)
+    friend class QOpcUaValueTablePrivate;
+
+    explicit QOpcUaValueTable(qsizetype size);
+
+    std::unique_ptr<QOpcUaValueTablePrivate> d_ptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAVALUETABLE_H
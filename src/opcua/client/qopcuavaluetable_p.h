@@ -0,0 +1,44 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPCUAVALUETABLE_P_H
+#define QOPCUAVALUETABLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuavaluetable.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaValueTablePrivate
+{
+public:
+    explicit QOpcUaValueTablePrivate(qsizetype size);
+    ~QOpcUaValueTablePrivate();
+
+    static std::shared_ptr<QOpcUaValueTable> create(qsizetype size);
+    static QOpcUaValueTablePrivate *get(QOpcUaValueTable *table) { return table->d_func(); }
+
+    // Wait-free, there must not be more than one writing thread per table
+    void write(qsizetype slot, const QOpcUaScalarDataChange &value);
+
+    struct Slot;
+
+    const qsizetype m_size;
+    std::unique_ptr<Slot[]> m_slots;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAVALUETABLE_P_H
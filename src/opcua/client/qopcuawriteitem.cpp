@@ -22,6 +22,7 @@ class QOpcUaWriteItemData : public QSharedData
 {
 public:
     QString nodeId;
+    QOpcUaNodeId parsedNodeId;
     QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
     QString indexRange;
     QVariant value;
@@ -63,6 +64,23 @@ QOpcUaWriteItem::QOpcUaWriteItem(const QString &nodeId, QOpcUa::NodeAttribute at
     setIndexRange(indexRange);
 }
 
+/*!
+    \since 6.9
+
+    Creates a write item for the attribute \a attribute of the node with the parsed node id \a nodeId.
+    The value \a value of type \a type will be written at position \a indexRange of \a attribute.
+*/
+QOpcUaWriteItem::QOpcUaWriteItem(const QOpcUaNodeId &nodeId, QOpcUa::NodeAttribute attribute,
+                                 const QVariant &value, QOpcUa::Types type, const QString &indexRange)
+    : data(new QOpcUaWriteItemData)
+{
+    setNodeId(nodeId);
+    setAttribute(attribute);
+    setValue(value);
+    setType(type);
+    setIndexRange(indexRange);
+}
+
 /*!
     Sets the values from \a rhs in this write item.
 */
@@ -82,6 +100,8 @@ QOpcUaWriteItem::~QOpcUaWriteItem()
 */
 QString QOpcUaWriteItem::nodeId() const
 {
+    if (data->nodeId.isEmpty() && !data->parsedNodeId.isNull())
+        return data->parsedNodeId.toString();
     return data->nodeId;
 }
 
@@ -91,6 +111,34 @@ QString QOpcUaWriteItem::nodeId() const
 void QOpcUaWriteItem::setNodeId(const QString &nodeId)
 {
     data->nodeId = nodeId;
+    data->parsedNodeId = QOpcUaNodeId();
+}
+
+/*!
+    \since 6.9
+
+    Sets the node id to the already parsed \a nodeId.
+    The backend uses the parsed node id directly instead of parsing a node id string.
+
+    \sa parsedNodeId()
+*/
+void QOpcUaWriteItem::setNodeId(const QOpcUaNodeId &nodeId)
+{
+    data->nodeId.clear();
+    data->parsedNodeId = nodeId;
+}
+
+/*!
+    \since 6.9
+
+    Returns the node id set by \l setNodeId(const QOpcUaNodeId &) or a null node id
+    if the node id has been set as string.
+
+    \sa nodeId()
+*/
+QOpcUaNodeId QOpcUaWriteItem::parsedNodeId() const
+{
+    return data->parsedNodeId;
 }
 
 /*!
@@ -4,6 +4,7 @@
 #ifndef QOPCUAWRITEITEM_H
 #define QOPCUAWRITEITEM_H
 
+#include <QtOpcUa/qopcuanodeid.h>
 #include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/qdatetime.h>
@@ -18,11 +19,15 @@ public:
     QOpcUaWriteItem(const QOpcUaWriteItem &other);
     QOpcUaWriteItem(const QString &nodeId, QOpcUa::NodeAttribute attribute, const QVariant &value,
                     QOpcUa::Types type = QOpcUa::Types::Undefined, const QString &indexRange = QString());
+    QOpcUaWriteItem(const QOpcUaNodeId &nodeId, QOpcUa::NodeAttribute attribute, const QVariant &value,
+                    QOpcUa::Types type = QOpcUa::Types::Undefined, const QString &indexRange = QString());
     QOpcUaWriteItem &operator=(const QOpcUaWriteItem &rhs);
     ~QOpcUaWriteItem();
 
     QString nodeId() const;
     void setNodeId(const QString &nodeId);
+    void setNodeId(const QOpcUaNodeId &nodeId);
+    QOpcUaNodeId parsedNodeId() const;
 
     QOpcUa::NodeAttribute attribute() const;
     void setAttribute(QOpcUa::NodeAttribute attribute);
@@ -26,6 +26,7 @@ class QOpcUaWriteResultData : public QSharedData
 {
 public:
     QString nodeId;
+    QOpcUaNodeId parsedNodeId;
     QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
     QString indexRange;
     QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
@@ -66,6 +67,8 @@ QOpcUaWriteResult::~QOpcUaWriteResult()
 */
 QString QOpcUaWriteResult::nodeId() const
 {
+    if (data->nodeId.isEmpty() && !data->parsedNodeId.isNull())
+        return data->parsedNodeId.toString();
     return data->nodeId;
 }
 
@@ -75,6 +78,34 @@ QString QOpcUaWriteResult::nodeId() const
 void QOpcUaWriteResult::setNodeId(const QString &nodeId)
 {
     data->nodeId = nodeId;
+    data->parsedNodeId = QOpcUaNodeId();
+}
+
+/*!
+    \since 6.9
+
+    Sets the node id to the already parsed \a nodeId.
+    The backend uses the parsed node id directly instead of parsing a node id string.
+
+    \sa parsedNodeId()
+*/
+void QOpcUaWriteResult::setNodeId(const QOpcUaNodeId &nodeId)
+{
+    data->nodeId.clear();
+    data->parsedNodeId = nodeId;
+}
+
+/*!
+    \since 6.9
+
+    Returns the node id set by \l setNodeId(const QOpcUaNodeId &) or a null node id
+    if the node id has been set as string.
+
+    \sa nodeId()
+*/
+QOpcUaNodeId QOpcUaWriteResult::parsedNodeId() const
+{
+    return data->parsedNodeId;
 }
 
 /*!
@@ -4,6 +4,7 @@
 #ifndef QOPCUAWRITERESULT_H
 #define QOPCUAWRITERESULT_H
 
+#include <QtOpcUa/qopcuanodeid.h>
 #include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/qshareddata.h>
@@ -21,6 +22,8 @@ public:
 
     QString nodeId() const;
     void setNodeId(const QString &nodeId);
+    void setNodeId(const QOpcUaNodeId &nodeId);
+    QOpcUaNodeId parsedNodeId() const;
 
     QOpcUa::NodeAttribute attribute() const;
     void setAttribute(QOpcUa::NodeAttribute attribute);
@@ -112,6 +112,11 @@ qt_feature("datatypecodegenerator" PRIVATE
     LABEL "Data type code generator"
     PURPOSE "Build a generator for generating de- and encodable data types from a .bsd file."
 )
+qt_feature("opcua-loopback" PRIVATE
+    LABEL "Loopback backend"
+    PURPOSE "Build a backend which serves generated or recorded values without a server for load testing."
+    AUTODETECT QT_BUILD_TESTS
+)
 qt_feature_definition("gds" "QT_NO_GDS" NEGATE VALUE "1")
 qt_configure_add_summary_section(NAME "Qt Opcua")
 qt_configure_add_summary_entry(ARGS "open62541")
@@ -120,4 +125,5 @@ qt_configure_add_summary_entry(ARGS "internalgenerator")
 qt_configure_add_summary_entry(ARGS "open62541-security") # special case
 qt_configure_add_summary_entry(ARGS "gds")
 qt_configure_add_summary_entry(ARGS "datatypecodegenerator")
+qt_configure_add_summary_entry(ARGS "opcua-loopback")
 qt_configure_end_summary_section() # end of "Qt Opcua" section
@@ -26,6 +26,7 @@
 #include <QtOpcUa/qopcuaenumfield.h>
 #include <QtOpcUa/qopcuastructuredefinition.h>
 #include <QtOpcUa/qopcuastructurefield.h>
+#include <QtOpcUa/qopcuasubscriptionstatistics.h>
 
 #include <QtCore/qcborarray.h>
 #include <private/qfactoryloader_p.h>
@@ -160,6 +161,8 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUaStructureField>();
     qRegisterMetaType<QOpcUaEnumDefinition>();
     qRegisterMetaType<QOpcUaEnumField>();
+    qRegisterMetaType<QOpcUaSubscriptionStatistics>();
+    qRegisterMetaType<QList<QOpcUaSubscriptionStatistics>>();
 }
 
 QOpcUaProvider::~QOpcUaProvider()
@@ -213,6 +216,221 @@ static QOpcUaPlugin *loadPlugin(const QString &key)
         \li Defines the timeout for asynchronous requests to an OPC UA server. If the server doesn't reply to
             a service request before the timeout occurs, the service call fails and the finished signal will
             contain a \c bad status code. The default value is 15000ms.
+    \row
+        \li maxMonitoredItemsPerCall
+        \li open62541
+        \li Monitored items requested for the same subscription are created and deleted in batches.
+            This parameter limits the number of monitored items in a single CreateMonitoredItems or
+            DeleteMonitoredItems request, larger batches are split into multiple requests.
+            The default value is 0 which means no limit. If the server announces a lower
+            MaxMonitoredItemsPerCall operation limit, the server's limit is used.
+    \row
+        \li readServerOperationLimits
+        \li open62541
+        \li If this parameter is true, the MaxNodesPerRead, MaxNodesPerWrite, MaxNodesPerRegisterNodes
+            and MaxMonitoredItemsPerCall operation limits are read from the server after connecting.
+            Requests are held back until the limits have been received.
+            Calls to \l QOpcUaClient::readNodeAttributes(), \l QOpcUaClient::writeNodeAttributes(),
+            \l QOpcUaClient::registerNodes(), \l QOpcUaClient::unregisterNodes() and the reads of
+            \l QOpcUaReadGroup with more nodes than allowed by the server are then split into multiple
+            requests and the results are reassembled in the order of the request. If one of the requests
+            fails, the call finishes with its service result and no results, like an unsplit request.
+            The default value is true.
+    \row
+        \li maxNodesPerRead, maxNodesPerWrite, maxNodesPerRegisterNodes
+        \li open62541
+        \li Client side operation limits which split requests like the corresponding operation limits
+            of the server. The default value is 0 which means no limit. If the server announces a
+            lower limit, the server's limit is used.
+    \row
+        \li maxConcurrentChunks
+        \li open62541
+        \li The maximum number of requests which are in flight at the same time when a call is split
+            according to the server's operation limits.
+            The default value is 4.
+    \row
+        \li maxInFlightRequests
+        \li open62541
+        \li The maximum number of service requests which are waiting for a response from the server.
+            Further requests are queued and sent when responses arrive. Writes and method calls
+            are sent first, browse, browse path resolution and history read requests are sent last.
+            Each chunk of a request split by the operation limits counts as one request.
+            Read group, monitored item and subscription requests are not limited by this window.
+            The queue state is reported by \l QOpcUaClient::requestQueueChanged().
+            The default value is 0 which means no limit.
+    \row
+        \li eventDrivenClientIterate
+        \li open62541
+        \li If set to \c true, the backend watches the socket of the connection and only iterates the client
+            if data has been received or if a timed event like a publish request or a timeout is due.
+            This reduces the latency of service responses and data changes and avoids wakeups of idle clients.
+            In this mode, \c clientIterateIntervalMs is not evaluated.
+            The default value is \c false.
+    \row
+        \li batchDataChanges
+        \li open62541, loopback
+        \li If set to \c true, data change notifications are collected and delivered in a single
+            \l QOpcUaClient::dataChangesReceived() signal per iteration of the backend instead of
+            being dispatched to the \l QOpcUaNode objects.
+            The default value is \c false.
+    \row
+        \li typedDataChanges
+        \li open62541, loopback
+        \li If set to \c true, data change notifications with a scalar numeric, Boolean, DateTime or StatusCode
+            value are converted into a \l QOpcUaScalarDataChange without creating a QVariant and delivered
+            in the \l QOpcUaNode::scalarDataChangeOccurred() signal. The QVariant based signals and the
+            attribute cache of the node are populated on demand.
+            This option has no effect if \c batchDataChanges is set.
+            The default value is \c false.
+    \row
+        \li typedNumericArrays
+        \li open62541
+        \li If set to \c true, arrays of Boolean, integer and floating point values in read results and data change
+            notifications are returned as a contiguous QList of the matching C++ type, for example QList<double>
+            for an array of Double, instead of a QVariantList. Multidimensional arrays are returned as
+            \l QOpcUaMultiDimensionalArray with a \l {QOpcUaMultiDimensionalArray::typedValueArray()} {typed value array}.
+            Such lists can always be used as write values.
+            The default value is \c false.
+    \row
+        \li shareMonitoredItems
+        \li open62541
+        \li If set to \c true, nodes with the same node id which enable monitoring of the same attribute
+            and index range in the same subscription with the same sampling interval, queue size, discard policy,
+            monitoring mode and data change filter share a single monitored item on the server.
+            The notifications of the item are delivered to all of these nodes and the item is deleted
+            when the last node has disabled monitoring. Nodes joining an existing item receive the current value, which is read once when they join.
+            Items with an event filter or triggering links are not shared, the monitored item parameters of a shared item
+            can only be modified while it is used by a single node.
+            The default value is \c false.
+    \row
+        \li maxItemsPerSubscription
+        \li open62541
+        \li The maximum number of monitored items in a shared subscription. If a subscription with the requested
+            publishing interval is full, the items are added to another subscription with the same publishing
+            interval which is created if necessary. Each of these subscriptions has its own publish pipeline.
+            The distribution is shown by \l QOpcUaClient::requestSubscriptionStatistics().
+            The default value is 0 which means no limit.
+    \row
+        \li maxNotificationsPerSubscription
+        \li open62541
+        \li The maximum number of notifications a shared subscription is expected to deliver per publishing interval.
+            A monitored item is expected to deliver one notification per sampling interval up to its queue size,
+            event items are expected to deliver one notification per publishing interval. Items are spread over several
+            subscriptions like with \c maxItemsPerSubscription.
+            The default value is 0 which means no limit.
+    \row
+        \li outstandingPublishRequests
+        \li open62541
+        \li The number of publish requests the client keeps in flight for all of its subscriptions.
+            More requests allow the server to send the notifications of several subscriptions without waiting
+            for a new publish request. The default value is 0 which keeps the default of the SDK.
+    \row
+        \li recoverMissingNotifications
+        \li open62541
+        \li If set to \c true, the backend sends the publish requests instead of the SDK and tracks the
+            sequence numbers of the notification messages. Messages which have been lost, for example because
+            a publish request has timed out, are requested again from the server with the Republish service.
+            The gaps and the recovered messages are reported by \l QOpcUaClient::requestSubscriptionStatistics().
+            The keep-alive interval of the subscriptions should be shorter than the connect timeout
+            of the \l QOpcUaConnectionSettings which is used as timeout for the publish requests.
+            The default value is \c false.
+    \row
+        \li asyncSdkLogging
+        \li open62541
+        \li If set to \c true, the log messages of the open62541 SDK are passed to the
+            \c qt.opcua.plugins.open62541.sdk logging categories by a low priority thread instead of
+            the thread of the backend. Messages which don't fit into the buffer of the log thread are dropped
+            and messages longer than 255 bytes are truncated.
+            The default value is \c false.
+    \row
+        \li sharedThreadPoolSize
+        \li open62541
+        \li If set to a value greater than 0, the client doesn't create its own thread for the backend
+            but uses a thread of a thread pool shared by all clients with this property set.
+            The pool is created with the given number of threads by the first client and
+            destroyed with the last client, the value is ignored while the pool exists.
+            A client stays on the thread it has been assigned to and new clients are assigned
+            to the thread which was least busy since the previous assignment.
+            The client iterations on a shared thread don't wait for network data, combining this
+            property with \c eventDrivenClientIterate avoids polling of idle clients.
+            Connecting to a server and requesting the password for a private key block the other
+            clients on the same thread.
+            The default value is 0.
+    \row
+        \li notificationRingCapacity
+        \li open62541, loopback
+        \li If set to a value greater than 0, data change notifications are written into a bounded
+            lock-free ring with at least this number of entries instead of being delivered by a signal per notification.
+            The application takes the notifications with \l QOpcUaClient::drainNotifications() after
+            \l QOpcUaClient::notificationsAvailable() has been emitted.
+            This option has precedence over \c batchDataChanges and \c typedDataChanges.
+            The default value is 0.
+    \row
+        \li notificationRingOverflowPolicy
+        \li open62541, loopback
+        \li Determines what happens if the notification ring is full.
+            \c Block pauses the processing of this client until the application has drained the ring.
+            No notifications are lost. With open62541, all traffic of this client is paused: No service responses
+            are processed, the secure channel is not renewed and the keepalive is not sent. An application which
+            drains the ring too late may lose the connection. With \c recoverMissingNotifications, only the publish
+            requests are held back and the other services continue, but the server may delete a subscription whose
+            lifetime expires without a publish request.
+            The thread of the backend is not blocked, other clients sharing a thread of the
+            \c sharedThreadPoolSize pool are not affected.
+            \c DropOldest removes the oldest notification from the ring.
+            \c Conflate keeps only the newest notification per monitored item until there is space in the ring.
+            The number of affected notifications is returned by \l QOpcUaClient::droppedNotifications()
+            and \l QOpcUaClient::conflatedNotifications().
+            The default value is \c DropOldest.
+    \row
+        \li valueTableSize
+        \li open62541
+        \li The number of slots of the value table returned by \l QOpcUaClient::valueTable().
+            Monitored attributes are assigned to slots with \l QOpcUaNode::setValueTableSlot().
+            If the value is 0, no value table is created.
+            The default value is 0.
+    \row
+        \li trendBufferMemoryBudget
+        \li open62541
+        \li The maximum number of bytes used by all trend buffers created with \l QOpcUaNode::setTrendBufferDepth().
+            Trend buffers which would exceed the budget are not created.
+            If the value is 0, the memory is not limited.
+            The default value is 0.
+    \row
+        \li generatorNodeCount
+        \li loopback
+        \li The number of Double variables \c {ns=1;s=Generator.<n>} below the Objects folder whose
+            values are generated by the loopback backend. The n-th generated value of a variable is n.
+            The default value is 0.
+    \row
+        \li generatorIntervalMs
+        \li loopback
+        \li The interval in which new values are generated for the generator variables.
+            An interval of 0 generates values as fast as the event loop of the backend permits.
+            The default value is 100ms.
+    \row
+        \li generatorSamplesPerInterval
+        \li loopback
+        \li The number of values generated for each generator variable per interval.
+            Every value is reported to the monitored items of the variable.
+            The default value is 1.
+    \row
+        \li recordingFile
+        \li loopback
+        \li The name of a file written by \l QOpcUaSubscriptionRecorder. The nodes of the recording
+            are added to the address space of the loopback backend and the recorded data changes and
+            events are replayed after connecting.
+            The default value is empty.
+    \row
+        \li recordingSpeed
+        \li loopback
+        \li The speed factor for replaying the recording, 0 replays the recording as fast as possible.
+            The default value is 1.
+    \row
+        \li recordingLoop
+        \li loopback
+        \li If set to \c true, the recording is replayed again from its start when its end has been reached.
+            The default value is \c false.
     \endtable
 */
 QOpcUaClient *QOpcUaProvider::createClient(const QString &backend, const QVariantMap &backendProperties)
@@ -0,0 +1,837 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qloopbackbackend.h"
+#include <private/qopcuanotificationring_p.h>
+
+#include <QtOpcUa/qopcuaapplicationdescription.h>
+#include <QtOpcUa/qopcuaexpandednodeid.h>
+#include <QtOpcUa/qopcualocalizedtext.h>
+#include <QtOpcUa/qopcuaqualifiedname.h>
+#include <QtOpcUa/qopcuareferencedescription.h>
+#include <QtOpcUa/qopcuausertokenpolicy.h>
+#include <QtOpcUa/qopcuawriteitem.h>
+#include <QtOpcUa/qopcuawriteresult.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qloggingcategory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_LOOPBACK)
+
+static const QString loopbackNamespaceUri = QStringLiteral("urn:qt.io:opcua:loopback");
+
+// Number of records which are replayed at maximum speed before the event loop is entered again
+constexpr int maximumSpeedBatchSize = 4096;
+
+// Node ids without namespace index are in namespace 0, see QOpcUa::nodeIdEquals()
+static QString normalizedNodeId(const QString &nodeId)
+{
+    return nodeId.startsWith(QLatin1String("ns=")) ? nodeId : QLatin1String("ns=0;") + nodeId;
+}
+
+static qint64 toUaDateTime(const QDateTime &dateTime)
+{
+    // OPC UA 1.05 part 6, 5.1.4
+    constexpr qint64 epochOffset = 116444736000000000; // 100ns intervals from 1601-01-01 to 1970-01-01
+    return dateTime.isValid() ? dateTime.toMSecsSinceEpoch() * 10000 + epochOffset : 0;
+}
+
+static bool toScalarDataChange(const QOpcUaReadResult &value, QOpcUaScalarDataChange *change)
+{
+    const auto &variant = value.value();
+
+    switch (variant.metaType().id()) {
+    case QMetaType::UnknownType:
+        change->clearValue();
+        break;
+    case QMetaType::Bool:
+        change->setBoolean(variant.toBool());
+        break;
+    case QMetaType::SChar:
+        change->setSignedInteger(variant.value<qint8>(), QOpcUa::Types::SByte);
+        break;
+    case QMetaType::Short:
+        change->setSignedInteger(variant.value<qint16>(), QOpcUa::Types::Int16);
+        break;
+    case QMetaType::Int:
+        change->setSignedInteger(variant.toInt(), QOpcUa::Types::Int32);
+        break;
+    case QMetaType::LongLong:
+        change->setSignedInteger(variant.toLongLong(), QOpcUa::Types::Int64);
+        break;
+    case QMetaType::UChar:
+        change->setUnsignedInteger(variant.value<quint8>(), QOpcUa::Types::Byte);
+        break;
+    case QMetaType::UShort:
+        change->setUnsignedInteger(variant.value<quint16>(), QOpcUa::Types::UInt16);
+        break;
+    case QMetaType::UInt:
+        change->setUnsignedInteger(variant.toUInt(), QOpcUa::Types::UInt32);
+        break;
+    case QMetaType::ULongLong:
+        change->setUnsignedInteger(variant.toULongLong(), QOpcUa::Types::UInt64);
+        break;
+    case QMetaType::Float:
+        change->setFloatingPoint(variant.toFloat(), QOpcUa::Types::Float);
+        break;
+    case QMetaType::Double:
+        change->setFloatingPoint(variant.toDouble(), QOpcUa::Types::Double);
+        break;
+    case QMetaType::QDateTime:
+        change->setDateTime(toUaDateTime(variant.toDateTime()));
+        break;
+    default:
+        return false;
+    }
+
+    change->setStatusCode(value.statusCode());
+    change->setSourceTimestamp(toUaDateTime(value.sourceTimestamp()));
+    change->setServerTimestamp(toUaDateTime(value.serverTimestamp()));
+
+    return true;
+}
+
+LoopbackBackend::LoopbackBackend()
+    : QOpcUaBackend()
+    , m_generatorTimer(this)
+    , m_replayTimer(this)
+{
+    QObject::connect(&m_generatorTimer, &QTimer::timeout, this, &LoopbackBackend::generateValues);
+
+    m_replayTimer.setSingleShot(true);
+    m_replayTimer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&m_replayTimer, &QTimer::timeout, this, &LoopbackBackend::replayRecording);
+}
+
+LoopbackBackend::~LoopbackBackend()
+{
+}
+
+void LoopbackBackend::connectToEndpoint(const QOpcUaEndpointDescription &endpoint)
+{
+    Q_UNUSED(endpoint);
+
+    if (m_connected) {
+        qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "Already connected";
+        return;
+    }
+
+    emit stateAndOrErrorChanged(QOpcUaClient::Connecting, QOpcUaClient::NoError);
+
+    if (!m_recordingFile.isEmpty() && !m_recording.open(m_recordingFile)) {
+        emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::ConnectionError);
+        return;
+    }
+
+    createAddressSpace();
+
+    m_connected = true;
+    emit stateAndOrErrorChanged(QOpcUaClient::Connected, QOpcUaClient::NoError);
+
+    if (!m_generatorNodeIds.isEmpty())
+        m_generatorTimer.start(m_generatorInterval);
+
+    if (m_recording.isOpen()) {
+        m_recording.seek(0);
+        m_replayClock.start();
+        m_replayTimer.start(0);
+    }
+}
+
+void LoopbackBackend::disconnectFromEndpoint()
+{
+    m_generatorTimer.stop();
+    m_replayTimer.stop();
+    m_recording.close();
+
+    for (const auto &item : std::as_const(m_monitoredItems)) {
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(QOpcUa::UaStatusCode::BadDisconnect);
+        emit monitoringEnableDisable(item.handle, item.attr, false, s);
+    }
+
+    m_monitoredItems.clear();
+    m_handleToItemId.clear();
+    m_subscriptions.clear();
+    m_nodes.clear();
+    m_objectsFolderChildren.clear();
+    m_generatorNodeIds.clear();
+    m_pendingDataChanges.clear();
+
+    m_connected = false;
+    emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::NoError);
+}
+
+void LoopbackBackend::requestEndpoints(const QUrl &url)
+{
+    QOpcUaApplicationDescription server;
+    server.setApplicationUri(loopbackNamespaceUri);
+    server.setApplicationName(QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("Qt OPC UA loopback")));
+    server.setApplicationType(QOpcUaApplicationDescription::Server);
+    server.setDiscoveryUrls({url.toString()});
+
+    QOpcUaUserTokenPolicy anonymous;
+    anonymous.setPolicyId(QStringLiteral("anonymous"));
+    anonymous.setTokenType(QOpcUaUserTokenPolicy::TokenType::Anonymous);
+
+    QOpcUaEndpointDescription endpoint;
+    endpoint.setEndpointUrl(url.toString());
+    endpoint.setServer(server);
+    endpoint.setSecurityMode(QOpcUaEndpointDescription::MessageSecurityMode::None);
+    endpoint.setSecurityPolicy(QStringLiteral("http://opcfoundation.org/UA/SecurityPolicy#None"));
+    endpoint.setUserIdentityTokens({anonymous});
+
+    emit endpointsRequestFinished({endpoint}, QOpcUa::UaStatusCode::Good, url);
+}
+
+void LoopbackBackend::findServers(const QUrl &url)
+{
+    QOpcUaApplicationDescription server;
+    server.setApplicationUri(loopbackNamespaceUri);
+    server.setApplicationName(QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("Qt OPC UA loopback")));
+    server.setApplicationType(QOpcUaApplicationDescription::Server);
+    server.setDiscoveryUrls({url.toString()});
+
+    emit findServersFinished({server}, QOpcUa::UaStatusCode::Good, url);
+}
+
+void LoopbackBackend::browse(quint64 handle, const QString &nodeId, const QOpcUaBrowseRequest &request)
+{
+    const auto id = normalizedNodeId(nodeId);
+    if (!m_nodes.contains(id)) {
+        emit browseFinished(handle, {}, QOpcUa::UaStatusCode::BadNodeIdUnknown);
+        return;
+    }
+
+    // All nodes of the loopback are organized by the objects folder
+    QList<QOpcUaReferenceDescription> children;
+    if (id == QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder)
+            && request.browseDirection() != QOpcUaBrowseRequest::BrowseDirection::Inverse) {
+        for (const auto &childId : std::as_const(m_objectsFolderChildren)) {
+            const auto &child = m_nodes[childId];
+            if (request.nodeClassMask() && !(request.nodeClassMask() & child.nodeClass))
+                continue;
+
+            quint16 namespaceIndex = 0;
+            QOpcUa::nodeIdStringSplit(childId, &namespaceIndex, nullptr, nullptr);
+
+            QOpcUaReferenceDescription reference;
+            reference.setRefTypeId(QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId::Organizes));
+            reference.setTargetNodeId(QOpcUaExpandedNodeId(childId));
+            reference.setBrowseName(QOpcUaQualifiedName(namespaceIndex, child.browseName));
+            reference.setDisplayName(QOpcUaLocalizedText(QStringLiteral("en"), child.browseName));
+            reference.setNodeClass(child.nodeClass);
+            reference.setIsForwardReference(true);
+            reference.setTypeDefinition(QOpcUaExpandedNodeId(QOpcUa::namespace0Id(
+                    child.nodeClass == QOpcUa::NodeClass::Variable ? QOpcUa::NodeIds::Namespace0::BaseDataVariableType
+                                                                   : QOpcUa::NodeIds::Namespace0::BaseObjectType)));
+            children.push_back(reference);
+        }
+    }
+
+    emit browseFinished(handle, children, QOpcUa::UaStatusCode::Good);
+}
+
+void LoopbackBackend::readAttributes(quint64 handle, const QString &nodeId, QOpcUa::NodeAttributes attr,
+                                     const QString &indexRange)
+{
+    const auto id = normalizedNodeId(nodeId);
+
+    QList<QOpcUaReadResult> results;
+    qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute) {
+        auto result = readAttribute(id, attribute);
+        result.setIndexRange(indexRange);
+        results.push_back(result);
+    });
+
+    emit attributesRead(handle, results, QOpcUa::UaStatusCode::Good);
+}
+
+void LoopbackBackend::writeAttribute(quint64 handle, const QString &nodeId, QOpcUa::NodeAttribute attrId,
+                                     const QVariant &value)
+{
+    const auto statusCode = setAttribute(normalizedNodeId(nodeId), attrId, value);
+    deliverPending();
+    emit attributeWritten(handle, attrId, value, statusCode);
+}
+
+void LoopbackBackend::writeAttributes(quint64 handle, const QString &nodeId, const QOpcUaNode::AttributeMap &toWrite)
+{
+    const auto id = normalizedNodeId(nodeId);
+
+    QList<QOpcUa::UaStatusCode> statusCodes;
+    for (auto it = toWrite.constBegin(); it != toWrite.constEnd(); ++it)
+        statusCodes.push_back(setAttribute(id, it.key(), it.value()));
+
+    deliverPending();
+
+    qsizetype index = 0;
+    for (auto it = toWrite.constBegin(); it != toWrite.constEnd(); ++it)
+        emit attributeWritten(handle, it.key(), it.value(), statusCodes.at(index++));
+}
+
+void LoopbackBackend::enableMonitoring(quint64 handle, const QString &nodeId, QOpcUa::NodeAttributes attr,
+                                       const QOpcUaMonitoringParameters &settings)
+{
+    const auto id = normalizedNodeId(nodeId);
+
+    qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute) {
+        QOpcUaMonitoringParameters s;
+
+        auto node = m_nodes.find(id);
+        if (node == m_nodes.end()) {
+            s.setStatusCode(QOpcUa::UaStatusCode::BadNodeIdUnknown);
+            emit monitoringEnableDisable(handle, attribute, true, s);
+            return;
+        }
+
+        if (m_handleToItemId.value(handle).contains(attribute)) {
+            qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "There is already a monitored item for" << nodeId << attribute;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadEntryExists);
+            emit monitoringEnableDisable(handle, attribute, true, s);
+            return;
+        }
+
+        MonitoredItem item;
+        item.handle = handle;
+        item.attr = attribute;
+        item.nodeId = nodeId;
+        item.parameters = settings;
+        item.parameters.setSubscriptionId(subscriptionId(settings));
+        item.parameters.setPublishingInterval(m_subscriptions.value(item.parameters.subscriptionId()).publishingInterval);
+        item.parameters.setStatusCode(QOpcUa::UaStatusCode::Good);
+
+        const auto itemId = m_nextMonitoredItemId++;
+        item.parameters.setMonitoredItemId(itemId);
+
+        m_monitoredItems.insert(itemId, item);
+        m_handleToItemId[handle].insert(attribute, itemId);
+        node->monitoredItems.push_back(itemId);
+
+        emit monitoringEnableDisable(handle, attribute, true, item.parameters);
+
+        // Like a server, the current value is reported after the monitored item has been created
+        if (attribute != QOpcUa::NodeAttribute::EventNotifier) {
+            const auto value = readAttribute(id, attribute);
+            QOpcUaScalarDataChange change;
+            deliverDataChange(item, value, toScalarDataChange(value, &change) ? &change : nullptr);
+        }
+    });
+
+    deliverPending();
+}
+
+void LoopbackBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr)
+{
+    qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute) {
+        QOpcUaMonitoringParameters s;
+
+        auto handleItems = m_handleToItemId.find(handle);
+        if (handleItems == m_handleToItemId.end() || !handleItems->contains(attribute)) {
+            s.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+            emit monitoringEnableDisable(handle, attribute, false, s);
+            return;
+        }
+
+        const auto itemId = handleItems->take(attribute);
+        if (handleItems->isEmpty())
+            m_handleToItemId.erase(handleItems);
+
+        const auto item = m_monitoredItems.take(itemId);
+        auto node = m_nodes.find(normalizedNodeId(item.nodeId));
+        if (node != m_nodes.end())
+            node->monitoredItems.removeOne(itemId);
+
+        // The subscription is deleted with its last monitored item
+        const auto subscriptionId = item.parameters.subscriptionId();
+        if (std::none_of(m_monitoredItems.cbegin(), m_monitoredItems.cend(), [subscriptionId](const MonitoredItem &other) {
+                return other.parameters.subscriptionId() == subscriptionId;
+            })) {
+            m_subscriptions.remove(subscriptionId);
+        }
+
+        s.setStatusCode(QOpcUa::UaStatusCode::Good);
+        emit monitoringEnableDisable(handle, attribute, false, s);
+    });
+}
+
+void LoopbackBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr,
+                                       QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    const auto itemId = m_handleToItemId.value(handle).value(attr);
+    auto monitoredItem = m_monitoredItems.find(itemId);
+    if (monitoredItem == m_monitoredItems.end()) {
+        qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "Could not modify parameter" << item << "there are no monitored items";
+        QOpcUaMonitoringParameters p;
+        p.setStatusCode(QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+        emit monitoringStatusChanged(handle, attr, item, p);
+        return;
+    }
+
+    const auto subscriptionId = monitoredItem->parameters.subscriptionId();
+    const auto forEachItemOfSubscription = [this, subscriptionId](const std::function<void(MonitoredItem &)> &f) {
+        for (auto &other : m_monitoredItems) {
+            if (other.parameters.subscriptionId() == subscriptionId)
+                f(other);
+        }
+    };
+
+    bool typeMatches = true;
+
+    switch (item) {
+    case QOpcUaMonitoringParameters::Parameter::PublishingEnabled:
+        typeMatches = value.metaType().id() == QMetaType::Bool;
+        if (typeMatches) {
+            forEachItemOfSubscription([&value](MonitoredItem &other) {
+                other.parameters.setPublishingEnabled(value.toBool());
+            });
+        }
+        break;
+    case QOpcUaMonitoringParameters::Parameter::PublishingInterval:
+        typeMatches = value.canConvert<double>();
+        if (typeMatches) {
+            m_subscriptions[subscriptionId].publishingInterval = value.toDouble();
+            forEachItemOfSubscription([&value](MonitoredItem &other) {
+                other.parameters.setPublishingInterval(value.toDouble());
+            });
+        }
+        break;
+    case QOpcUaMonitoringParameters::Parameter::MonitoringMode:
+        typeMatches = value.metaType() == QMetaType::fromType<QOpcUaMonitoringParameters::MonitoringMode>();
+        if (typeMatches)
+            monitoredItem->parameters.setMonitoringMode(value.value<QOpcUaMonitoringParameters::MonitoringMode>());
+        break;
+    case QOpcUaMonitoringParameters::Parameter::SamplingInterval:
+        typeMatches = value.canConvert<double>();
+        if (typeMatches)
+            monitoredItem->parameters.setSamplingInterval(value.toDouble());
+        break;
+    case QOpcUaMonitoringParameters::Parameter::QueueSize:
+        typeMatches = value.canConvert<quint32>();
+        if (typeMatches)
+            monitoredItem->parameters.setQueueSize(value.toUInt());
+        break;
+    case QOpcUaMonitoringParameters::Parameter::DiscardOldest:
+        typeMatches = value.metaType().id() == QMetaType::Bool;
+        if (typeMatches)
+            monitoredItem->parameters.setDiscardOldest(value.toBool());
+        break;
+    default: {
+        qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "Modifying" << item << "is not supported";
+        QOpcUaMonitoringParameters p;
+        p.setStatusCode(QOpcUa::UaStatusCode::BadNotSupported);
+        emit monitoringStatusChanged(handle, attr, item, p);
+        return;
+    }
+    }
+
+    auto p = monitoredItem->parameters;
+    if (!typeMatches) {
+        qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "The new value for" << item << "has the wrong type";
+        p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
+    }
+    emit monitoringStatusChanged(handle, attr, item, p);
+}
+
+void LoopbackBackend::readNodeAttributes(const QList<QOpcUaReadItem> &nodesToRead)
+{
+    QList<QOpcUaReadResult> results;
+    results.reserve(nodesToRead.size());
+
+    for (const auto &item : nodesToRead) {
+        auto result = readAttribute(normalizedNodeId(item.nodeId()), item.attribute());
+        result.setNodeId(item.nodeId());
+        result.setIndexRange(item.indexRange());
+        results.push_back(result);
+    }
+
+    emit readNodeAttributesFinished(results, QOpcUa::UaStatusCode::Good);
+}
+
+void LoopbackBackend::writeNodeAttributes(const QList<QOpcUaWriteItem> &nodesToWrite)
+{
+    QList<QOpcUaWriteResult> results;
+    results.reserve(nodesToWrite.size());
+
+    for (const auto &item : nodesToWrite) {
+        QOpcUaWriteResult result;
+        result.setNodeId(item.nodeId());
+        result.setAttribute(item.attribute());
+        result.setIndexRange(item.indexRange());
+        result.setStatusCode(setAttribute(normalizedNodeId(item.nodeId()), item.attribute(), item.value()));
+        results.push_back(result);
+    }
+
+    deliverPending();
+    emit writeNodeAttributesFinished(results, QOpcUa::UaStatusCode::Good);
+}
+
+void LoopbackBackend::createAddressSpace()
+{
+    m_nodes.clear();
+    m_objectsFolderChildren.clear();
+    m_generatorNodeIds.clear();
+
+    quint16 maximumNamespaceIndex = 1;
+
+    m_nodes[QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder)].nodeClass = QOpcUa::NodeClass::Object;
+    m_nodes[QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder)].browseName = QStringLiteral("Objects");
+
+    for (quint32 i = 0; i < m_generatorNodeCount; ++i) {
+        const auto nodeId = QOpcUa::nodeIdFromString(1, QStringLiteral("Generator.%1").arg(i));
+        auto node = addNode(nodeId, QOpcUa::NodeClass::Variable, QStringLiteral("Generator.%1").arg(i));
+        node->value.setValue(0.0);
+        m_generatorNodeIds.push_back(nodeId);
+    }
+
+    // The recording is read once to find the nodes and their initial values
+    if (m_recording.isOpen()) {
+        QOpcUaRecordingReader::Record record;
+        while (m_recording.hasNext() && m_recording.readNext(&record)) {
+            const auto nodeId = normalizedNodeId(record.nodeId);
+            if (m_nodes.contains(nodeId))
+                continue;
+
+            quint16 namespaceIndex = 0;
+            QString identifier;
+            if (!QOpcUa::nodeIdStringSplit(nodeId, &namespaceIndex, &identifier, nullptr))
+                continue;
+            maximumNamespaceIndex = qMax(maximumNamespaceIndex, namespaceIndex);
+
+            const bool isEvent = record.type == QOpcUaRecordingFormat::RecordType::Event;
+            auto node = addNode(nodeId, isEvent ? QOpcUa::NodeClass::Object : QOpcUa::NodeClass::Variable, identifier);
+            if (!isEvent && record.dataChange.attribute() == QOpcUa::NodeAttribute::Value)
+                node->value = record.dataChange;
+        }
+    }
+
+    QStringList namespaceArray = {QStringLiteral("http://opcfoundation.org/UA/"), loopbackNamespaceUri};
+    for (quint16 i = 2; i <= maximumNamespaceIndex; ++i)
+        namespaceArray.push_back(loopbackNamespaceUri + QStringLiteral(":ns%1").arg(i));
+
+    auto &namespaceArrayNode = m_nodes[QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Server_NamespaceArray)];
+    namespaceArrayNode.browseName = QStringLiteral("NamespaceArray");
+    namespaceArrayNode.value.setValue(namespaceArray);
+    namespaceArrayNode.value.setStatusCode(QOpcUa::UaStatusCode::Good);
+}
+
+LoopbackBackend::Node *LoopbackBackend::addNode(const QString &nodeId, QOpcUa::NodeClass nodeClass,
+                                                const QString &browseName)
+{
+    auto &node = m_nodes[nodeId];
+    node.nodeClass = nodeClass;
+    node.browseName = browseName;
+    node.value.setStatusCode(QOpcUa::UaStatusCode::Good);
+    m_objectsFolderChildren.push_back(nodeId);
+    return &node;
+}
+
+QOpcUaReadResult LoopbackBackend::readAttribute(const QString &nodeId, QOpcUa::NodeAttribute attr) const
+{
+    QOpcUaReadResult result;
+
+    const auto node = m_nodes.constFind(nodeId);
+    if (node == m_nodes.constEnd()) {
+        result.setStatusCode(QOpcUa::UaStatusCode::BadNodeIdUnknown);
+    } else if (attr == QOpcUa::NodeAttribute::Value && node->nodeClass == QOpcUa::NodeClass::Variable) {
+        result = node->value;
+    } else {
+        quint16 namespaceIndex = 0;
+        QOpcUa::nodeIdStringSplit(nodeId, &namespaceIndex, nullptr, nullptr);
+
+        result.setStatusCode(QOpcUa::UaStatusCode::Good);
+
+        switch (attr) {
+        case QOpcUa::NodeAttribute::NodeId:
+            result.setValue(nodeId);
+            break;
+        case QOpcUa::NodeAttribute::NodeClass:
+            result.setValue(QVariant::fromValue(node->nodeClass));
+            break;
+        case QOpcUa::NodeAttribute::BrowseName:
+            result.setValue(QVariant::fromValue(QOpcUaQualifiedName(namespaceIndex, node->browseName)));
+            break;
+        case QOpcUa::NodeAttribute::DisplayName:
+            result.setValue(QVariant::fromValue(QOpcUaLocalizedText(QStringLiteral("en"), node->browseName)));
+            break;
+        case QOpcUa::NodeAttribute::AccessLevel:
+        case QOpcUa::NodeAttribute::UserAccessLevel:
+            if (node->nodeClass == QOpcUa::NodeClass::Variable)
+                result.setValue(quint8(quint8(QOpcUa::AccessLevelBit::CurrentRead) | quint8(QOpcUa::AccessLevelBit::CurrentWrite)));
+            else
+                result.setStatusCode(QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+            break;
+        case QOpcUa::NodeAttribute::EventNotifier:
+            if (node->nodeClass == QOpcUa::NodeClass::Object)
+                result.setValue(quint8(QOpcUa::EventNotifierBit::SubscribeToEvents));
+            else
+                result.setStatusCode(QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+            break;
+        default:
+            result.setStatusCode(QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+        }
+    }
+
+    result.setNodeId(nodeId);
+    result.setAttribute(attr);
+
+    return result;
+}
+
+QOpcUa::UaStatusCode LoopbackBackend::setAttribute(const QString &nodeId, QOpcUa::NodeAttribute attr,
+                                                   const QVariant &value)
+{
+    auto node = m_nodes.find(nodeId);
+    if (node == m_nodes.end())
+        return QOpcUa::UaStatusCode::BadNodeIdUnknown;
+
+    if (attr != QOpcUa::NodeAttribute::Value || node->nodeClass != QOpcUa::NodeClass::Variable)
+        return QOpcUa::UaStatusCode::BadNotWritable;
+
+    const auto now = QDateTime::currentDateTimeUtc();
+
+    QOpcUaReadResult result;
+    result.setNodeId(nodeId);
+    result.setAttribute(attr);
+    result.setValue(value);
+    result.setStatusCode(QOpcUa::UaStatusCode::Good);
+    result.setSourceTimestamp(now);
+    result.setServerTimestamp(now);
+    updateValue(*node, result);
+
+    return QOpcUa::UaStatusCode::Good;
+}
+
+void LoopbackBackend::generateValues()
+{
+    // A full ring in Block mode pauses the generator like a server which doesn't get publish requests
+    if (m_notificationRing && m_notificationRing->isBlocked())
+        return;
+
+    const auto now = QDateTime::currentDateTimeUtc();
+    const auto uaNow = toUaDateTime(now);
+
+    // All samples of a batch share the timestamps, only the value changes per sample
+    QOpcUaReadResult result;
+    result.setStatusCode(QOpcUa::UaStatusCode::Good);
+    result.setSourceTimestamp(now);
+    result.setServerTimestamp(now);
+
+    QOpcUaScalarDataChange change;
+    change.setSourceTimestamp(uaNow);
+    change.setServerTimestamp(uaNow);
+
+    if (m_batchDataChanges && !m_notificationRing) {
+        qsizetype batchSize = 0;
+        for (const auto &nodeId : std::as_const(m_generatorNodeIds)) {
+            const auto node = m_nodes.constFind(nodeId);
+            if (node != m_nodes.constEnd())
+                batchSize += node->monitoredItems.size();
+        }
+        m_pendingDataChanges.reserve(m_pendingDataChanges.size() + batchSize * m_generatorSamplesPerInterval);
+    }
+
+    for (const auto &nodeId : std::as_const(m_generatorNodeIds)) {
+        auto &node = m_nodes[nodeId];
+
+        // The n-th value of a generator node is n
+        if (node.monitoredItems.isEmpty()) {
+            node.generatorSample += m_generatorSamplesPerInterval;
+        } else {
+            for (quint32 i = 0; i < m_generatorSamplesPerInterval; ++i) {
+                const double value = ++node.generatorSample;
+                result.setValue(value);
+                change.setFloatingPoint(value, QOpcUa::Types::Double);
+
+                for (const auto itemId : std::as_const(node.monitoredItems)) {
+                    const auto &item = m_monitoredItems[itemId];
+                    if (item.attr == QOpcUa::NodeAttribute::Value)
+                        deliverDataChange(item, result, &change);
+                }
+            }
+        }
+
+        node.value.setValue(double(node.generatorSample));
+        node.value.setSourceTimestamp(now);
+        node.value.setServerTimestamp(now);
+    }
+
+    deliverPending();
+}
+
+void LoopbackBackend::replayRecording()
+{
+    // Resumed by flushNotificationRing()
+    if (m_notificationRing && m_notificationRing->isBlocked())
+        return;
+
+    const bool maximumSpeed = qFuzzyIsNull(m_recordingSpeed);
+    const qint64 now = maximumSpeed ? (std::numeric_limits<qint64>::max)()
+                                    : static_cast<qint64>(m_replayClock.nsecsElapsed() * m_recordingSpeed);
+    QOpcUaRecordingReader::Record record;
+    int batch = 0;
+
+    while (m_recording.hasNext() && m_recording.nextTime() <= now && batch < maximumSpeedBatchSize) {
+        if (!m_recording.readNext(&record))
+            break;
+        ++batch;
+
+        auto node = m_nodes.find(normalizedNodeId(record.nodeId));
+        if (node == m_nodes.end())
+            continue;
+
+        if (record.type == QOpcUaRecordingFormat::RecordType::Event) {
+            for (const auto itemId : std::as_const(node->monitoredItems)) {
+                const auto &item = m_monitoredItems[itemId];
+                if (item.attr == QOpcUa::NodeAttribute::EventNotifier && isReporting(item))
+                    emit eventOccurred(item.handle, record.eventFields);
+            }
+        } else if (record.dataChange.attribute() == QOpcUa::NodeAttribute::Value) {
+            updateValue(*node, record.dataChange);
+        } else {
+            QOpcUaScalarDataChange change;
+            const bool isScalar = toScalarDataChange(record.dataChange, &change);
+            for (const auto itemId : std::as_const(node->monitoredItems)) {
+                const auto &item = m_monitoredItems[itemId];
+                if (item.attr == record.dataChange.attribute())
+                    deliverDataChange(item, record.dataChange, isScalar ? &change : nullptr);
+            }
+        }
+    }
+
+    deliverPending();
+
+    if (!m_recording.hasNext()) {
+        if (!m_recordingLoop || !m_recording.recordCount())
+            return;
+        m_recording.seek(0);
+        m_replayClock.start();
+    }
+
+    if (maximumSpeed || batch == maximumSpeedBatchSize) {
+        m_replayTimer.start(0);
+    } else {
+        const double delay = m_recording.nextTime() / m_recordingSpeed - m_replayClock.nsecsElapsed();
+        m_replayTimer.start(std::chrono::milliseconds(qMax<qint64>(0, static_cast<qint64>(std::ceil(delay / 1e6)))));
+    }
+}
+
+void LoopbackBackend::updateValue(Node &node, const QOpcUaReadResult &value)
+{
+    node.value = value;
+    node.value.setAttribute(QOpcUa::NodeAttribute::Value);
+
+    if (node.monitoredItems.isEmpty())
+        return;
+
+    QOpcUaScalarDataChange change;
+    const bool isScalar = toScalarDataChange(value, &change);
+
+    for (const auto itemId : std::as_const(node.monitoredItems)) {
+        const auto &item = m_monitoredItems[itemId];
+        if (item.attr == QOpcUa::NodeAttribute::Value)
+            deliverDataChange(item, node.value, isScalar ? &change : nullptr);
+    }
+}
+
+// Delivers the data change like the open62541 backend, change is set if the value is a scalar
+void LoopbackBackend::deliverDataChange(const MonitoredItem &item, const QOpcUaReadResult &value,
+                                        const QOpcUaScalarDataChange *change)
+{
+    if (!isReporting(item))
+        return;
+
+    if (m_notificationRing) {
+        QOpcUaNotificationRing::Record record;
+        record.handle = item.handle;
+        if (change) {
+            record.change = *change;
+        } else {
+            record.value = value.value();
+            record.change.setStatusCode(value.statusCode());
+            record.change.setSourceTimestamp(toUaDateTime(value.sourceTimestamp()));
+            record.change.setServerTimestamp(toUaDateTime(value.serverTimestamp()));
+        }
+        record.change.setAttribute(item.attr);
+
+        if (m_notificationRing->post(std::move(record)))
+            emit notificationsAvailable();
+        return;
+    }
+
+    if (m_typedDataChanges && !m_batchDataChanges && change) {
+        auto scalarChange = *change;
+        scalarChange.setAttribute(item.attr);
+        emit scalarDataChangeOccurred(item.handle, scalarChange);
+        return;
+    }
+
+    auto result = value;
+    result.setAttribute(item.attr);
+
+    if (m_batchDataChanges) {
+        result.setNodeId(item.nodeId);
+        result.setIndexRange(item.parameters.indexRange());
+        m_pendingDataChanges.push_back(std::move(result));
+    } else {
+        emit dataChangeOccurred(item.handle, result);
+    }
+}
+
+void LoopbackBackend::deliverPending()
+{
+    if (!m_pendingDataChanges.isEmpty())
+        emit dataChangesOccurred(std::exchange(m_pendingDataChanges, {}));
+
+    if (m_notificationRing && m_notificationRing->flush())
+        emit notificationsAvailable();
+}
+
+void LoopbackBackend::flushNotificationRing()
+{
+    if (!m_notificationRing)
+        return;
+
+    const bool wasBlocked = m_notificationRing->isBlocked();
+
+    if (m_notificationRing->flush())
+        emit notificationsAvailable();
+
+    if (wasBlocked && !m_notificationRing->isBlocked() && m_recording.isOpen() && !m_replayTimer.isActive())
+        m_replayTimer.start(0);
+}
+
+bool LoopbackBackend::isReporting(const MonitoredItem &item) const
+{
+    return item.parameters.isPublishingEnabled()
+            && item.parameters.monitoringMode() == QOpcUaMonitoringParameters::MonitoringMode::Reporting;
+}
+
+quint32 LoopbackBackend::subscriptionId(const QOpcUaMonitoringParameters &settings)
+{
+    if (settings.subscriptionId() && m_subscriptions.contains(settings.subscriptionId()))
+        return settings.subscriptionId();
+
+    const bool shared = settings.subscriptionType() == QOpcUaMonitoringParameters::SubscriptionType::Shared;
+
+    // Like the open62541 backend, shared subscriptions are reused for the same publishing interval
+    if (shared) {
+        for (auto it = m_subscriptions.constBegin(); it != m_subscriptions.constEnd(); ++it) {
+            if (it->shared && qFuzzyCompare(it->publishingInterval, settings.publishingInterval()))
+                return it.key();
+        }
+    }
+
+    const auto id = m_nextSubscriptionId++;
+    m_subscriptions.insert(id, {settings.publishingInterval(), shared});
+    return id;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,121 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLOOPBACKBACKEND_H
+#define QLOOPBACKBACKEND_H
+
+#include <private/qopcuabackend_p.h>
+#include <private/qopcuarecordingplayer_p.h>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qtimer.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaNotificationRing;
+
+// Serves an in-process address space. The values of the variables are created by a generator
+// or are replayed from a recording of QOpcUaSubscriptionRecorder.
+class LoopbackBackend : public QOpcUaBackend
+{
+    Q_OBJECT
+public:
+    LoopbackBackend();
+    ~LoopbackBackend();
+
+public Q_SLOTS:
+    void connectToEndpoint(const QOpcUaEndpointDescription &endpoint);
+    void disconnectFromEndpoint();
+    void requestEndpoints(const QUrl &url);
+    void findServers(const QUrl &url);
+
+    // Node functions
+    void browse(quint64 handle, const QString &nodeId, const QOpcUaBrowseRequest &request);
+    void readAttributes(quint64 handle, const QString &nodeId, QOpcUa::NodeAttributes attr, const QString &indexRange);
+    void writeAttribute(quint64 handle, const QString &nodeId, QOpcUa::NodeAttribute attrId, const QVariant &value);
+    void writeAttributes(quint64 handle, const QString &nodeId, const QOpcUaNode::AttributeMap &toWrite);
+    void enableMonitoring(quint64 handle, const QString &nodeId, QOpcUa::NodeAttributes attr,
+                          const QOpcUaMonitoringParameters &settings);
+    void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
+    void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item,
+                          const QVariant &value);
+
+    void readNodeAttributes(const QList<QOpcUaReadItem> &nodesToRead);
+    void writeNodeAttributes(const QList<QOpcUaWriteItem> &nodesToWrite);
+
+    void flushNotificationRing() override;
+
+public:
+    // Configuration, set before the backend is moved to its thread
+    QString m_recordingFile;
+    double m_recordingSpeed = 1.0; // 0 replays as fast as possible
+    bool m_recordingLoop = false;
+    quint32 m_generatorNodeCount = 0;
+    quint32 m_generatorInterval = 100;
+    quint32 m_generatorSamplesPerInterval = 1;
+    bool m_batchDataChanges = false;
+    bool m_typedDataChanges = false;
+    std::shared_ptr<QOpcUaNotificationRing> m_notificationRing;
+
+private:
+    struct MonitoredItem {
+        quint64 handle = 0;
+        QOpcUa::NodeAttribute attr = QOpcUa::NodeAttribute::Value;
+        QString nodeId;
+        QOpcUaMonitoringParameters parameters;
+    };
+
+    struct Subscription {
+        double publishingInterval = 0;
+        bool shared = true;
+    };
+
+    struct Node {
+        QOpcUa::NodeClass nodeClass = QOpcUa::NodeClass::Variable;
+        QString browseName;
+        QOpcUaReadResult value;
+        QList<quint32> monitoredItems;
+        quint64 generatorSample = 0;
+    };
+
+    void createAddressSpace();
+    Node *addNode(const QString &nodeId, QOpcUa::NodeClass nodeClass, const QString &browseName);
+    QOpcUaReadResult readAttribute(const QString &nodeId, QOpcUa::NodeAttribute attr) const;
+    QOpcUa::UaStatusCode setAttribute(const QString &nodeId, QOpcUa::NodeAttribute attr, const QVariant &value);
+
+    void generateValues();
+    void replayRecording();
+    void updateValue(Node &node, const QOpcUaReadResult &value);
+    void deliverDataChange(const MonitoredItem &item, const QOpcUaReadResult &value,
+                           const QOpcUaScalarDataChange *change);
+    void deliverPending();
+    bool isReporting(const MonitoredItem &item) const;
+    quint32 subscriptionId(const QOpcUaMonitoringParameters &settings);
+
+    bool m_connected = false;
+
+    QHash<QString, Node> m_nodes;
+    QStringList m_objectsFolderChildren; // Node ids in the order of their creation
+    QStringList m_generatorNodeIds;
+
+    QHash<quint32, MonitoredItem> m_monitoredItems;
+    QHash<quint64, QHash<QOpcUa::NodeAttribute, quint32>> m_handleToItemId;
+    QHash<quint32, Subscription> m_subscriptions;
+    quint32 m_nextMonitoredItemId = 1;
+    quint32 m_nextSubscriptionId = 1;
+
+    QTimer m_generatorTimer;
+    QTimer m_replayTimer;
+    QElapsedTimer m_replayClock;
+    QOpcUaRecordingReader m_recording;
+
+    QList<QOpcUaReadResult> m_pendingDataChanges;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLOOPBACKBACKEND_H
@@ -0,0 +1,255 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qloopbackbackend.h"
+#include "qloopbackclient.h"
+#include "qloopbacknode.h"
+#include <private/qopcuaclient_p.h>
+#include <private/qopcuanotificationring_p.h>
+
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qurl.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_LOOPBACK)
+
+QLoopbackClient::QLoopbackClient(const QVariantMap &backendProperties)
+    : QOpcUaClientImpl()
+    , m_backend(new LoopbackBackend())
+{
+    m_backend->m_recordingFile = backendProperties.value(QStringLiteral("recordingFile")).toString();
+    m_backend->m_recordingLoop = backendProperties.value(QStringLiteral("recordingLoop"), false).toBool();
+
+    bool ok = false;
+    const double recordingSpeed = backendProperties.value(QStringLiteral("recordingSpeed"), 1.0).toDouble(&ok);
+
+    if (ok && recordingSpeed >= 0)
+        m_backend->m_recordingSpeed = recordingSpeed;
+
+    const quint32 generatorNodeCount = backendProperties.value(QStringLiteral("generatorNodeCount"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_generatorNodeCount = generatorNodeCount;
+
+    const quint32 generatorInterval = backendProperties.value(QStringLiteral("generatorIntervalMs"), 100)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_generatorInterval = generatorInterval;
+
+    const quint32 generatorSamplesPerInterval = backendProperties.value(QStringLiteral("generatorSamplesPerInterval"), 1)
+            .toUInt(&ok);
+
+    if (ok && generatorSamplesPerInterval)
+        m_backend->m_generatorSamplesPerInterval = generatorSamplesPerInterval;
+
+    m_backend->m_batchDataChanges = backendProperties.value(QStringLiteral("batchDataChanges"), false).toBool();
+    m_backend->m_typedDataChanges = backendProperties.value(QStringLiteral("typedDataChanges"), false).toBool();
+
+    const quint32 notificationRingCapacity = backendProperties.value(QStringLiteral("notificationRingCapacity"), 0)
+            .toUInt(&ok);
+
+    if (ok && notificationRingCapacity) {
+        auto policy = QOpcUaNotificationRing::OverflowPolicy::DropOldest;
+        const auto policyName = backendProperties.value(QStringLiteral("notificationRingOverflowPolicy"),
+                                                        QStringLiteral("DropOldest")).toString();
+        if (!QOpcUaNotificationRing::overflowPolicyFromString(policyName, &policy))
+            qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "Unknown notification ring overflow policy" << policyName
+                                                 << "using DropOldest";
+
+        m_notificationRing = std::make_shared<QOpcUaNotificationRing>(notificationRingCapacity, policy);
+        m_backend->m_notificationRing = m_notificationRing;
+    }
+
+    connectBackendWithClient(m_backend);
+
+    m_thread = new QThread();
+    m_thread->setObjectName("QLoopbackClient");
+    m_backend->moveToThread(m_thread);
+    connect(m_thread, &QThread::finished, m_thread, &QObject::deleteLater);
+    connect(m_thread, &QThread::finished, m_backend, &QObject::deleteLater);
+    m_thread->start();
+}
+
+QLoopbackClient::~QLoopbackClient()
+{
+    // Unpauses a backend blocked by a full notification ring, its notifications are dropped from now on
+    if (m_notificationRing)
+        m_notificationRing->close();
+
+    if (m_thread->isRunning())
+        m_thread->quit();
+
+    m_thread->wait();
+}
+
+void QLoopbackClient::connectToEndpoint(const QOpcUaEndpointDescription &endpoint)
+{
+    QMetaObject::invokeMethod(m_backend, "connectToEndpoint", Qt::QueuedConnection,
+                              Q_ARG(QOpcUaEndpointDescription, endpoint));
+}
+
+void QLoopbackClient::disconnectFromEndpoint()
+{
+    QMetaObject::invokeMethod(m_backend, "disconnectFromEndpoint", Qt::QueuedConnection);
+}
+
+QOpcUaNode *QLoopbackClient::node(const QString &nodeId)
+{
+    if (nodeId.isEmpty())
+        return nullptr;
+
+    auto tempNode = new QLoopbackNode(this, nodeId);
+    if (!tempNode->registered()) {
+        qCDebug(QT_OPCUA_PLUGINS_LOOPBACK) << "Failed to register node with backend, maximum number of nodes reached.";
+        delete tempNode;
+        return nullptr;
+    }
+    return new QOpcUaNode(tempNode, m_client);
+}
+
+QString QLoopbackClient::backend() const
+{
+    return QStringLiteral("loopback");
+}
+
+bool QLoopbackClient::requestEndpoints(const QUrl &url)
+{
+    return QMetaObject::invokeMethod(m_backend, "requestEndpoints", Qt::QueuedConnection, Q_ARG(QUrl, url));
+}
+
+bool QLoopbackClient::findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris)
+{
+    Q_UNUSED(localeIds);
+    Q_UNUSED(serverUris);
+
+    return QMetaObject::invokeMethod(m_backend, "findServers", Qt::QueuedConnection, Q_ARG(QUrl, url));
+}
+
+bool QLoopbackClient::readNodeAttributes(const QList<QOpcUaReadItem> &nodesToRead)
+{
+    return QMetaObject::invokeMethod(m_backend, "readNodeAttributes", Qt::QueuedConnection,
+                                     Q_ARG(QList<QOpcUaReadItem>, nodesToRead));
+}
+
+bool QLoopbackClient::writeNodeAttributes(const QList<QOpcUaWriteItem> &nodesToWrite)
+{
+    return QMetaObject::invokeMethod(m_backend, "writeNodeAttributes", Qt::QueuedConnection,
+                                     Q_ARG(QList<QOpcUaWriteItem>, nodesToWrite));
+}
+
+QOpcUaHistoryReadResponse *QLoopbackClient::readHistoryData(const QOpcUaHistoryReadRawRequest &request)
+{
+    Q_UNUSED(request);
+    qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "History read is not supported by the loopback backend";
+    return nullptr;
+}
+
+QOpcUaHistoryReadResponse *QLoopbackClient::readHistoryEvents(const QOpcUaHistoryReadEventRequest &request)
+{
+    Q_UNUSED(request);
+    qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "History read is not supported by the loopback backend";
+    return nullptr;
+}
+
+bool QLoopbackClient::addNode(const QOpcUaAddNodeItem &nodeToAdd)
+{
+    Q_UNUSED(nodeToAdd);
+    return false;
+}
+
+bool QLoopbackClient::deleteNode(const QString &nodeId, bool deleteTargetReferences)
+{
+    Q_UNUSED(nodeId);
+    Q_UNUSED(deleteTargetReferences);
+    return false;
+}
+
+bool QLoopbackClient::addReference(const QOpcUaAddReferenceItem &referenceToAdd)
+{
+    Q_UNUSED(referenceToAdd);
+    return false;
+}
+
+bool QLoopbackClient::deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete)
+{
+    Q_UNUSED(referenceToDelete);
+    return false;
+}
+
+QStringList QLoopbackClient::supportedSecurityPolicies() const
+{
+    return QStringList {
+        QStringLiteral("http://opcfoundation.org/UA/SecurityPolicy#None")
+    };
+}
+
+QList<QOpcUaUserTokenPolicy::TokenType> QLoopbackClient::supportedUserTokenTypes() const
+{
+    return QList<QOpcUaUserTokenPolicy::TokenType> {
+        QOpcUaUserTokenPolicy::TokenType::Anonymous
+    };
+}
+
+bool QLoopbackClient::registerNodes(const QStringList &nodesToRegister)
+{
+    Q_UNUSED(nodesToRegister);
+    return false;
+}
+
+bool QLoopbackClient::unregisterNodes(const QStringList &nodesToUnregister)
+{
+    Q_UNUSED(nodesToUnregister);
+    return false;
+}
+
+bool QLoopbackClient::readTagAttributes(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes)
+{
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, tags, attributes] {
+        for (const auto &tag : tags)
+            backend->readAttributes(tag.handle, tag.nodeId, attributes, QString());
+    }, Qt::QueuedConnection);
+}
+
+bool QLoopbackClient::writeTagAttribute(const Tag &tag, QOpcUa::NodeAttribute attribute, const QVariant &value,
+                                        QOpcUa::Types type)
+{
+    Q_UNUSED(type);
+
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, tag, attribute, value] {
+        backend->writeAttribute(tag.handle, tag.nodeId, attribute, value);
+    }, Qt::QueuedConnection);
+}
+
+bool QLoopbackClient::enableTagMonitoring(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes,
+                                          const QOpcUaMonitoringParameters &settings)
+{
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, tags, attributes, settings] {
+        for (const auto &tag : tags)
+            backend->enableMonitoring(tag.handle, tag.nodeId, attributes, settings);
+    }, Qt::QueuedConnection);
+}
+
+bool QLoopbackClient::disableTagMonitoring(const QList<quint64> &handles, QOpcUa::NodeAttributes attributes)
+{
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, handles, attributes] {
+        for (const auto handle : handles)
+            backend->disableMonitoring(handle, attributes);
+    }, Qt::QueuedConnection);
+}
+
+bool QLoopbackClient::modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attribute,
+                                           QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    // There are no service calls, the items are modified one by one
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, handles, attribute, item, value] {
+        for (const auto handle : handles)
+            backend->modifyMonitoring(handle, attribute, item, value);
+    }, Qt::QueuedConnection);
+}
+
+QT_END_NAMESPACE
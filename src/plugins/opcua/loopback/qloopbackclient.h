@@ -0,0 +1,67 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLOOPBACKCLIENT_H
+#define QLOOPBACKCLIENT_H
+
+#include <private/qopcuaclientimpl_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class LoopbackBackend;
+class QThread;
+
+class QLoopbackClient : public QOpcUaClientImpl
+{
+    Q_OBJECT
+
+public:
+    explicit QLoopbackClient(const QVariantMap &backendProperties);
+    ~QLoopbackClient();
+
+    void connectToEndpoint(const QOpcUaEndpointDescription &endpoint) override;
+    void disconnectFromEndpoint() override;
+
+    QOpcUaNode *node(const QString &nodeId) override;
+
+    QString backend() const override;
+
+    bool requestEndpoints(const QUrl &url) override;
+    bool findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris) override;
+
+    bool readNodeAttributes(const QList<QOpcUaReadItem> &nodesToRead) override;
+    bool writeNodeAttributes(const QList<QOpcUaWriteItem> &nodesToWrite) override;
+
+    QOpcUaHistoryReadResponse *readHistoryData(const QOpcUaHistoryReadRawRequest &request) override;
+    QOpcUaHistoryReadResponse *readHistoryEvents(const QOpcUaHistoryReadEventRequest &request) override;
+
+    bool addNode(const QOpcUaAddNodeItem &nodeToAdd) override;
+    bool deleteNode(const QString &nodeId, bool deleteTargetReferences) override;
+
+    bool addReference(const QOpcUaAddReferenceItem &referenceToAdd) override;
+    bool deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete) override;
+
+    QStringList supportedSecurityPolicies() const override;
+    QList<QOpcUaUserTokenPolicy::TokenType> supportedUserTokenTypes() const override;
+
+    bool registerNodes(const QStringList &nodesToRegister) override;
+    bool unregisterNodes(const QStringList &nodesToUnregister) override;
+
+    bool readTagAttributes(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes) override;
+    bool writeTagAttribute(const Tag &tag, QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type) override;
+    bool enableTagMonitoring(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes,
+                             const QOpcUaMonitoringParameters &settings) override;
+    bool disableTagMonitoring(const QList<quint64> &handles, QOpcUa::NodeAttributes attributes) override;
+
+    bool modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attribute,
+                              QOpcUaMonitoringParameters::Parameter item, const QVariant &value) override;
+
+private:
+    friend class QLoopbackNode;
+    QThread *m_thread = nullptr;
+    LoopbackBackend *m_backend;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLOOPBACKCLIENT_H
@@ -0,0 +1,167 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qloopbackbackend.h"
+#include "qloopbacknode.h"
+
+#include <QtCore/qloggingcategory.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_LOOPBACK)
+
+QLoopbackNode::QLoopbackNode(QLoopbackClient *client, const QString &nodeId)
+    : m_client(client)
+    , m_nodeId(nodeId)
+{
+    bool success = m_client->registerNode(this);
+    setRegistered(success);
+}
+
+QLoopbackNode::~QLoopbackNode()
+{
+    if (m_client)
+        m_client->unregisterNode(this);
+}
+
+bool QLoopbackNode::readAttributes(QOpcUa::NodeAttributes attr, const QString &indexRange)
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "readAttributes",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QString, m_nodeId),
+                                     Q_ARG(QOpcUa::NodeAttributes, attr),
+                                     Q_ARG(QString, indexRange));
+}
+
+bool QLoopbackNode::enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "enableMonitoring",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QString, m_nodeId),
+                                     Q_ARG(QOpcUa::NodeAttributes, attr),
+                                     Q_ARG(QOpcUaMonitoringParameters, settings));
+}
+
+bool QLoopbackNode::disableMonitoring(QOpcUa::NodeAttributes attr)
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "disableMonitoring",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QOpcUa::NodeAttributes, attr));
+}
+
+bool QLoopbackNode::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "modifyMonitoring",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QOpcUa::NodeAttribute, attr),
+                                     Q_ARG(QOpcUaMonitoringParameters::Parameter, item),
+                                     Q_ARG(QVariant, value));
+}
+
+bool QLoopbackNode::browse(const QOpcUaBrowseRequest &request)
+{
+    if (!m_client)
+        return false;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "browse",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QString, m_nodeId),
+                                     Q_ARG(QOpcUaBrowseRequest, request));
+}
+
+QString QLoopbackNode::nodeId() const
+{
+    return m_nodeId;
+}
+
+bool QLoopbackNode::writeAttribute(QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type, const QString &indexRange)
+{
+    if (!m_client)
+        return false;
+
+    // The loopback address space stores values as they are written
+    Q_UNUSED(type);
+
+    if (!indexRange.isEmpty()) {
+        qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "Index ranges are not supported by the loopback backend";
+        return false;
+    }
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttribute",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QString, m_nodeId),
+                                     Q_ARG(QOpcUa::NodeAttribute, attribute),
+                                     Q_ARG(QVariant, value));
+}
+
+bool QLoopbackNode::writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QOpcUa::Types valueAttributeType)
+{
+    if (!m_client)
+        return false;
+
+    Q_UNUSED(valueAttributeType);
+
+    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttributes",
+                                     Qt::QueuedConnection,
+                                     Q_ARG(quint64, handle()),
+                                     Q_ARG(QString, m_nodeId),
+                                     Q_ARG(QOpcUaNode::AttributeMap, toWrite));
+}
+
+bool QLoopbackNode::callMethod(const QString &methodNodeId, const QList<QOpcUa::TypedVariant> &args)
+{
+    Q_UNUSED(methodNodeId);
+    Q_UNUSED(args);
+    qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "Method calls are not supported by the loopback backend";
+    return false;
+}
+
+QOpcUaHistoryReadResponse *QLoopbackNode::readHistoryRaw(const QDateTime &startTime, const QDateTime &endTime, quint32 numValues,
+                                                         bool returnBounds, QOpcUa::TimestampsToReturn timestampsToReturn)
+{
+    Q_UNUSED(startTime);
+    Q_UNUSED(endTime);
+    Q_UNUSED(numValues);
+    Q_UNUSED(returnBounds);
+    Q_UNUSED(timestampsToReturn);
+    qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "History read is not supported by the loopback backend";
+    return nullptr;
+}
+
+QOpcUaHistoryReadResponse *QLoopbackNode::readHistoryEvents(const QDateTime &startTime, const QDateTime &endTime,
+                                                            const QOpcUaMonitoringParameters::EventFilter &filter, quint32 numValues)
+{
+    Q_UNUSED(startTime);
+    Q_UNUSED(endTime);
+    Q_UNUSED(filter);
+    Q_UNUSED(numValues);
+    qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "History read is not supported by the loopback backend";
+    return nullptr;
+}
+
+bool QLoopbackNode::resolveBrowsePath(const QList<QOpcUaRelativePathElement> &path)
+{
+    Q_UNUSED(path);
+    qCWarning(QT_OPCUA_PLUGINS_LOOPBACK) << "Browse path resolution is not supported by the loopback backend";
+    return false;
+}
+
+QT_END_NAMESPACE
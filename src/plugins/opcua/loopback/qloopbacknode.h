@@ -0,0 +1,46 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLOOPBACKNODE_H
+#define QLOOPBACKNODE_H
+
+#include "qloopbackclient.h"
+#include <private/qopcuanodeimpl_p.h>
+
+#include <QtCore/qpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+class QLoopbackNode : public QOpcUaNodeImpl
+{
+public:
+    explicit QLoopbackNode(QLoopbackClient *client, const QString &nodeId);
+    ~QLoopbackNode() override;
+
+    bool readAttributes(QOpcUa::NodeAttributes attr, const QString &indexRange) override;
+    bool enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings) override;
+    bool disableMonitoring(QOpcUa::NodeAttributes attr) override;
+    bool modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, const QVariant &value) override;
+    bool browse(const QOpcUaBrowseRequest &request) override;
+    QString nodeId() const override;
+
+    bool writeAttribute(QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type, const QString &indexRange) override;
+    bool writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QOpcUa::Types valueAttributeType) override;
+    bool callMethod(const QString &methodNodeId, const QList<QOpcUa::TypedVariant> &args) override;
+
+    QOpcUaHistoryReadResponse *readHistoryRaw(const QDateTime &startTime, const QDateTime &endTime, quint32 numValues, bool returnBounds,
+                                              QOpcUa::TimestampsToReturn timestampsToReturn) override;
+
+    QOpcUaHistoryReadResponse *readHistoryEvents(const QDateTime &startTime, const QDateTime &endTime,
+                                                 const QOpcUaMonitoringParameters::EventFilter &filter, quint32 numValues) override;
+
+    bool resolveBrowsePath(const QList<QOpcUaRelativePathElement> &path) override;
+
+private:
+    QPointer<QLoopbackClient> m_client;
+    QString m_nodeId;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLOOPBACKNODE_H
@@ -0,0 +1,28 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qloopbackclient.h"
+#include "qloopbackplugin.h"
+#include <QtOpcUa/qopcuaclient.h>
+
+#include <QtCore/qloggingcategory.h>
+
+QT_BEGIN_NAMESPACE
+
+QLoopbackPlugin::QLoopbackPlugin(QObject *parent)
+    : QOpcUaPlugin(parent)
+{
+}
+
+QLoopbackPlugin::~QLoopbackPlugin()
+{
+}
+
+QOpcUaClient *QLoopbackPlugin::createClient(const QVariantMap &backendProperties)
+{
+    return new QOpcUaClient(new QLoopbackClient(backendProperties));
+}
+
+Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_LOOPBACK, "qt.opcua.plugins.loopback")
+
+QT_END_NAMESPACE
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLOOPBACKPLUGIN_H
+#define QLOOPBACKPLUGIN_H
+
+#include <QtOpcUa/qopcuaplugin.h>
+
+QT_BEGIN_NAMESPACE
+
+class QLoopbackPlugin : public QOpcUaPlugin
+{
+    Q_OBJECT
+
+    Q_PLUGIN_METADATA(IID "org.qt-project.qt.opcua.providerfactory/1.0" FILE "loopback-metadata.json")
+    Q_INTERFACES(QOpcUaPlugin)
+
+public:
+    explicit QLoopbackPlugin(QObject *parent = nullptr);
+    ~QLoopbackPlugin() override;
+
+    QOpcUaClient *createClient(const QVariantMap &backendProperties) override;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLOOPBACKPLUGIN_H
@@ -5,15 +5,29 @@
 #define QOPEN62541BACKEND_H
 
 #include "qopen62541client.h"
+#include "qopen62541requesttable.h"
 #include "qopen62541subscription.h"
 #include <private/qopcuabackend_p.h>
 
+#include <QtCore/qpointer.h>
+#include <QtCore/qqueue.h>
 #include <QtCore/qset.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qtimer.h>
 
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
+class QOpcUaNotificationRing;
+class QOpcUaTrendBuffer;
+class QOpcUaValueTable;
+class QOpen62541LogSink;
+class QSocketNotifier;
+
 class Open62541AsyncBackend : public QOpcUaBackend
 {
     Q_OBJECT
@@ -29,12 +43,15 @@ public Q_SLOTS:
     // Node functions
     void browse(quint64 handle, UA_NodeId id, const QOpcUaBrowseRequest &request);
     void readAttributes(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, QString indexRange);
+    void readAttributes(const QList<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttributes attr);
 
     void writeAttribute(quint64 handle, UA_NodeId id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange);
     void writeAttributes(quint64 handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType);
     void enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
     void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attr,
+                              QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
     void callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QList<QOpcUa::TypedVariant> args);
     void resolveBrowsePath(quint64 handle, UA_NodeId startNode, const QList<QOpcUaRelativePathElement> &path);
     void findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris);
@@ -53,17 +70,29 @@ public Q_SLOTS:
     void deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete);
 
     // Subscription
-    QOpen62541Subscription *getSubscription(const QOpcUaMonitoringParameters &settings);
+    // nodeId and attr are the items which will be added, they are used for the subscription limits
+    QOpen62541Subscription *getSubscription(const QOpcUaMonitoringParameters &settings, const QString &nodeId = QString(),
+                                            QOpcUa::NodeAttributes attr = {});
+    void requestSubscriptionStatistics();
     bool removeSubscription(UA_UInt32 subscriptionId);
     void iterateClient();
     void triggerIterateClient();
+    void flushNotificationRing() override;
     void handleSubscriptionTimeout(QOpen62541Subscription *sub, QList<QPair<quint64, QOpcUa::NodeAttribute>> items);
+    void handleMonitoredItemsReleased(QOpen62541Subscription *sub, QList<QPair<quint64, QOpcUa::NodeAttribute>> items);
     void cleanupSubscriptions();
 
     // Register and unregister nodes
     void registerNodes(const QStringList &nodesToRegister);
     void unregisterNodes(const QStringList &nodesToUnregister);
 
+    // Read groups
+    void addReadGroup(quint64 handle, const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes);
+    void removeReadGroup(quint64 handle);
+    void readGroup(quint64 handle);
+    void setReadGroupCyclicInterval(quint64 handle, int interval);
+    void cleanupReadGroups();
+
     // Callbacks
     static void asyncMethodCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
     static void asyncTranslateBrowsePathCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
@@ -80,12 +109,68 @@ public Q_SLOTS:
     static void asyncRegisterNodesCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
     static void asyncUnregisterNodesCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
     static void asyncReadHistoryEventsCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
+    static void asyncReadGroupCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
+    static void asyncReadGroupRegisterNodesCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
+    static void asyncReadGroupUnregisterNodesCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
+    static void asyncPublishCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
+    static void asyncOperationLimitsCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response);
 
 public:
     UA_Client *m_uaclient;
     QOpen62541Client *m_clientImpl;
     quint32 m_clientIterateInterval;
     quint32 m_asyncRequestTimeout;
+    quint32 m_maxMonitoredItemsPerCall;
+    // Client side operation limits, 0 is unlimited. A lower limit announced by the server is used instead.
+    quint32 m_maxNodesPerRead;
+    quint32 m_maxNodesPerWrite;
+    quint32 m_maxNodesPerRegisterNodes;
+    quint32 m_maxConcurrentChunks;
+    quint32 m_maxInFlightRequests;
+    // Limits for spreading shared subscriptions over several subscriptions on the server, 0 is unlimited
+    quint32 m_maxItemsPerSubscription;
+    quint32 m_maxNotificationsPerSubscription;
+    quint32 m_outstandingPublishRequests; // 0 keeps the default of the SDK
+    bool m_readServerOperationLimits;
+    bool m_eventDrivenIterate;
+    bool m_batchDataChanges;
+    bool m_typedDataChanges;
+    bool m_typedNumericArrays;
+    bool m_shareMonitoredItems;
+    // The backend sends the publish requests instead of the SDK to track the sequence numbers
+    bool m_recoverMissingNotifications;
+    // Set if the backend runs on a thread of the shared thread pool
+    std::atomic<quint64> *m_threadBusyTime = nullptr;
+    // Shared with the client if data changes are delivered by the notification ring
+    std::shared_ptr<QOpcUaNotificationRing> m_notificationRing;
+    // Shared with the client if the latest values are written to a value table
+    std::shared_ptr<QOpcUaValueTable> m_valueTable;
+
+    void queueDataChange(QOpcUaReadResult &&result);
+    void postNotification(quint64 handle, QOpcUa::NodeAttribute attr, const UA_DataValue *value);
+    void setValueTableSlot(quint64 handle, QOpcUa::NodeAttribute attr, qsizetype slot);
+    void removeValueTableSlots(quint64 handle);
+    void writeValueTable(quint64 handle, QOpcUa::NodeAttribute attr, const UA_DataValue *value);
+    void setTrendBuffer(quint64 handle, QOpcUa::NodeAttribute attr, const QSharedPointer<QOpcUaTrendBuffer> &buffer);
+    void removeTrendBuffers(quint64 handle);
+    bool hasTrendBuffers() const { return !m_trendBuffers.isEmpty(); }
+    void appendTrendSample(quint64 handle, QOpcUa::NodeAttribute attr, const UA_DataValue *value);
+    quint32 maxMonitoredItemsPerCall() const;
+    QHash<QOpcUaClient::Service, quint32> inFlightRequests() const;
+    void enableAsyncLogging();
+    void sendPublishRequests();
+    void restartPublishRequests();
+    void acknowledgeNotificationMessage(UA_UInt32 subscriptionId, UA_UInt32 sequenceNumber);
+
+    // Requests exceeding the maxInFlightRequests window are queued and sent by priority
+    enum class RequestPriority {
+        High, // Writes and method calls
+        Normal,
+        Low, // Browse, TranslateBrowsePaths and history reads
+    };
+    static constexpr int RequestPriorityCount = 3;
+
+    bool admitRequest(RequestPriority priority, std::function<void()> &&request);
 
 private:
     static void clientStateCallback(UA_Client *client,
@@ -95,6 +180,18 @@ private:
 
     static void inactivityCallback(UA_Client *client);
 
+    // Hooks into the TCP connection manager of the client to get notified about the socket
+    static UA_StatusCode openConnectionHook(UA_ConnectionManager *cm, const UA_KeyValueMap *params,
+                                            void *application, void *context,
+                                            UA_ConnectionManager_connectionCallback connectionCallback);
+    static void connectionCallbackHook(UA_ConnectionManager *cm, uintptr_t connectionId,
+                                       void *application, void **connectionContext, UA_ConnectionState state,
+                                       const UA_KeyValueMap *params, UA_ByteString msg);
+    void installConnectionHook(UA_ClientConfig *conf);
+    void handleConnectionStateChange(uintptr_t connectionId, UA_ConnectionState state);
+    void scheduleNextIterate();
+    void handlePublishResponse(UA_UInt32 requestId, const UA_PublishResponse *response);
+
     static void open62541LogHandler(void *logContext, UA_LogLevel level, UA_LogCategory category,
                                     const char *msg, va_list args);
 
@@ -110,16 +207,134 @@ private:
 
     void disconnectInternal(QOpcUaClient::ClientError error = QOpcUaClient::ClientError::NoError);
 
+    struct ReadGroup {
+        ReadGroup() { UA_ReadRequest_init(&request); }
+        ~ReadGroup()
+        {
+            UA_ReadRequest_clear(&request);
+            if (registeredNodeIds)
+                UA_Array_delete(registeredNodeIds, registeredNodeIdsSize, &UA_TYPES[UA_TYPES_NODEID]);
+        }
+        Q_DISABLE_COPY(ReadGroup)
+
+        UA_ReadRequest request;
+        QList<QOpcUaReadResult> results;
+        QList<qsizetype> registeredNodeIndex; // Read item -> registered node
+        UA_NodeId *registeredNodeIds = nullptr;
+        size_t registeredNodeIdsSize = 0;
+        QTimer cyclicReadTimer;
+        bool prepared = false;
+        bool readInFlight = false;
+        bool readPending = false;
+        // The read is split into chunks if the group exceeds maxNodesPerRead
+        qsizetype nextOffset = 0;
+        quint32 chunksInFlight = 0;
+        QOpcUa::UaStatusCode readResult = QOpcUa::UaStatusCode::Good;
+    };
+
+    void sendReadGroupRequest(quint64 handle, ReadGroup *group);
+    void continueReadGroupRequest(quint64 handle);
+    void finishReadGroupRequest(quint64 handle, ReadGroup *group);
+
+    void dispatchQueuedRequests();
+    void failQueuedRequests();
+    quint32 windowRequestCount() const;
+    bool isRequestWindowFull() const;
+    void scheduleRequestQueueNotification();
+
+    // Operation limits of the server, 0 means no limit
+    struct OperationLimits {
+        quint32 maxNodesPerRead = 0;
+        quint32 maxNodesPerWrite = 0;
+        quint32 maxNodesPerRegisterNodes = 0;
+        quint32 maxMonitoredItemsPerCall = 0;
+    };
+
+    void readServerOperationLimits();
+    void handleOperationLimits(const UA_ReadResponse *response);
+    quint32 maxNodesPerRead() const;
+    quint32 maxNodesPerWrite() const;
+    quint32 maxNodesPerRegisterNodes() const;
+
+    // Requests exceeding an operation limit are split into chunks which are sent
+    // with a bounded number of chunks in flight and reassembled in order
+    template <typename Item, typename Result>
+    struct ChunkedOperation {
+        QList<Item> items;
+        QList<Result> results;
+        qsizetype chunkSize = 0;
+        qsizetype nextOffset = 0;
+        quint32 chunksInFlight = 0;
+        QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+
+        using ResultType = Result;
+    };
+    using ChunkedRead = ChunkedOperation<QOpcUaReadItem, QOpcUaReadResult>;
+    using ChunkedWrite = ChunkedOperation<QOpcUaWriteItem, QOpcUaWriteResult>;
+    using ChunkedNodeRegistration = ChunkedOperation<QString, QString>;
+
+    template <typename Operation, typename SendFunction>
+    bool sendChunks(Operation &operation, SendFunction send);
+    template <typename Operation>
+    void handleChunkResult(QHash<quint64, Operation> &operations, quint64 id, qsizetype offset,
+                           const QList<typename Operation::ResultType> &results, QOpcUa::UaStatusCode serviceResult,
+                           void (Open62541AsyncBackend::*continueFunction)(quint64));
+
+    UA_StatusCode sendReadRequest(const QList<QOpcUaReadItem> &nodesToRead, quint64 chunkedOperation = 0, qsizetype offset = 0);
+    void sendAttributesReadRequest(const QList<quint64> &handles, const QStringList &nodeIds, QOpcUa::NodeAttributes attr);
+    UA_StatusCode sendWriteRequest(const QList<QOpcUaWriteItem> &nodesToWrite, quint64 chunkedOperation = 0, qsizetype offset = 0);
+    UA_StatusCode sendRegisterNodesRequest(const QStringList &nodesToRegister, quint64 chunkedOperation = 0, qsizetype offset = 0);
+    UA_StatusCode sendUnregisterNodesRequest(const QStringList &nodesToUnregister, quint64 chunkedOperation = 0, qsizetype offset = 0);
+
+    void continueChunkedRead(quint64 id);
+    void continueChunkedWrite(quint64 id);
+    void continueChunkedRegisterNodes(quint64 id);
+    void continueChunkedUnregisterNodes(quint64 id);
+
     QTimer m_clientIterateTimer;
     QTimer m_clientIterateOnDemandTimer;
 
+    QSocketNotifier *m_socketNotifier;
+    uintptr_t m_socketNotifierConnectionId;
+    decltype(UA_ConnectionManager::openConnection) m_tcpOpenConnection;
+    UA_ConnectionManager_connectionCallback m_clientConnectionCallback;
+
     QHash<quint32, QOpen62541Subscription *> m_subscriptions;
 
     QHash<quint64, QHash<QOpcUa::NodeAttribute, QOpen62541Subscription *>> m_attributeMapping; // Handle -> Attribute -> Subscription
 
+    QHash<quint64, QHash<QOpcUa::NodeAttribute, qsizetype>> m_valueTableSlots; // Handle -> Attribute -> Slot
+    QHash<quint64, QHash<QOpcUa::NodeAttribute, QSharedPointer<QOpcUaTrendBuffer>>> m_trendBuffers; // Handle -> Attribute -> Buffer
+
+    QHash<quint64, ReadGroup *> m_readGroups;
+
+    std::array<QQueue<std::function<void()>>, RequestPriorityCount> m_requestQueues;
+    qsizetype m_queuedRequestCount = 0;
+    bool m_dispatchingQueuedRequests = false;
+    bool m_requestQueueNotificationPending = false;
+    qsizetype m_reportedQueuedRequests = 0;
+    bool m_reportedSaturation = false;
+
+    OperationLimits m_operationLimits;
+    bool m_operationLimitsPending = false; // Requests are queued until the limits have been read
+    quint64 m_chunkedOperationId = 0;
+    QHash<quint64, ChunkedRead> m_chunkedReads;
+    QHash<quint64, ChunkedWrite> m_chunkedWrites;
+    QHash<quint64, ChunkedNodeRegistration> m_chunkedRegisterNodes;
+    QHash<quint64, ChunkedNodeRegistration> m_chunkedUnregisterNodes;
+
     double m_minPublishingInterval;
 
+    QHash<UA_UInt32, QList<UA_SubscriptionAcknowledgement>> m_publishRequests; // In flight, request id -> Acknowledgements
+    bool m_publishRestartPending = false; // Publish requests are sent again by the next iteration
+    quint32 m_publishRequestLimit = 0; // Lowered if the server rejects publish requests, 0 is not lowered
+    QList<UA_SubscriptionAcknowledgement> m_pendingAcknowledgements; // Sent with the next publish request
+
+    QList<QOpcUaReadResult> m_pendingDataChanges;
+
+    // The context is the asynchronous log sink if it is enabled
     UA_Logger m_open62541Logger {open62541LogHandler, nullptr, nullptr};
+    std::unique_ptr<QOpen62541LogSink> m_logSink;
 
     // Async contexts
 
@@ -127,23 +342,19 @@ private:
         quint64 handle;
         QString methodNodeId;
     };
-    QMap<quint32, AsyncCallContext> m_asyncCallContext;
 
     struct AsyncTranslateContext {
         quint64 handle;
         QList<QOpcUaRelativePathElement> path;
     };
-    QMap<quint32, AsyncTranslateContext> m_asyncTranslateContext;
 
     struct AsyncAddNodeContext {
         QOpcUaExpandedNodeId requestedNodeId;
     };
-    QMap<quint32, AsyncAddNodeContext> m_asyncAddNodeContext;
 
     struct AsyncDeleteNodeContext {
         QString nodeId;
     };
-    QMap<quint32, AsyncDeleteNodeContext> m_asyncDeleteNodeContext;
 
     struct AsyncAddReferenceContext {
         QString sourceNodeId;
@@ -151,7 +362,6 @@ private:
         QOpcUaExpandedNodeId targetNodeId;
         bool isForwardReference;
     };
-    QMap<quint32, AsyncAddReferenceContext> m_asyncAddReferenceContext;
 
     struct AsyncDeleteReferenceContext {
         QString sourceNodeId;
@@ -159,53 +369,132 @@ private:
         QOpcUaExpandedNodeId targetNodeId;
         bool isForwardReference;
     };
-    QMap<quint32, AsyncDeleteReferenceContext> m_asyncDeleteReferenceContext;
 
+    // The results of all handles in request order, each handle has the same number of results
     struct AsyncReadContext {
-        quint64 handle;
+        QList<quint64> handles;
         QList<QOpcUaReadResult> results;
     };
-    QMap<quint32, AsyncReadContext> m_asyncReadContext;
 
     struct AsyncWriteAttributesContext {
         quint64 handle;
         QOpcUaNode::AttributeMap toWrite;
     };
-    QMap<quint32, AsyncWriteAttributesContext> m_asyncWriteAttributesContext;
 
     struct AsyncBrowseContext {
         quint64 handle;
         bool isBrowseNext;
         QList<QOpcUaReferenceDescription> results;
     };
-    QMap<quint32, AsyncBrowseContext> m_asyncBrowseContext;
 
     struct AsyncBatchReadContext {
         QList<QOpcUaReadItem> nodesToRead;
+        quint64 chunkedOperation = 0;
+        qsizetype offset = 0;
     };
-    QMap<quint32, AsyncBatchReadContext> m_asyncBatchReadContext;
 
     struct AsyncBatchWriteContext {
         QList<QOpcUaWriteItem> nodesToWrite;
+        quint64 chunkedOperation = 0;
+        qsizetype offset = 0;
     };
-    QMap<quint32, AsyncBatchWriteContext> m_asyncBatchWriteContext;
 
     struct AsyncReadHistoryDataContext {
         quint64 handle;
         QOpcUaHistoryReadRawRequest historyReadRawRequest;
     };
-    QMap<quint32, AsyncReadHistoryDataContext> m_asyncReadHistoryDataContext;
 
-    struct AsyncRegisterUnregisterNodesContext {
+    struct AsyncRegisterNodesContext {
+        QStringList nodeIds;
+        quint64 chunkedOperation = 0;
+        qsizetype offset = 0;
+    };
+
+    struct AsyncUnregisterNodesContext {
         QStringList nodeIds;
+        quint64 chunkedOperation = 0;
+        qsizetype offset = 0;
     };
-    QMap<quint32, AsyncRegisterUnregisterNodesContext> m_asyncRegisterUnregisterNodesContext;
 
     struct AsyncReadHistoryEventsContext {
         quint64 handle;
         QOpcUaHistoryReadEventRequest historyReadEventRequest;
     };
-    QMap<quint32, AsyncReadHistoryEventsContext> m_asyncReadHistoryEventsContext;
+
+    struct AsyncReadGroupContext {
+        quint64 handle;
+        qsizetype offset = 0;
+        qsizetype count = 0;
+    };
+
+    struct AsyncReadGroupRegisterContext {
+        quint64 handle;
+    };
+
+    struct AsyncReadGroupUnregisterContext {
+    };
+
+    struct AsyncOperationLimitsContext {
+    };
+
+public:
+    // Contexts of the requests sent by the subscriptions
+    struct AsyncCreateMonitoredItemsContext {
+        QPointer<QOpen62541Subscription> subscription;
+        QList<UA_UInt32> clientHandles; // The items may be gone when the response arrives
+    };
+
+    struct AsyncDeleteMonitoredItemsContext {
+        QList<QPair<quint64, QOpcUa::NodeAttribute>> items;
+    };
+
+    // One consumer handle and the server side id per monitored item in the order of the request
+    struct AsyncModifyMonitoredItemsContext {
+        QPointer<QOpen62541Subscription> subscription;
+        QOpcUa::NodeAttribute attr;
+        QOpcUaMonitoringParameters::Parameter item;
+        QVariant value;
+        QList<quint64> handles;
+        QList<UA_UInt32> monitoredItemIds;
+    };
+
+    struct AsyncSetMonitoringModeContext {
+        QPointer<QOpen62541Subscription> subscription;
+        QOpcUa::NodeAttribute attr;
+        QOpcUaMonitoringParameters::Parameter item;
+        QVariant value;
+        QList<quint64> handles;
+        QList<UA_UInt32> monitoredItemIds;
+    };
+
+    struct AsyncRepublishContext {
+        QPointer<QOpen62541Subscription> subscription;
+        UA_UInt32 sequenceNumber = 0;
+    };
+
+    // Reads the current value for a consumer which joins a shared monitored item
+    struct AsyncSharedItemReadContext {
+        QPointer<QOpen62541Subscription> subscription;
+        quint64 handle = 0;
+        QOpcUa::NodeAttribute attr = QOpcUa::NodeAttribute::None;
+        UA_UInt32 clientHandle = 0;
+        quint64 dataChanges = 0;
+    };
+
+    // The order of the context types defines the service index, see inFlightRequests()
+    using AsyncRequestTable = QOpen62541RequestTable<AsyncCallContext, AsyncTranslateContext, AsyncAddNodeContext,
+                                                     AsyncDeleteNodeContext, AsyncAddReferenceContext,
+                                                     AsyncDeleteReferenceContext, AsyncReadContext,
+                                                     AsyncWriteAttributesContext, AsyncBrowseContext,
+                                                     AsyncBatchReadContext, AsyncBatchWriteContext,
+                                                     AsyncReadHistoryDataContext, AsyncRegisterNodesContext,
+                                                     AsyncUnregisterNodesContext, AsyncReadHistoryEventsContext,
+                                                     AsyncReadGroupContext, AsyncReadGroupRegisterContext,
+                                                     AsyncReadGroupUnregisterContext, AsyncOperationLimitsContext,
+                                                     AsyncCreateMonitoredItemsContext, AsyncDeleteMonitoredItemsContext,
+                                                     AsyncModifyMonitoredItemsContext, AsyncSetMonitoringModeContext,
+                                                     AsyncRepublishContext, AsyncSharedItemReadContext>;
+    AsyncRequestTable m_asyncRequests;
 };
 
 QT_END_NAMESPACE
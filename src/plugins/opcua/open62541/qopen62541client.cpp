@@ -5,10 +5,14 @@
 #include "qopen62541client.h"
 #include "qopen62541node.h"
 #include "qopen62541subscription.h"
+#include "qopen62541threadpool.h"
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include <private/qopcuaclient_p.h>
 #include <private/qopcuahistoryreadresponseimpl_p.h>
+#include <private/qopcuanotificationring_p.h>
+#include <private/qopcuareadgroupimpl_p.h>
+#include <private/qopcuavaluetable_p.h>
 
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qstringlist.h>
@@ -44,9 +48,114 @@ QOpen62541Client::QOpen62541Client(const QVariantMap &backendProperties)
     if (ok)
         m_backend->m_asyncRequestTimeout = asyncRequestTimeout;
 
+    const quint32 maxMonitoredItemsPerCall = backendProperties.value(QStringLiteral("maxMonitoredItemsPerCall"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxMonitoredItemsPerCall = maxMonitoredItemsPerCall;
+
+    const quint32 maxNodesPerRead = backendProperties.value(QStringLiteral("maxNodesPerRead"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxNodesPerRead = maxNodesPerRead;
+
+    const quint32 maxNodesPerWrite = backendProperties.value(QStringLiteral("maxNodesPerWrite"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxNodesPerWrite = maxNodesPerWrite;
+
+    const quint32 maxNodesPerRegisterNodes = backendProperties.value(QStringLiteral("maxNodesPerRegisterNodes"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxNodesPerRegisterNodes = maxNodesPerRegisterNodes;
+
+    const quint32 maxConcurrentChunks = backendProperties.value(QStringLiteral("maxConcurrentChunks"), 4)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxConcurrentChunks = maxConcurrentChunks;
+
+    const quint32 maxInFlightRequests = backendProperties.value(QStringLiteral("maxInFlightRequests"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxInFlightRequests = maxInFlightRequests;
+
+    const quint32 maxItemsPerSubscription = backendProperties.value(QStringLiteral("maxItemsPerSubscription"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxItemsPerSubscription = maxItemsPerSubscription;
+
+    const quint32 maxNotificationsPerSubscription = backendProperties.value(QStringLiteral("maxNotificationsPerSubscription"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_maxNotificationsPerSubscription = maxNotificationsPerSubscription;
+
+    const quint32 outstandingPublishRequests = backendProperties.value(QStringLiteral("outstandingPublishRequests"), 0)
+            .toUInt(&ok);
+
+    if (ok)
+        m_backend->m_outstandingPublishRequests = outstandingPublishRequests;
+
+    m_backend->m_readServerOperationLimits = backendProperties.value(QStringLiteral("readServerOperationLimits"), true).toBool();
+
+    m_backend->m_eventDrivenIterate = backendProperties.value(QStringLiteral("eventDrivenClientIterate"), false).toBool();
+    m_backend->m_batchDataChanges = backendProperties.value(QStringLiteral("batchDataChanges"), false).toBool();
+    m_backend->m_typedDataChanges = backendProperties.value(QStringLiteral("typedDataChanges"), false).toBool();
+    m_backend->m_typedNumericArrays = backendProperties.value(QStringLiteral("typedNumericArrays"), false).toBool();
+    m_backend->m_shareMonitoredItems = backendProperties.value(QStringLiteral("shareMonitoredItems"), false).toBool();
+    m_backend->m_recoverMissingNotifications = backendProperties.value(QStringLiteral("recoverMissingNotifications"), false).toBool();
+
+    if (backendProperties.value(QStringLiteral("asyncSdkLogging"), false).toBool())
+        m_backend->enableAsyncLogging();
+
+    const quint32 notificationRingCapacity = backendProperties.value(QStringLiteral("notificationRingCapacity"), 0)
+            .toUInt(&ok);
+
+    if (ok && notificationRingCapacity) {
+        auto policy = QOpcUaNotificationRing::OverflowPolicy::DropOldest;
+        const auto policyName = backendProperties.value(QStringLiteral("notificationRingOverflowPolicy"),
+                                                        QStringLiteral("DropOldest")).toString();
+        if (!QOpcUaNotificationRing::overflowPolicyFromString(policyName, &policy))
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Unknown notification ring overflow policy" << policyName
+                                                  << "using DropOldest";
+
+        m_notificationRing = std::make_shared<QOpcUaNotificationRing>(notificationRingCapacity, policy);
+        m_backend->m_notificationRing = m_notificationRing;
+    }
+
+    const quint32 valueTableSize = backendProperties.value(QStringLiteral("valueTableSize"), 0).toUInt(&ok);
+
+    if (ok && valueTableSize) {
+        m_valueTable = QOpcUaValueTablePrivate::create(valueTableSize);
+        m_backend->m_valueTable = m_valueTable;
+    }
+
+    const qint64 trendBufferMemoryBudget = backendProperties.value(QStringLiteral("trendBufferMemoryBudget"), 0)
+            .toLongLong(&ok);
+
+    if (ok && trendBufferMemoryBudget > 0)
+        m_trendBufferMemoryBudget = trendBufferMemoryBudget;
+
+    const quint32 sharedThreadPoolSize = backendProperties.value(QStringLiteral("sharedThreadPoolSize"), 0)
+            .toUInt(&ok);
+
+    connectBackendWithClient(m_backend);
+
+    if (ok && sharedThreadPoolSize) {
+        m_threadPool = QOpen62541ThreadPool::instance(sharedThreadPoolSize);
+        m_threadPoolSlot = m_threadPool->attach(m_backend);
+        m_backend->m_threadBusyTime = &m_threadPoolSlot->busyTimeNs;
+        return;
+    }
+
     m_thread = new QThread();
     m_thread->setObjectName("QOpen62541Client");
-    connectBackendWithClient(m_backend);
     m_backend->moveToThread(m_thread);
     connect(m_thread, &QThread::finished, m_thread, &QObject::deleteLater);
     connect(m_thread, &QThread::finished, m_backend, &QObject::deleteLater);
@@ -61,6 +170,16 @@ QOpen62541Client::~QOpen62541Client()
     QObject::disconnect(m_backend, &Open62541AsyncBackend::passwordForPrivateKeyRequired,
                         this, &QOpcUaClientImpl::passwordForPrivateKeyRequired);
 
+    // Unpauses a backend blocked by a full notification ring, its notifications are dropped from now on
+    if (m_notificationRing)
+        m_notificationRing->close();
+
+    // The thread of the pool keeps running for the other clients
+    if (m_threadPool) {
+        m_threadPool->detach(m_threadPoolSlot, m_backend);
+        return;
+    }
+
     if (m_thread->isRunning())
         m_thread->quit();
 
@@ -93,6 +212,22 @@ QOpcUaNode *QOpen62541Client::node(const QString &nodeId)
     return new QOpcUaNode(tempNode, m_client);
 }
 
+QOpcUaNode *QOpen62541Client::node(const QOpcUaNodeId &nodeId)
+{
+    UA_NodeId uaNodeId = Open62541Utils::nodeIdFromQOpcUaNodeId(nodeId);
+    if (UA_NodeId_isNull(&uaNodeId))
+        return nullptr;
+
+    // The node id string is created on demand by QOpen62541Node::nodeId()
+    auto tempNode = new QOpen62541Node(uaNodeId, this, QString());
+    if (!tempNode->registered()) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to register node with backend, maximum number of nodes reached.";
+        delete tempNode;
+        return nullptr;
+    }
+    return new QOpcUaNode(tempNode, m_client);
+}
+
 QString QOpen62541Client::backend() const
 {
     return QStringLiteral("open62541");
@@ -146,6 +281,50 @@ QOpcUaHistoryReadResponse *QOpen62541Client::readHistoryData(const QOpcUaHistory
     return result;
 }
 
+QOpcUaReadGroup *QOpen62541Client::createReadGroup(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes)
+{
+    if (!m_client)
+        return nullptr;
+
+    auto impl = new QOpcUaReadGroupImpl(nodesToRead, useRegisteredNodes);
+    auto result = new QOpcUaReadGroup(impl);
+
+    QObject::connect(m_backend, &QOpcUaBackend::readGroupStatusChanged, impl, &QOpcUaReadGroupImpl::handleStatusChanged);
+    QObject::connect(m_backend, &QOpcUaBackend::readGroupReadFinished, impl, &QOpcUaReadGroupImpl::handleReadFinished);
+    QObject::connect(impl, &QOpcUaReadGroupImpl::readRequested, this, [this](quint64 handle) {
+        QMetaObject::invokeMethod(m_backend, "readGroup", Qt::QueuedConnection, Q_ARG(quint64, handle));
+    });
+    QObject::connect(impl, &QOpcUaReadGroupImpl::cyclicReadRequested, this, [this](quint64 handle, int interval) {
+        QMetaObject::invokeMethod(m_backend, "setReadGroupCyclicInterval", Qt::QueuedConnection,
+                                  Q_ARG(quint64, handle), Q_ARG(int, interval));
+    });
+    QObject::connect(impl, &QOpcUaReadGroupImpl::removeRequested, this, [this](quint64 handle) {
+        QMetaObject::invokeMethod(m_backend, "removeReadGroup", Qt::QueuedConnection, Q_ARG(quint64, handle));
+    });
+
+    const bool success = QMetaObject::invokeMethod(m_backend, "addReadGroup", Qt::QueuedConnection,
+                                                   Q_ARG(quint64, impl->handle()),
+                                                   Q_ARG(QList<QOpcUaReadItem>, nodesToRead),
+                                                   Q_ARG(bool, useRegisteredNodes));
+
+    if (!success) {
+        delete result;
+        return nullptr;
+    }
+
+    return result;
+}
+
+QHash<QOpcUaClient::Service, quint32> QOpen62541Client::inFlightRequests() const
+{
+    return m_backend->inFlightRequests();
+}
+
+bool QOpen62541Client::requestSubscriptionStatistics()
+{
+    return QMetaObject::invokeMethod(m_backend, "requestSubscriptionStatistics", Qt::QueuedConnection);
+}
+
 QOpcUaHistoryReadResponse *QOpen62541Client::readHistoryEvents(const QOpcUaHistoryReadEventRequest &request)
 {
     if (!m_client)
@@ -250,6 +429,57 @@ bool QOpen62541Client::unregisterNodes(const QStringList &nodesToUnregister)
                                      Q_ARG(QStringList, nodesToUnregister));
 }
 
+bool QOpen62541Client::readTagAttributes(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes)
+{
+    QList<quint64> handles;
+    QStringList nodeIds;
+    handles.reserve(tags.size());
+    nodeIds.reserve(tags.size());
+    for (const auto &tag : tags) {
+        handles.push_back(tag.handle);
+        nodeIds.push_back(tag.nodeId);
+    }
+
+    // The tags are read with as few requests as the operation limits of the server allow
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, handles, nodeIds, attributes] {
+        backend->readAttributes(handles, nodeIds, attributes);
+    }, Qt::QueuedConnection);
+}
+
+bool QOpen62541Client::writeTagAttribute(const Tag &tag, QOpcUa::NodeAttribute attribute, const QVariant &value,
+                                         QOpcUa::Types type)
+{
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, tag, attribute, value, type] {
+        backend->writeAttribute(tag.handle, Open62541Utils::nodeIdFromQString(tag.nodeId), attribute, value, type, QString());
+    }, Qt::QueuedConnection);
+}
+
+bool QOpen62541Client::enableTagMonitoring(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes,
+                                           const QOpcUaMonitoringParameters &settings)
+{
+    // The monitored items are queued by the subscription and created in batches
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, tags, attributes, settings] {
+        for (const auto &tag : tags)
+            backend->enableMonitoring(tag.handle, Open62541Utils::nodeIdFromQString(tag.nodeId), attributes, settings);
+    }, Qt::QueuedConnection);
+}
+
+bool QOpen62541Client::disableTagMonitoring(const QList<quint64> &handles, QOpcUa::NodeAttributes attributes)
+{
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, handles, attributes] {
+        for (const auto handle : handles)
+            backend->disableMonitoring(handle, attributes);
+    }, Qt::QueuedConnection);
+}
+
+bool QOpen62541Client::modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attribute,
+                                            QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    return QMetaObject::invokeMethod(m_backend, [backend = m_backend, handles, attribute, item, value] {
+        backend->modifyMonitoredItems(handles, attribute, item, value);
+    }, Qt::QueuedConnection);
+}
+
 bool QOpen62541Client::handleHistoryReadEventsRequested(const QOpcUaHistoryReadEventRequest &request, const QList<QByteArray> &continuationPoints,
                                                      bool releaseContinuationPoints, quint64 handle)
 {
@@ -5,10 +5,13 @@
 #define QOPEN62541CLIENT_H
 
 #include "qopen62541.h"
+#include "qopen62541threadpool.h"
 #include <private/qopcuaclientimpl_p.h>
 
 #include <QtCore/qtimer.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 class Open62541AsyncBackend;
@@ -25,6 +28,7 @@ public:
     void disconnectFromEndpoint() override;
 
     QOpcUaNode *node(const QString &nodeId) override;
+    QOpcUaNode *node(const QOpcUaNodeId &nodeId) override;
 
     QString backend() const override;
 
@@ -53,6 +57,20 @@ public:
     bool registerNodes(const QStringList &nodesToRegister) override;
     bool unregisterNodes(const QStringList &nodesToUnregister) override;
 
+    bool readTagAttributes(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes) override;
+    bool writeTagAttribute(const Tag &tag, QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type) override;
+    bool enableTagMonitoring(const QList<Tag> &tags, QOpcUa::NodeAttributes attributes,
+                             const QOpcUaMonitoringParameters &settings) override;
+    bool disableTagMonitoring(const QList<quint64> &handles, QOpcUa::NodeAttributes attributes) override;
+
+    bool modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attribute,
+                              QOpcUaMonitoringParameters::Parameter item, const QVariant &value) override;
+
+    QOpcUaReadGroup *createReadGroup(const QList<QOpcUaReadItem> &nodesToRead, bool useRegisteredNodes) override;
+
+    QHash<QOpcUaClient::Service, quint32> inFlightRequests() const override;
+    bool requestSubscriptionStatistics() override;
+
     bool handleHistoryReadEventsRequested(const QOpcUaHistoryReadEventRequest &request, const QList<QByteArray> &continuationPoints,
                                           bool releaseContinuationPoints, quint64 handle);
 
@@ -63,9 +81,15 @@ private slots:
 
 private:
     friend class QOpen62541Node;
-    QThread *m_thread;
+    QThread *m_thread = nullptr;
     Open62541AsyncBackend *m_backend;
 
+    qint64 m_trendBufferMemoryBudget = 0; // 0 means unlimited
+    qint64 m_trendBufferMemory = 0;
+
+    std::shared_ptr<QOpen62541ThreadPool> m_threadPool;
+    QOpen62541ThreadPool::Slot *m_threadPoolSlot = nullptr;
+
 #ifdef UA_ENABLE_ENCRYPTION
     bool m_hasSha1SignatureSupport = false;
 #endif
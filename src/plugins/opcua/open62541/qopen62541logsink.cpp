@@ -0,0 +1,208 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopen62541logsink.h"
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthread.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
+
+// Drains the buffers of all sinks, the thread is stopped when the last sink has been destroyed
+class QOpen62541LogThread
+{
+public:
+    QOpen62541LogThread();
+    ~QOpen62541LogThread();
+
+    static std::shared_ptr<QOpen62541LogThread> instance();
+
+    void addSink(QOpen62541LogSink *sink);
+    void removeSink(QOpen62541LogSink *sink);
+    void wakeUp() { m_wakeup.release(); }
+
+private:
+    void run();
+    void drainSinks();
+
+    QMutex m_mutex;
+    QList<QOpen62541LogSink *> m_sinks;
+    QSemaphore m_wakeup;
+    std::atomic<bool> m_stop {false};
+    std::unique_ptr<QThread> m_thread;
+};
+
+QOpen62541LogThread::QOpen62541LogThread()
+    : m_thread(QThread::create([this]() { run(); }))
+{
+    m_thread->setObjectName(QStringLiteral("QOpen62541LogSink"));
+    m_thread->start(QThread::LowestPriority);
+}
+
+QOpen62541LogThread::~QOpen62541LogThread()
+{
+    m_stop.store(true, std::memory_order_release);
+    m_wakeup.release();
+    m_thread->wait();
+}
+
+std::shared_ptr<QOpen62541LogThread> QOpen62541LogThread::instance()
+{
+    Q_CONSTINIT static QBasicMutex mutex;
+    Q_CONSTINIT static std::weak_ptr<QOpen62541LogThread> sharedThread;
+
+    const QMutexLocker locker(&mutex);
+
+    auto thread = sharedThread.lock();
+    if (!thread) {
+        thread = std::make_shared<QOpen62541LogThread>();
+        sharedThread = thread;
+    }
+
+    return thread;
+}
+
+void QOpen62541LogThread::addSink(QOpen62541LogSink *sink)
+{
+    const QMutexLocker locker(&m_mutex);
+    m_sinks.append(sink);
+}
+
+void QOpen62541LogThread::removeSink(QOpen62541LogSink *sink)
+{
+    // The sink is not drained by the logger thread anymore once the mutex has been acquired
+    const QMutexLocker locker(&m_mutex);
+    m_sinks.removeOne(sink);
+}
+
+void QOpen62541LogThread::run()
+{
+    while (!m_stop.load(std::memory_order_acquire)) {
+        // The timeout limits the delay if a wakeup has been missed
+        m_wakeup.tryAcquire(1, 100);
+        drainSinks();
+    }
+
+    drainSinks();
+}
+
+void QOpen62541LogThread::drainSinks()
+{
+    const QMutexLocker locker(&m_mutex);
+    for (QOpen62541LogSink *sink : std::as_const(m_sinks)) {
+        sink->m_wakeupPending.store(false, std::memory_order_release);
+        sink->drain();
+    }
+}
+
+QOpen62541LogSink::QOpen62541LogSink()
+    : m_logThread(QOpen62541LogThread::instance())
+{
+    m_logThread->addSink(this);
+}
+
+QOpen62541LogSink::~QOpen62541LogSink()
+{
+    m_logThread->removeSink(this);
+
+    // The messages which have not been written yet are written by the destroying thread
+    drain();
+}
+
+void QOpen62541LogSink::post(UA_LogCategory category, QtMsgType type, const char *message, bool truncated)
+{
+    const quint32 head = m_head.load(std::memory_order_relaxed);
+
+    if (head - m_tail.load(std::memory_order_acquire) == Capacity) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Record &record = m_records[head % Capacity];
+    record.category = category;
+    record.type = type;
+    qstrncpy(record.message, message, MaxMessageLength);
+    record.truncated = truncated || qstrlen(message) >= MaxMessageLength;
+
+    m_head.store(head + 1, std::memory_order_release);
+
+    if (!m_wakeupPending.exchange(true, std::memory_order_acq_rel))
+        m_logThread->wakeUp();
+}
+
+void QOpen62541LogSink::drain()
+{
+    quint32 tail = m_tail.load(std::memory_order_relaxed);
+    const quint32 head = m_head.load(std::memory_order_acquire);
+
+    for (; tail != head; ++tail) {
+        const Record &record = m_records[tail % Capacity];
+        write(record.category, record.type, record.message, record.truncated);
+        m_tail.store(tail + 1, std::memory_order_release);
+    }
+
+    const quint32 dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped)
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Dropped" << dropped << "SDK log messages, the log sink is full";
+}
+
+const QLoggingCategory &QOpen62541LogSink::loggingCategory(UA_LogCategory category)
+{
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_NETWORK == 0);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_SECURECHANNEL == 1);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_SESSION == 2);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_SERVER == 3);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_CLIENT == 4);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_USERLAND == 5);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_SECURITYPOLICY == 6);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_EVENTLOOP == 7);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_PUBSUB == 8);
+    Q_STATIC_ASSERT(UA_LOGCATEGORY_DISCOVERY == 9);
+
+    static const QLoggingCategory loggingCategories[] {
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.network"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.securechannel"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.session"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.server"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.client"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.userland"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.securitypolicy"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.eventloop"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.pubsub"),
+        QLoggingCategory("qt.opcua.plugins.open62541.sdk.discovery")
+    };
+
+    Q_ASSERT(category <= UA_LOGCATEGORY_DISCOVERY);
+
+    return loggingCategories[category];
+}
+
+void QOpen62541LogSink::write(UA_LogCategory category, QtMsgType type, const char *message, bool truncated)
+{
+    const QLoggingCategory &loggingCategory = QOpen62541LogSink::loggingCategory(category);
+    auto text = QString::fromUtf8(message);
+    if (truncated)
+        text += QLatin1StringView("... [truncated]");
+
+    switch (type) {
+    case QtDebugMsg:
+        qCDebug(loggingCategory).noquote() << text;
+        break;
+    case QtInfoMsg:
+        qCInfo(loggingCategory).noquote() << text;
+        break;
+    case QtWarningMsg:
+        qCWarning(loggingCategory).noquote() << text;
+        break;
+    default:
+        qCCritical(loggingCategory).noquote() << text;
+        break;
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPEN62541LOGSINK_H
+#define QOPEN62541LOGSINK_H
+
+#include "qopen62541.h"
+
+#include <QtCore/qloggingcategory.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QOpen62541LogThread;
+
+// Forwards SDK log messages to the Qt logging categories on a low priority thread.
+//
+// The messages are posted by the backend thread into a single producer single consumer ring buffer
+// which never blocks. If the buffer is full, the message is dropped and the number of dropped
+// messages is reported when the buffer has been drained.
+// The buffers of all clients are drained by one logger thread which exists as long as there is a sink.
+class QOpen62541LogSink
+{
+public:
+    static constexpr size_t MaxMessageLength = 256;
+
+    QOpen62541LogSink();
+    ~QOpen62541LogSink();
+
+    // Messages longer than MaxMessageLength - 1 are truncated and marked
+    void post(UA_LogCategory category, QtMsgType type, const char *message, bool truncated = false);
+
+    static const QLoggingCategory &loggingCategory(UA_LogCategory category);
+    static void write(UA_LogCategory category, QtMsgType type, const char *message, bool truncated = false);
+
+private:
+    friend class QOpen62541LogThread;
+
+    static constexpr quint32 Capacity = 256;
+
+    struct Record {
+        UA_LogCategory category;
+        QtMsgType type;
+        bool truncated;
+        char message[MaxMessageLength];
+    };
+
+    void drain();
+
+    std::array<Record, Capacity> m_records;
+    std::atomic<quint32> m_head {0}; // Written by the producer
+    std::atomic<quint32> m_tail {0}; // Written by the consumer
+    std::atomic<quint32> m_dropped {0};
+    std::atomic<bool> m_wakeupPending {false};
+    std::shared_ptr<QOpen62541LogThread> m_logThread;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541LOGSINK_H
@@ -8,13 +8,17 @@
 #include "qopen62541valueconverter.h"
 
 #include <private/qopcuahistoryreadresponse_p.h>
+#include <private/qopcuatrendbuffer_p.h>
 
 #include <QtCore/qdatetime.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qlist.h>
+#include <QtCore/qloggingcategory.h>
 
 QT_BEGIN_NAMESPACE
 
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
+
 QOpen62541Node::QOpen62541Node(const UA_NodeId nodeId, QOpen62541Client *client, const QString nodeIdString)
     : m_client(client)
     , m_nodeIdString(nodeIdString)
@@ -26,8 +30,21 @@ QOpen62541Node::QOpen62541Node(const UA_NodeId nodeId, QOpen62541Client *client,
 
 QOpen62541Node::~QOpen62541Node()
 {
-    if (m_client)
+    if (m_client) {
+        if (m_hasValueTableSlots) {
+            QMetaObject::invokeMethod(m_client->m_backend, [backend = m_client->m_backend, handle = handle()] {
+                backend->removeValueTableSlots(handle);
+            }, Qt::QueuedConnection);
+        }
+        if (!m_trendBufferMemory.isEmpty()) {
+            for (const auto memory : std::as_const(m_trendBufferMemory))
+                m_client->m_trendBufferMemory -= memory;
+            QMetaObject::invokeMethod(m_client->m_backend, [backend = m_client->m_backend, handle = handle()] {
+                backend->removeTrendBuffers(handle);
+            }, Qt::QueuedConnection);
+        }
         m_client->unregisterNode(this);
+    }
 
     UA_NodeId_clear(&m_nodeId);
 }
@@ -88,6 +105,8 @@ bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
 
 QString QOpen62541Node::nodeId() const
 {
+    if (m_nodeIdString.isEmpty())
+        m_nodeIdString = Open62541Utils::nodeIdToQString(m_nodeId);
     return m_nodeIdString;
 }
 
@@ -161,7 +180,7 @@ QOpcUaHistoryReadResponse *QOpen62541Node::readHistoryRaw(const QDateTime &start
     if (!m_client)
         return nullptr;
 
-    QOpcUaHistoryReadRawRequest request({ QOpcUaReadItem(m_nodeIdString) }, startTime, endTime, timestampsToReturn);
+    QOpcUaHistoryReadRawRequest request({ QOpcUaReadItem(nodeId()) }, startTime, endTime, timestampsToReturn);
     request.setNumValuesPerNode(numValues);
     request.setReturnBounds(returnBounds);
     return m_client->readHistoryData(request);
@@ -173,7 +192,7 @@ QOpcUaHistoryReadResponse *QOpen62541Node::readHistoryEvents(const QDateTime &st
     if (!m_client)
         return nullptr;
 
-    QOpcUaHistoryReadEventRequest request({QOpcUaReadItem(m_nodeIdString)},
+    QOpcUaHistoryReadEventRequest request({QOpcUaReadItem(nodeId())},
                                           startTime, endTime, filter);
     request.setNumValuesPerNode(numValues);
     return m_client->readHistoryEvents(request);
@@ -193,4 +212,53 @@ bool QOpen62541Node::resolveBrowsePath(const QList<QOpcUaRelativePathElement> &p
                                      Q_ARG(QList<QOpcUaRelativePathElement>, path));
 }
 
+bool QOpen62541Node::setValueTableSlot(QOpcUa::NodeAttribute attr, qsizetype slot)
+{
+    if (!m_client)
+        return false;
+
+    m_hasValueTableSlots |= slot >= 0;
+
+    return QMetaObject::invokeMethod(m_client->m_backend, [backend = m_client->m_backend, handle = handle(), attr, slot] {
+        backend->setValueTableSlot(handle, attr, slot);
+    }, Qt::QueuedConnection);
+}
+
+bool QOpen62541Node::setTrendBufferDepth(QOpcUa::NodeAttribute attr, qsizetype depth, QSharedPointer<QOpcUaTrendBuffer> *buffer)
+{
+    if (!m_client || !buffer)
+        return false;
+
+    // The budget is checked before the samples are allocated
+    const qint64 budget = m_client->m_trendBufferMemoryBudget;
+    const qint64 memory = depth ? QOpcUaTrendBuffer::memoryUsage(depth) : 0;
+    const qint64 others = m_client->m_trendBufferMemory - m_trendBufferMemory.value(attr);
+    if (budget && memory > budget - others) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "The trend buffer for" << nodeId() << attr
+                                              << "exceeds the trend buffer memory budget";
+        return false;
+    }
+
+    QSharedPointer<QOpcUaTrendBuffer> newBuffer;
+    if (depth)
+        newBuffer = QOpcUaTrendBufferPrivate::create(depth);
+
+    const bool success = QMetaObject::invokeMethod(m_client->m_backend,
+                                                   [backend = m_client->m_backend, handle = handle(), attr, newBuffer] {
+        backend->setTrendBuffer(handle, attr, newBuffer);
+    }, Qt::QueuedConnection);
+
+    if (!success)
+        return false;
+
+    *buffer = newBuffer;
+    m_client->m_trendBufferMemory = others + memory;
+    if (depth)
+        m_trendBufferMemory[attr] = memory;
+    else
+        m_trendBufferMemory.remove(attr);
+
+    return true;
+}
+
 QT_END_NAMESPACE
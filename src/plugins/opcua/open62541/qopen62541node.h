@@ -36,9 +36,14 @@ public:
 
     bool resolveBrowsePath(const QList<QOpcUaRelativePathElement> &path) override;
 
+    bool setValueTableSlot(QOpcUa::NodeAttribute attr, qsizetype slot) override;
+    bool setTrendBufferDepth(QOpcUa::NodeAttribute attr, qsizetype depth, QSharedPointer<QOpcUaTrendBuffer> *buffer) override;
+
 private:
     QPointer<QOpen62541Client> m_client;
-    QString m_nodeIdString;
+    bool m_hasValueTableSlots = false;
+    QHash<QOpcUa::NodeAttribute, qint64> m_trendBufferMemory; // Memory of the trend buffers charged to the client
+    mutable QString m_nodeIdString;
     UA_NodeId m_nodeId;
 };
 
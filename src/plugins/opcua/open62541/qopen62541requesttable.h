@@ -0,0 +1,207 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPEN62541REQUESTTABLE_H
+#define QOPEN62541REQUESTTABLE_H
+
+#include <QtCore/qglobal.h>
+
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+// Stores the contexts of all in flight asynchronous service requests of a client.
+//
+// The contexts are kept in a pool of slots which is reused after a request has finished.
+// The slots are found by request id using an open addressing hash table with linear probing.
+// Each context type corresponds to one service, the number of requests in flight is counted
+// per service and can be read from any thread.
+template <typename... Contexts>
+class QOpen62541RequestTable
+{
+public:
+    static constexpr size_t ServiceCount = sizeof...(Contexts);
+
+    template <typename T>
+    static constexpr size_t serviceIndex()
+    {
+        return indexOf<T, Contexts...>();
+    }
+
+    template <typename T>
+    void insert(quint32 requestId, T &&context)
+    {
+        using Type = std::decay_t<T>;
+
+        if ((m_size + 1) * 4 > m_buckets.size() * 3)
+            rehash(m_buckets.empty() ? InitialCapacity : m_buckets.size() * 2);
+
+        quint32 slot;
+        if (m_freeSlots.empty()) {
+            slot = static_cast<quint32>(m_slots.size());
+            m_slots.emplace_back();
+        } else {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        m_slots[slot].template emplace<Type>(std::forward<T>(context));
+
+        size_t pos = bucketFor(requestId);
+        while (m_buckets[pos].slot) {
+            if (m_buckets[pos].requestId == requestId) {
+                // A request id is never reused while the request is in flight
+                Q_ASSERT(false);
+                releaseSlot(m_buckets[pos].slot - 1);
+                --m_size;
+                break;
+            }
+            pos = (pos + 1) & mask();
+        }
+        m_buckets[pos] = { requestId, slot + 1 };
+        ++m_size;
+        m_inFlight[serviceIndex<Type>()].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns a default constructed context if there is no context of type T for requestId
+    template <typename T>
+    T take(quint32 requestId)
+    {
+        const size_t pos = find(requestId);
+        if (pos == NotFound)
+            return T();
+
+        const quint32 slot = m_buckets[pos].slot - 1;
+        T *context = std::get_if<T>(&m_slots[slot]);
+        if (!context)
+            return T();
+
+        T result = std::move(*context);
+        erase(pos);
+        return result;
+    }
+
+    template <typename T>
+    void removeAll()
+    {
+        for (size_t pos = 0; pos < m_buckets.size();) {
+            if (m_buckets[pos].slot && std::holds_alternative<T>(m_slots[m_buckets[pos].slot - 1]))
+                erase(pos); // Backward shift may move another entry to pos, check it again
+            else
+                ++pos;
+        }
+    }
+
+    void clear()
+    {
+        m_buckets.clear();
+        m_slots.clear();
+        m_freeSlots.clear();
+        m_size = 0;
+        for (auto &counter : m_inFlight)
+            counter.store(0, std::memory_order_relaxed);
+    }
+
+    size_t size() const { return m_size; }
+
+    quint32 inFlight(size_t service) const
+    {
+        return service < ServiceCount ? m_inFlight[service].load(std::memory_order_relaxed) : 0;
+    }
+
+    // Sum of the requests in flight for the services of the given context types
+    template <typename... T>
+    quint32 inFlight() const
+    {
+        return (inFlight(serviceIndex<T>()) + ... + 0u);
+    }
+
+private:
+    static constexpr size_t InitialCapacity = 64;
+    static constexpr size_t NotFound = ~size_t(0);
+
+    template <typename T, typename First, typename... Rest>
+    static constexpr size_t indexOf()
+    {
+        if constexpr (std::is_same_v<T, First>)
+            return 0;
+        else
+            return 1 + indexOf<T, Rest...>();
+    }
+
+    struct Bucket {
+        quint32 requestId = 0;
+        quint32 slot = 0; // Slot index + 1, 0 marks an empty bucket
+    };
+
+    size_t mask() const { return m_buckets.size() - 1; }
+
+    // open62541 hands out consecutive request ids, the identity spreads them over the buckets
+    size_t bucketFor(quint32 requestId) const { return requestId & mask(); }
+
+    size_t find(quint32 requestId) const
+    {
+        if (m_buckets.empty())
+            return NotFound;
+
+        for (size_t pos = bucketFor(requestId); m_buckets[pos].slot; pos = (pos + 1) & mask()) {
+            if (m_buckets[pos].requestId == requestId)
+                return pos;
+        }
+        return NotFound;
+    }
+
+    void releaseSlot(quint32 slot)
+    {
+        const size_t service = m_slots[slot].index() - 1;
+        m_inFlight[service].fetch_sub(1, std::memory_order_relaxed);
+        m_slots[slot] = std::monostate();
+        m_freeSlots.push_back(slot);
+    }
+
+    // Backward shift deletion keeps the probe sequences intact without tombstones
+    void erase(size_t pos)
+    {
+        releaseSlot(m_buckets[pos].slot - 1);
+        --m_size;
+
+        size_t hole = pos;
+        for (size_t next = (pos + 1) & mask(); m_buckets[next].slot; next = (next + 1) & mask()) {
+            const size_t ideal = bucketFor(m_buckets[next].requestId);
+            if (((next - ideal) & mask()) >= ((next - hole) & mask())) {
+                m_buckets[hole] = m_buckets[next];
+                hole = next;
+            }
+        }
+        m_buckets[hole] = Bucket();
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Bucket> old(capacity);
+        old.swap(m_buckets);
+
+        for (const auto &bucket : old) {
+            if (!bucket.slot)
+                continue;
+            size_t pos = bucketFor(bucket.requestId);
+            while (m_buckets[pos].slot)
+                pos = (pos + 1) & mask();
+            m_buckets[pos] = bucket;
+        }
+    }
+
+    std::vector<Bucket> m_buckets;
+    std::vector<std::variant<std::monostate, Contexts...>> m_slots;
+    std::vector<quint32> m_freeSlots;
+    size_t m_size = 0;
+    std::array<std::atomic<quint32>, ServiceCount> m_inFlight {};
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541REQUESTTABLE_H
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPEN62541SEQUENCETRACKER_H
+#define QOPEN62541SEQUENCETRACKER_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qset.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+// Tracks the sequence numbers of the notification messages of one subscription.
+//
+// Sequence numbers start at 1 and wrap around from 0xFFFFFFFF to 1, 0 is never used.
+// Messages which are skipped by a received message form a gap. The missing messages
+// which have been requested again with the Republish service are remembered until
+// either the republished or the original message arrives.
+class QOpen62541SequenceTracker
+{
+public:
+    enum class Order {
+        InOrder,
+        Gap, // The messages from gapStart() up to the received message are missing
+        Duplicate,
+        Recovered, // A missing message arrived after the gap has been detected
+    };
+
+    static constexpr quint32 next(quint32 sequenceNumber)
+    {
+        return sequenceNumber == std::numeric_limits<quint32>::max() ? 1 : sequenceNumber + 1;
+    }
+
+    // Number of sequence numbers from first up to, but not including, last
+    static constexpr quint32 distance(quint32 first, quint32 last)
+    {
+        return last >= first ? last - first : last - first - 1;
+    }
+
+    static constexpr bool isBefore(quint32 lhs, quint32 rhs)
+    {
+        return lhs != rhs && distance(lhs, rhs) < 0x80000000u;
+    }
+
+    // Keep-alive messages carry the sequence number of the next notification message
+    Order track(quint32 sequenceNumber, bool keepAlive)
+    {
+        if (!keepAlive && m_missing.remove(sequenceNumber))
+            return Order::Recovered;
+
+        if (isBefore(sequenceNumber, m_next))
+            return Order::Duplicate;
+
+        const Order order = sequenceNumber == m_next ? Order::InOrder : Order::Gap;
+        m_gapStart = m_next;
+        m_gapEnd = sequenceNumber;
+        m_next = keepAlive ? sequenceNumber : next(sequenceNumber);
+        return order;
+    }
+
+    // The gap found by the last call of track()
+    quint32 gapStart() const { return m_gapStart; }
+    quint32 gapSize() const { return distance(m_gapStart, m_gapEnd); }
+    bool isInGap(quint32 sequenceNumber) const
+    {
+        return !isBefore(sequenceNumber, m_gapStart) && isBefore(sequenceNumber, m_gapEnd);
+    }
+
+    // Called after the Republish request for a missing message has been sent
+    void markMissing(quint32 sequenceNumber) { m_missing.insert(sequenceNumber); }
+    // Returns false if the message is no longer missing
+    bool takeMissing(quint32 sequenceNumber) { return m_missing.remove(sequenceNumber); }
+    qsizetype missingCount() const { return m_missing.size(); }
+
+    quint32 nextSequenceNumber() const { return m_next; }
+
+    void reset(quint32 nextSequenceNumber = 1)
+    {
+        m_next = nextSequenceNumber;
+        m_gapStart = nextSequenceNumber;
+        m_gapEnd = nextSequenceNumber;
+        m_missing.clear();
+    }
+
+private:
+    quint32 m_next = 1;
+    quint32 m_gapStart = 1;
+    quint32 m_gapEnd = 1;
+    QSet<quint32> m_missing; // Waiting for the republished message
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541SEQUENCETRACKER_H
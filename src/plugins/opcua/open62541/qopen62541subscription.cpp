@@ -13,6 +13,10 @@
 #include "qopcuacontentfilterelementresult.h"
 
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qpointer.h>
+
+#include <algorithm>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -54,6 +58,99 @@ static void eventHandler(UA_Client *client, UA_UInt32 subId, void *subContext, U
     subscription->eventReceived(monId, list);
 }
 
+static void asyncCreateMonitoredItemsCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+
+    auto backend = static_cast<Open62541AsyncBackend *>(userdata);
+    const auto context = backend->m_asyncRequests.take<Open62541AsyncBackend::AsyncCreateMonitoredItemsContext>(requestId);
+    const auto res = static_cast<UA_CreateMonitoredItemsResponse *>(response);
+
+    // The items have already been reported as failed if the subscription is gone
+    if (context.subscription)
+        context.subscription->createMonitoredItemsFinished(context.clientHandles, res->responseHeader.serviceResult,
+                                                          res->results, res->resultsSize);
+}
+
+static void asyncDeleteMonitoredItemsCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+
+    auto backend = static_cast<Open62541AsyncBackend *>(userdata);
+    const auto context = backend->m_asyncRequests.take<Open62541AsyncBackend::AsyncDeleteMonitoredItemsContext>(requestId);
+    const auto res = static_cast<UA_DeleteMonitoredItemsResponse *>(response);
+
+    for (qsizetype i = 0; i < context.items.size(); ++i) {
+        UA_StatusCode status = res->responseHeader.serviceResult;
+        if (status == UA_STATUSCODE_GOOD)
+            status = static_cast<size_t>(i) < res->resultsSize ? res->results[i] : UA_STATUSCODE_BADINTERNALERROR;
+
+        if (status != UA_STATUSCODE_GOOD)
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item for" << context.items.at(i).second
+                                                  << ":" << UA_StatusCode_name(status);
+
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+        emit backend->monitoringEnableDisable(context.items.at(i).first, context.items.at(i).second, false, s);
+    }
+}
+
+static void asyncModifyMonitoredItemsCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+
+    auto backend = static_cast<Open62541AsyncBackend *>(userdata);
+    const auto context = backend->m_asyncRequests.take<Open62541AsyncBackend::AsyncModifyMonitoredItemsContext>(requestId);
+    const auto res = static_cast<UA_ModifyMonitoredItemsResponse *>(response);
+
+    // The consumers have already been notified if the subscription is gone
+    if (context.subscription)
+        context.subscription->modifyMonitoredItemsFinished(context.attr, context.handles, context.monitoredItemIds,
+                                                           context.item, context.value, res->responseHeader.serviceResult,
+                                                           nullptr, res->results, res->resultsSize);
+}
+
+static void asyncSetMonitoringModeCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+
+    auto backend = static_cast<Open62541AsyncBackend *>(userdata);
+    const auto context = backend->m_asyncRequests.take<Open62541AsyncBackend::AsyncSetMonitoringModeContext>(requestId);
+    const auto res = static_cast<UA_SetMonitoringModeResponse *>(response);
+
+    if (context.subscription)
+        context.subscription->modifyMonitoredItemsFinished(context.attr, context.handles, context.monitoredItemIds,
+                                                           context.item, context.value, res->responseHeader.serviceResult,
+                                                           res->results, nullptr, res->resultsSize);
+}
+
+static void asyncRepublishCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+
+    auto backend = static_cast<Open62541AsyncBackend *>(userdata);
+    const auto context = backend->m_asyncRequests.take<Open62541AsyncBackend::AsyncRepublishContext>(requestId);
+    const auto res = static_cast<UA_RepublishResponse *>(response);
+
+    if (context.subscription)
+        context.subscription->republishFinished(context.sequenceNumber, res->responseHeader.serviceResult,
+                                                res->notificationMessage);
+}
+
+static void asyncSharedItemReadCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+
+    auto backend = static_cast<Open62541AsyncBackend *>(userdata);
+    const auto context = backend->m_asyncRequests.take<Open62541AsyncBackend::AsyncSharedItemReadContext>(requestId);
+    const auto res = static_cast<UA_ReadResponse *>(response);
+
+    if (context.subscription)
+        context.subscription->sharedItemValueRead(context.handle, context.attr, context.clientHandle, context.dataChanges,
+                                                  res->responseHeader.serviceResult,
+                                                  res->resultsSize ? &res->results[0] : nullptr);
+}
+
 QOpen62541Subscription::QOpen62541Subscription(Open62541AsyncBackend *backend, const QOpcUaMonitoringParameters &settings)
     : m_backend(backend)
     , m_interval(settings.publishingInterval())
@@ -63,9 +160,18 @@ QOpen62541Subscription::QOpen62541Subscription(Open62541AsyncBackend *backend, c
     , m_shared(settings.subscriptionType())
     , m_priority(settings.priority())
     , m_maxNotificationsPerPublish(settings.maxNotificationsPerPublish())
+    , m_flushTimer(this)
     , m_clientHandle(0)
     , m_timeout(false)
+    , m_expectedNotifications(0)
+    , m_dataChangeNotifications(0)
+    , m_eventNotifications(0)
+    , m_sequenceGaps(0)
+    , m_republishedMessages(0)
+    , m_unrecoverableMessages(0)
 {
+    m_flushTimer.setSingleShot(true);
+    QObject::connect(&m_flushTimer, &QTimer::timeout, this, &QOpen62541Subscription::flushPendingMonitoredItems);
 }
 
 QOpen62541Subscription::~QOpen62541Subscription()
@@ -97,22 +203,55 @@ UA_UInt32 QOpen62541Subscription::createOnServer()
 
 bool QOpen62541Subscription::removeOnServer()
 {
+    m_flushTimer.stop();
+
     UA_StatusCode res = UA_STATUSCODE_GOOD;
     if (m_subscriptionId) {
         res = UA_Client_Subscriptions_deleteSingle(m_backend->m_uaclient, m_subscriptionId);
         m_subscriptionId = 0;
     }
 
-    for (auto it : std::as_const(m_itemIdToItemMapping)) {
+    for (auto entry = m_nodeHandleToItemMapping.cbegin(); entry != m_nodeHandleToItemMapping.cend(); ++entry) {
+        for (auto it : *entry) {
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(m_timeout ? QOpcUa::UaStatusCode::BadTimeout : QOpcUa::UaStatusCode::BadDisconnect);
+            // Items which have not been confirmed by the server are still waiting for the enable result
+            emit m_backend->monitoringEnableDisable(entry.key(), it->attr, m_unconfirmedItems.contains(it->clientHandle), s);
+        }
+    }
+
+    // Items waiting for removal are gone with the subscription
+    QList<QPair<quint64, QOpcUa::NodeAttribute>> removedItems;
+    for (auto it : std::as_const(m_pendingDeletes))
+        removedItems.push_back({it->handles.constFirst(), it->attr});
+    for (auto it : std::as_const(m_unconfirmedItems)) {
+        if (it->removeRequested)
+            removedItems.push_back({it->handles.constFirst(), it->attr});
+        for (const auto handle : std::as_const(it->detachedHandles))
+            removedItems.push_back({handle, it->attr});
+    }
+    for (const auto &it : std::as_const(removedItems)) {
         QOpcUaMonitoringParameters s;
-        s.setStatusCode(m_timeout ? QOpcUa::UaStatusCode::BadTimeout : QOpcUa::UaStatusCode::BadDisconnect);
-        emit m_backend->monitoringEnableDisable(it->handle, it->attr, false, s);
+        s.setStatusCode(QOpcUa::UaStatusCode::Good);
+        emit m_backend->monitoringEnableDisable(it.first, it.second, false, s);
     }
 
+    for (auto &entry : m_pendingCreates)
+        UA_MonitoredItemCreateRequest_clear(&entry.request);
+
     qDeleteAll(m_itemIdToItemMapping);
+    qDeleteAll(m_unconfirmedItems);
+    qDeleteAll(m_pendingDeletes);
 
     m_itemIdToItemMapping.clear();
+    m_clientHandleToItemMapping.clear();
     m_nodeHandleToItemMapping.clear();
+    m_sharedItems.clear();
+    m_pendingCreates.clear();
+    m_unconfirmedItems.clear();
+    m_pendingDeletes.clear();
+    m_sequenceTracker.reset();
+    m_expectedNotifications = 0;
 
     return (res == UA_STATUSCODE_GOOD) ? true : false;
 }
@@ -131,6 +270,36 @@ void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttrib
     QOpcUaMonitoringParameters p = monItem->parameters;
     p.setStatusCode(QOpcUa::UaStatusCode::BadNotImplemented);
 
+    // Subscription parameters affect all items of the subscription anyway
+    const bool isItemParameter = item == QOpcUaMonitoringParameters::Parameter::MonitoringMode
+            || item == QOpcUaMonitoringParameters::Parameter::TriggeredItemIds
+            || item == QOpcUaMonitoringParameters::Parameter::DiscardOldest
+            || item == QOpcUaMonitoringParameters::Parameter::QueueSize
+            || item == QOpcUaMonitoringParameters::Parameter::SamplingInterval
+            || item == QOpcUaMonitoringParameters::Parameter::Filter;
+
+    if (isItemParameter && monItem->handles.size() > 1) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify" << item << ", the monitored item is shared with"
+                                              << monItem->handles.size() - 1 << "other consumers";
+        p.setStatusCode(QOpcUa::UaStatusCode::BadNotSupported);
+        emit m_backend->monitoringStatusChanged(handle, attr, item, p);
+        return;
+    }
+
+    // The parameters of the item may no longer match the sharing key
+    if (isItemParameter)
+        unshareItem(monItem);
+
+    // SetMonitoringMode and ModifyMonitoredItems are sent asynchronously like for several items
+    if (item == QOpcUaMonitoringParameters::Parameter::MonitoringMode
+            || item == QOpcUaMonitoringParameters::Parameter::DiscardOldest
+            || item == QOpcUaMonitoringParameters::Parameter::QueueSize
+            || item == QOpcUaMonitoringParameters::Parameter::SamplingInterval
+            || item == QOpcUaMonitoringParameters::Parameter::Filter) {
+        modifyMonitoredItems({handle}, attr, item, value);
+        return;
+    }
+
     // SetPublishingMode service
     if (item == QOpcUaMonitoringParameters::Parameter::PublishingEnabled) {
         if (value.metaType().id() != QMetaType::Bool) {
@@ -166,41 +335,6 @@ void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttrib
         return;
     }
 
-    // SetMonitoringMode service
-    if (item == QOpcUaMonitoringParameters::Parameter::MonitoringMode) {
-        if (value.userType() != QMetaType::fromType<QOpcUaMonitoringParameters::MonitoringMode>().id()) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "New value for MonitoringMode is not a monitoring mode";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-            return;
-        }
-
-        UA_SetMonitoringModeRequest req;
-        UA_SetMonitoringModeRequest_init(&req);
-        UaDeleter<UA_SetMonitoringModeRequest> requestDeleter(&req, UA_SetMonitoringModeRequest_clear);
-        req.monitoringMode = static_cast<UA_MonitoringMode>(value.value<QOpcUaMonitoringParameters::MonitoringMode>());
-        req.monitoredItemIdsSize = 1;
-        req.monitoredItemIds = UA_UInt32_new();
-        *req.monitoredItemIds = monItem->monitoredItemId;
-        req.subscriptionId = m_subscriptionId;
-        UA_SetMonitoringModeResponse res = UA_Client_MonitoredItems_setMonitoringMode(m_backend->m_uaclient, req);
-        UaDeleter<UA_SetMonitoringModeResponse> responseDeleter(&res, UA_SetMonitoringModeResponse_clear);
-
-        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to set monitoring mode:" << res.responseHeader.serviceResult;
-            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-            emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-            return;
-        }
-
-        if (res.resultsSize && res.results[0] == UA_STATUSCODE_GOOD)
-            p.setMonitoringMode(value.value<QOpcUaMonitoringParameters::MonitoringMode>());
-
-        p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[0]));
-        emit m_backend->monitoringStatusChanged(handle, attr, item, p);
-        return;
-    }
-
     // SetTriggering service
     if (item == QOpcUaMonitoringParameters::Parameter::TriggeredItemIds) {
         if (!value.canConvert<QSet<quint32>>()) {
@@ -285,8 +419,6 @@ void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttrib
 
     if (modifySubscriptionParameters(handle, attr, item, value))
         return;
-    if (modifyMonitoredItemParameters(handle, attr, item, value))
-        return;
 
     qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Modifying" << item << "is not implemented";
     p.setStatusCode(QOpcUa::UaStatusCode::BadNotImplemented);
@@ -324,7 +456,28 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
     UA_MonitoredItemCreateResult res;
     UaDeleter<UA_MonitoredItemCreateResult> resultDeleter(&res, UA_MonitoredItemCreateResult_clear);
 
-    if (attr == QOpcUa::NodeAttribute::EventNotifier && settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
+    if (m_backend->m_recoverMissingNotifications) {
+        // The SDK replaces the client handle which is needed to dispatch the notifications of the backend's publish loop
+        UA_CreateMonitoredItemsRequest createRequest;
+        UA_CreateMonitoredItemsRequest_init(&createRequest);
+        createRequest.subscriptionId = m_subscriptionId;
+        createRequest.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+        createRequest.itemsToCreateSize = 1;
+        createRequest.itemsToCreate = &req; // Still owned by the request deleter
+
+        UA_CreateMonitoredItemsResponse createResponse;
+        __UA_Client_Service(m_backend->m_uaclient, &createRequest, &UA_TYPES[UA_TYPES_CREATEMONITOREDITEMSREQUEST],
+                            &createResponse, &UA_TYPES[UA_TYPES_CREATEMONITOREDITEMSRESPONSE]);
+        UaDeleter<UA_CreateMonitoredItemsResponse> createResponseDeleter(&createResponse, UA_CreateMonitoredItemsResponse_clear);
+
+        UA_MonitoredItemCreateResult_init(&res);
+        if (createResponse.responseHeader.serviceResult != UA_STATUSCODE_GOOD)
+            res.statusCode = createResponse.responseHeader.serviceResult;
+        else if (!createResponse.resultsSize)
+            res.statusCode = UA_STATUSCODE_BADINTERNALERROR;
+        else
+            std::swap(res, createResponse.results[0]);
+    } else if (attr == QOpcUa::NodeAttribute::EventNotifier && settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
         res = UA_Client_MonitoredItems_createEvent(m_backend->m_uaclient, m_subscriptionId,
                                                    UA_TIMESTAMPSTORETURN_BOTH, req, this, eventHandler, nullptr);
     else
@@ -393,6 +546,7 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
     }
 
     MonitoredItem *temp = new MonitoredItem(handle, attr, res.monitoredItemId);
+    temp->nodeId = Open62541Utils::nodeIdToQString(id);
     m_nodeHandleToItemMapping[handle][attr] = temp;
     m_itemIdToItemMapping[res.monitoredItemId] = temp;
 
@@ -409,6 +563,8 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
     s.setFailedTriggeredItemsStatus(failedTriggerLinks);
     temp->parameters = s;
     temp->clientHandle = m_clientHandle;
+    m_clientHandleToItemMapping[temp->clientHandle] = temp;
+    updateExpectedNotifications(temp);
 
     if (res.filterResult.encoding >= UA_EXTENSIONOBJECT_DECODED &&
             res.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
@@ -421,7 +577,70 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
     return true;
 }
 
-bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
+bool QOpen62541Subscription::queueAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                                                         const QOpcUaMonitoringParameters &settings)
+{
+    const QString nodeId = Open62541Utils::nodeIdToQString(id);
+    const SharingKey key = sharingKey(nodeId, attr, settings);
+
+    if (key.isValid()) {
+        const auto sharedItem = m_sharedItems.constFind(key);
+        if (sharedItem != m_sharedItems.constEnd()) {
+            attachToSharedItem(handle, sharedItem.value());
+            return true;
+        }
+    }
+
+    UA_MonitoredItemCreateRequest req;
+    UA_MonitoredItemCreateRequest_init(&req);
+    req.itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(attr);
+    UA_NodeId_copy(&id, &(req.itemToMonitor.nodeId));
+    if (settings.indexRange().size())
+        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(settings.indexRange(), &req.itemToMonitor.indexRange);
+    req.monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
+    req.requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+    req.requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
+    req.requestedParameters.discardOldest = settings.discardOldest();
+    req.requestedParameters.clientHandle = ++m_clientHandle;
+
+    if (settings.filter().isValid()) {
+        UA_ExtensionObject filter = createFilter(settings.filter());
+        if (filter.content.decoded.data)
+            req.requestedParameters.filter = filter;
+        else {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, filter creation failed";
+            UA_MonitoredItemCreateRequest_clear(&req);
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
+            emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+            return false;
+        }
+    }
+
+    MonitoredItem *temp = new MonitoredItem(handle, attr, 0);
+    temp->nodeId = nodeId;
+    temp->clientHandle = m_clientHandle;
+    temp->parameters = settings;
+    m_nodeHandleToItemMapping[handle][attr] = temp;
+    m_unconfirmedItems.insert(temp->clientHandle, temp);
+    updateExpectedNotifications(temp);
+
+    if (key.isValid()) {
+        temp->sharingKey = key;
+        m_sharedItems.insert(key, temp);
+    }
+
+    const bool isEvent = attr == QOpcUa::NodeAttribute::EventNotifier
+            && settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>();
+    m_pendingCreates.push_back({temp, req, isEvent});
+
+    if (!m_flushTimer.isActive())
+        m_flushTimer.start(0);
+
+    return true;
+}
+
+bool QOpen62541Subscription::queueRemoveAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
 {
     MonitoredItem *item = getItemForAttribute(handle, attr);
     if (!item) {
@@ -432,54 +651,351 @@ bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa
         return false;
     }
 
-    UA_StatusCode res = UA_Client_MonitoredItems_deleteSingle(m_backend->m_uaclient, m_subscriptionId, item->monitoredItemId);
-    if (res != UA_STATUSCODE_GOOD)
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << item->monitoredItemId << "from subscription" << m_subscriptionId << ":" << UA_StatusCode_name(res);
-
-    m_itemIdToItemMapping.remove(item->monitoredItemId);
     const auto it = m_nodeHandleToItemMapping.find(handle);
     it->remove(attr);
     if (it->empty())
         m_nodeHandleToItemMapping.remove(it.key());
 
-    delete item;
+    // The item stays on the server as long as other consumers use it
+    if (item->handles.size() > 1) {
+        item->handles.removeOne(handle);
+        if (m_unconfirmedItems.contains(item->clientHandle)) {
+            // The consumer is still waiting for the enable result
+            item->detachedHandles.push_back(handle);
+        } else {
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::Good);
+            emit m_backend->monitoringEnableDisable(handle, attr, false, s);
+        }
+        return true;
+    }
+
+    unshareItem(item);
+    setExpectedNotifications(item, 0);
+
+    if (m_unconfirmedItems.contains(item->clientHandle)) {
+        // The item is deleted as soon as the server has confirmed its creation
+        item->removeRequested = true;
+        return true;
+    }
+
+    m_itemIdToItemMapping.remove(item->monitoredItemId);
+    m_clientHandleToItemMapping.remove(item->clientHandle);
+    m_pendingDeletes.push_back(item);
 
-    QOpcUaMonitoringParameters s;
-    s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res));
-    emit m_backend->monitoringEnableDisable(handle, attr, false, s);
+    if (!m_flushTimer.isActive())
+        m_flushTimer.start(0);
 
     return true;
 }
 
+void QOpen62541Subscription::flushPendingMonitoredItems()
+{
+    if (!m_subscriptionId || !m_backend->m_uaclient)
+        return;
+
+    if (!m_pendingDeletes.isEmpty())
+        dispatchDeleteMonitoredItems();
+
+    if (!m_pendingCreates.isEmpty()) {
+        dispatchCreateMonitoredItems(false);
+        dispatchCreateMonitoredItems(true);
+        m_pendingCreates.clear();
+    }
+
+    m_backend->triggerIterateClient();
+}
+
+void QOpen62541Subscription::dispatchCreateMonitoredItems(bool events)
+{
+    QList<PendingCreate *> entries;
+    for (auto &entry : m_pendingCreates) {
+        if (entry.isEvent == events)
+            entries.push_back(&entry);
+    }
+
+    const quint32 maxItemsPerCall = m_backend->maxMonitoredItemsPerCall();
+    const qsizetype chunkSize = maxItemsPerCall ? maxItemsPerCall : entries.size();
+
+    for (qsizetype offset = 0; offset < entries.size(); offset += chunkSize) {
+        const qsizetype count = std::min(chunkSize, entries.size() - offset);
+
+        UA_CreateMonitoredItemsRequest req;
+        UA_CreateMonitoredItemsRequest_init(&req);
+        UaDeleter<UA_CreateMonitoredItemsRequest> requestDeleter(&req, UA_CreateMonitoredItemsRequest_clear);
+        req.requestHeader.timeoutHint = m_backend->m_asyncRequestTimeout;
+        req.subscriptionId = m_subscriptionId;
+        req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+        req.itemsToCreateSize = count;
+        req.itemsToCreate = static_cast<UA_MonitoredItemCreateRequest *>(
+                    UA_Array_new(count, &UA_TYPES[UA_TYPES_MONITOREDITEMCREATEREQUEST]));
+
+        Open62541AsyncBackend::AsyncCreateMonitoredItemsContext context;
+        context.subscription = this;
+
+        for (qsizetype i = 0; i < count; ++i) {
+            // The request now owns the dynamically allocated members
+            req.itemsToCreate[i] = entries.at(offset + i)->request;
+            context.clientHandles.push_back(entries.at(offset + i)->item->clientHandle);
+        }
+
+        QList<void *> contexts(count, this);
+        QList<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(count, nullptr);
+
+        UA_UInt32 requestId = 0;
+        UA_StatusCode result;
+        if (m_backend->m_recoverMissingNotifications) {
+            // The SDK replaces the client handles which are needed to dispatch the notifications of the backend's publish loop
+            result = __UA_Client_AsyncService(m_backend->m_uaclient, &req, &UA_TYPES[UA_TYPES_CREATEMONITOREDITEMSREQUEST],
+                                              asyncCreateMonitoredItemsCallback, &UA_TYPES[UA_TYPES_CREATEMONITOREDITEMSRESPONSE],
+                                              m_backend, &requestId);
+        } else if (events) {
+            QList<UA_Client_EventNotificationCallback> callbacks(count, eventHandler);
+            result = UA_Client_MonitoredItems_createEvents_async(m_backend->m_uaclient, req, contexts.data(), callbacks.data(),
+                                                                 deleteCallbacks.data(), asyncCreateMonitoredItemsCallback,
+                                                                 m_backend, &requestId);
+        } else {
+            QList<UA_Client_DataChangeNotificationCallback> callbacks(count, monitoredValueHandler);
+            result = UA_Client_MonitoredItems_createDataChanges_async(m_backend->m_uaclient, req, contexts.data(), callbacks.data(),
+                                                                      deleteCallbacks.data(), asyncCreateMonitoredItemsCallback,
+                                                                      m_backend, &requestId);
+        }
+
+        if (result != UA_STATUSCODE_GOOD) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not send CreateMonitoredItems request for" << count << "items:"
+                                                  << UA_StatusCode_name(result);
+            createMonitoredItemsFinished(context.clientHandles, result, nullptr, 0);
+            continue;
+        }
+
+        m_backend->m_asyncRequests.insert(requestId, std::move(context));
+    }
+}
+
+void QOpen62541Subscription::dispatchDeleteMonitoredItems()
+{
+    const quint32 maxItemsPerCall = m_backend->maxMonitoredItemsPerCall();
+    const qsizetype chunkSize = maxItemsPerCall ? maxItemsPerCall : m_pendingDeletes.size();
+
+    for (qsizetype offset = 0; offset < m_pendingDeletes.size(); offset += chunkSize) {
+        const qsizetype count = std::min(chunkSize, m_pendingDeletes.size() - offset);
+
+        UA_DeleteMonitoredItemsRequest req;
+        UA_DeleteMonitoredItemsRequest_init(&req);
+        UaDeleter<UA_DeleteMonitoredItemsRequest> requestDeleter(&req, UA_DeleteMonitoredItemsRequest_clear);
+        req.requestHeader.timeoutHint = m_backend->m_asyncRequestTimeout;
+        req.subscriptionId = m_subscriptionId;
+        req.monitoredItemIdsSize = count;
+        req.monitoredItemIds = static_cast<UA_UInt32 *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_UINT32]));
+
+        Open62541AsyncBackend::AsyncDeleteMonitoredItemsContext context;
+
+        for (qsizetype i = 0; i < count; ++i) {
+            const MonitoredItem *item = m_pendingDeletes.at(offset + i);
+            req.monitoredItemIds[i] = item->monitoredItemId;
+            // Only the last consumer of an item requests the deletion
+            context.items.push_back({item->handles.constFirst(), item->attr});
+        }
+
+        UA_UInt32 requestId = 0;
+        const UA_StatusCode result = UA_Client_MonitoredItems_delete_async(m_backend->m_uaclient, req,
+                                                                           asyncDeleteMonitoredItemsCallback,
+                                                                           m_backend, &requestId);
+
+        if (result != UA_STATUSCODE_GOOD) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not send DeleteMonitoredItems request for" << count << "items:"
+                                                  << UA_StatusCode_name(result);
+            for (const auto &entry : std::as_const(context.items)) {
+                QOpcUaMonitoringParameters s;
+                s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(result));
+                emit m_backend->monitoringEnableDisable(entry.first, entry.second, false, s);
+            }
+            continue;
+        }
+
+        m_backend->m_asyncRequests.insert(requestId, std::move(context));
+    }
+
+    qDeleteAll(m_pendingDeletes);
+    m_pendingDeletes.clear();
+}
+
+void QOpen62541Subscription::createMonitoredItemsFinished(const QList<UA_UInt32> &clientHandles, UA_StatusCode serviceResult,
+                                                          const UA_MonitoredItemCreateResult *results, size_t resultsSize)
+{
+    QList<QPair<quint64, QOpcUa::NodeAttribute>> failedItems;
+    bool itemsReleased = false;
+
+    for (qsizetype i = 0; i < clientHandles.size(); ++i) {
+        // Items which have been released while the request was in flight are no longer known
+        MonitoredItem *item = m_unconfirmedItems.take(clientHandles.at(i));
+        if (!item)
+            continue;
+
+        UA_StatusCode status = serviceResult;
+        if (status == UA_STATUSCODE_GOOD)
+            status = static_cast<size_t>(i) < resultsSize ? results[i].statusCode : UA_STATUSCODE_BADINTERNALERROR;
+
+        // Consumers which have left a shared item before its confirmation receive the enable and the disable result
+        const auto reportDetachedHandles = [this, item]() {
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::Good);
+            for (const auto handle : std::as_const(item->detachedHandles))
+                emit m_backend->monitoringEnableDisable(handle, item->attr, false, s);
+            item->detachedHandles.clear();
+        };
+
+        if (status != UA_STATUSCODE_GOOD) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not add monitored item for" << item->attr << ":" << UA_StatusCode_name(status);
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+            for (const auto handle : std::as_const(item->handles))
+                emit m_backend->monitoringEnableDisable(handle, item->attr, true, s);
+            for (const auto handle : std::as_const(item->detachedHandles))
+                emit m_backend->monitoringEnableDisable(handle, item->attr, true, s);
+            reportDetachedHandles();
+
+            itemsReleased = true;
+            unshareItem(item);
+            setExpectedNotifications(item, 0);
+            if (item->removeRequested) {
+                s.setStatusCode(QOpcUa::UaStatusCode::Good);
+                emit m_backend->monitoringEnableDisable(item->handles.constFirst(), item->attr, false, s);
+            } else {
+                for (const auto handle : std::as_const(item->handles)) {
+                    const auto it = m_nodeHandleToItemMapping.find(handle);
+                    it->remove(item->attr);
+                    if (it->empty())
+                        m_nodeHandleToItemMapping.remove(it.key());
+                    failedItems.push_back({handle, item->attr});
+                }
+            }
+
+            delete item;
+            continue;
+        }
+
+        item->monitoredItemId = results[i].monitoredItemId;
+        const QOpcUaMonitoringParameters s = revisedParameters(item, results[i]);
+        item->parameters = s;
+        item->parameters.clearFilterResult();
+
+        for (const auto handle : std::as_const(item->handles))
+            emit m_backend->monitoringEnableDisable(handle, item->attr, true, s);
+        for (const auto handle : std::as_const(item->detachedHandles))
+            emit m_backend->monitoringEnableDisable(handle, item->attr, true, s);
+        reportDetachedHandles();
+
+        if (item->removeRequested) {
+            itemsReleased = true;
+            m_pendingDeletes.push_back(item);
+            if (!m_flushTimer.isActive())
+                m_flushTimer.start(0);
+        } else {
+            m_itemIdToItemMapping[item->monitoredItemId] = item;
+            m_clientHandleToItemMapping[item->clientHandle] = item;
+            updateExpectedNotifications(item); // The sampling interval and the queue size may have been revised
+        }
+    }
+
+    if (itemsReleased)
+        emit monitoredItemsReleased(this, failedItems);
+}
+
+QOpcUaMonitoringParameters QOpen62541Subscription::revisedParameters(const MonitoredItem *item, const UA_MonitoredItemCreateResult &res)
+{
+    QOpcUaMonitoringParameters s = item->parameters;
+    s.setSubscriptionId(m_subscriptionId);
+    s.setPublishingInterval(m_interval);
+    s.setMaxKeepAliveCount(m_maxKeepaliveCount);
+    s.setLifetimeCount(m_lifetimeCount);
+    s.setStatusCode(QOpcUa::UaStatusCode::Good);
+    s.setSamplingInterval(res.revisedSamplingInterval);
+    s.setQueueSize(res.revisedQueueSize);
+    s.setMonitoredItemId(res.monitoredItemId);
+
+    if (res.filterResult.encoding >= UA_EXTENSIONOBJECT_DECODED &&
+            res.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
+        s.setFilterResult(convertEventFilterResult(&res.filterResult));
+    else
+        s.clearFilterResult();
+
+    return s;
+}
+
 void QOpen62541Subscription::monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value)
 {
     auto item = m_itemIdToItemMapping.constFind(monId);
     if (item == m_itemIdToItemMapping.constEnd())
         return;
+
+    MonitoredItem *monItem = item.value();
+
+    ++monItem->dataChanges;
+    ++m_dataChangeNotifications;
+
+    for (const auto handle : std::as_const(monItem->handles))
+        deliverDataChange(handle, monItem, value);
+}
+
+void QOpen62541Subscription::deliverDataChange(quint64 handle, const MonitoredItem *item, const UA_DataValue *value)
+{
+    if (m_backend->m_valueTable)
+        m_backend->writeValueTable(handle, item->attr, value);
+
+    if (m_backend->hasTrendBuffers())
+        m_backend->appendTrendSample(handle, item->attr, value);
+
+    if (m_backend->m_notificationRing) {
+        m_backend->postNotification(handle, item->attr, value);
+        return;
+    }
+
+    if (m_backend->m_typedDataChanges && !m_backend->m_batchDataChanges && value && value != UA_EMPTY_ARRAY_SENTINEL) {
+        QOpcUaScalarDataChange change;
+        if (QOpen62541ValueConverter::toScalarDataChange(*value, &change)) {
+            change.setAttribute(item->attr);
+            emit m_backend->scalarDataChangeOccurred(handle, change);
+            return;
+        }
+    }
+
     QOpcUaReadResult res;
 
+    if (m_backend->m_batchDataChanges) {
+        res.setNodeId(item->nodeId);
+        res.setAttribute(item->attr);
+        res.setIndexRange(item->parameters.indexRange());
+    }
+
     if (!value || value == UA_EMPTY_ARRAY_SENTINEL) {
         res.setStatusCode(QOpcUa::UaStatusCode::Good);
-        emit m_backend->dataChangeOccurred(item.value()->handle, res);
+        if (m_backend->m_batchDataChanges)
+            m_backend->queueDataChange(std::move(res));
+        else
+            emit m_backend->dataChangeOccurred(handle, res);
         return;
     }
 
-    res.setValue(QOpen62541ValueConverter::toQVariant(value->value));
-    res.setAttribute(item.value()->attr);
+    res.setValue(QOpen62541ValueConverter::toQVariant(value->value, m_backend->m_typedNumericArrays));
+    res.setAttribute(item->attr);
     if (value->hasServerTimestamp)
         res.setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->serverTimestamp));
     if (value->hasSourceTimestamp)
         res.setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->sourceTimestamp));
     res.setStatusCode(value->hasStatus ? QOpcUa::UaStatusCode(value->status) : QOpcUa::UaStatusCode::Good);
-    emit m_backend->dataChangeOccurred(item.value()->handle, res);
+    if (m_backend->m_batchDataChanges)
+        m_backend->queueDataChange(std::move(res));
+    else
+        emit m_backend->dataChangeOccurred(handle, res);
 }
 
 void QOpen62541Subscription::sendTimeoutNotification()
 {
     QList<QPair<quint64, QOpcUa::NodeAttribute>> items;
-    for (const auto &it : std::as_const(m_nodeHandleToItemMapping)) {
-        for (auto item : it) {
-            items.push_back({item->handle, item->attr});
+    for (auto it = m_nodeHandleToItemMapping.cbegin(); it != m_nodeHandleToItemMapping.cend(); ++it) {
+        for (auto item : *it) {
+            items.push_back({it.key(), item->attr});
         }
     }
     emit timeout(this, items);
@@ -491,7 +1007,144 @@ void QOpen62541Subscription::eventReceived(UA_UInt32 monId, QVariantList list)
     auto item = m_itemIdToItemMapping.constFind(monId);
     if (item == m_itemIdToItemMapping.constEnd())
         return;
-    emit m_backend->eventOccurred(item.value()->handle, list);
+
+    ++m_eventNotifications;
+
+    for (const auto handle : std::as_const(item.value()->handles))
+        emit m_backend->eventOccurred(handle, list);
+}
+
+void QOpen62541Subscription::processNotificationMessage(const UA_NotificationMessage &message,
+                                                        const UA_UInt32 *availableSequenceNumbers,
+                                                        size_t availableSequenceNumbersSize)
+{
+    const bool isKeepAlive = !message.notificationDataSize;
+    const UA_UInt32 sequenceNumber = message.sequenceNumber;
+
+    switch (m_sequenceTracker.track(sequenceNumber, isKeepAlive)) {
+    case QOpen62541SequenceTracker::Order::Recovered:
+        // The message arrived after the gap has been detected, the republished copy is ignored
+        deliverNotificationMessage(message, true);
+        break;
+    case QOpen62541SequenceTracker::Order::Duplicate:
+        if (!isKeepAlive)
+            m_backend->acknowledgeNotificationMessage(m_subscriptionId, sequenceNumber);
+        return;
+    case QOpen62541SequenceTracker::Order::Gap: {
+        ++m_sequenceGaps;
+        const quint32 missingMessages = m_sequenceTracker.gapSize();
+
+        // Only the messages in the retransmission queue of the server can be republished
+        quint32 requestedMessages = 0;
+        for (size_t i = 0; i < availableSequenceNumbersSize; ++i) {
+            if (m_sequenceTracker.isInGap(availableSequenceNumbers[i]) && requestRepublish(availableSequenceNumbers[i]))
+                ++requestedMessages;
+        }
+
+        if (requestedMessages < missingMessages) {
+            m_unrecoverableMessages += missingMessages - requestedMessages;
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Lost" << missingMessages - requestedMessages
+                                                  << "notification messages of subscription" << m_subscriptionId;
+        }
+
+        m_backend->triggerIterateClient();
+        Q_FALLTHROUGH();
+    }
+    case QOpen62541SequenceTracker::Order::InOrder:
+        if (isKeepAlive)
+            return;
+        deliverNotificationMessage(message, false);
+        break;
+    }
+
+    m_backend->acknowledgeNotificationMessage(m_subscriptionId, sequenceNumber);
+}
+
+bool QOpen62541Subscription::requestRepublish(UA_UInt32 sequenceNumber)
+{
+    UA_RepublishRequest req;
+    UA_RepublishRequest_init(&req);
+    req.requestHeader.timeoutHint = m_backend->m_asyncRequestTimeout;
+    req.subscriptionId = m_subscriptionId;
+    req.retransmitSequenceNumber = sequenceNumber;
+
+    UA_UInt32 requestId = 0;
+    const UA_StatusCode result = __UA_Client_AsyncService(m_backend->m_uaclient, &req, &UA_TYPES[UA_TYPES_REPUBLISHREQUEST],
+                                                          asyncRepublishCallback, &UA_TYPES[UA_TYPES_REPUBLISHRESPONSE],
+                                                          m_backend, &requestId);
+
+    if (result != UA_STATUSCODE_GOOD) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not send Republish request for notification message" << sequenceNumber
+                                              << "of subscription" << m_subscriptionId << ":" << UA_StatusCode_name(result);
+        return false;
+    }
+
+    m_backend->m_asyncRequests.insert(requestId, Open62541AsyncBackend::AsyncRepublishContext{ this, sequenceNumber });
+    m_sequenceTracker.markMissing(sequenceNumber);
+    return true;
+}
+
+void QOpen62541Subscription::republishFinished(UA_UInt32 sequenceNumber, UA_StatusCode serviceResult,
+                                               const UA_NotificationMessage &message)
+{
+    // The original message may have arrived in the meantime
+    if (!m_sequenceTracker.takeMissing(sequenceNumber))
+        return;
+
+    if (serviceResult != UA_STATUSCODE_GOOD) {
+        ++m_unrecoverableMessages;
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not republish notification message" << sequenceNumber
+                                              << "of subscription" << m_subscriptionId << ":" << UA_StatusCode_name(serviceResult);
+        return;
+    }
+
+    ++m_republishedMessages;
+    deliverNotificationMessage(message, true);
+    m_backend->acknowledgeNotificationMessage(m_subscriptionId, sequenceNumber);
+}
+
+void QOpen62541Subscription::deliverNotificationMessage(const UA_NotificationMessage &message, bool republished)
+{
+    for (size_t i = 0; i < message.notificationDataSize; ++i) {
+        const UA_ExtensionObject &data = message.notificationData[i];
+        if (data.encoding != UA_EXTENSIONOBJECT_DECODED && data.encoding != UA_EXTENSIONOBJECT_DECODED_NODELETE)
+            continue;
+
+        if (data.content.decoded.type == &UA_TYPES[UA_TYPES_DATACHANGENOTIFICATION]) {
+            const auto notification = static_cast<UA_DataChangeNotification *>(data.content.decoded.data);
+            for (size_t j = 0; j < notification->monitoredItemsSize; ++j) {
+                UA_MonitoredItemNotification &entry = notification->monitoredItems[j];
+                MonitoredItem *item = m_clientHandleToItemMapping.value(entry.clientHandle);
+                if (!item)
+                    continue;
+
+                // A republished value must not replace a value from a newer message
+                if (republished && item->lastSequenceNumber
+                        && QOpen62541SequenceTracker::isBefore(message.sequenceNumber, item->lastSequenceNumber))
+                    continue;
+
+                item->lastSequenceNumber = message.sequenceNumber;
+                monitoredValueUpdated(item->monitoredItemId, &entry.value);
+            }
+        } else if (data.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTNOTIFICATIONLIST]) {
+            const auto notification = static_cast<UA_EventNotificationList *>(data.content.decoded.data);
+            for (size_t j = 0; j < notification->eventsSize; ++j) {
+                const UA_EventFieldList &entry = notification->events[j];
+                const MonitoredItem *item = m_clientHandleToItemMapping.value(entry.clientHandle);
+                if (!item)
+                    continue;
+
+                QVariantList list;
+                for (size_t k = 0; k < entry.eventFieldsSize; ++k)
+                    list.append(QOpen62541ValueConverter::toQVariant(entry.eventFields[k]));
+                eventReceived(item->monitoredItemId, list);
+            }
+        } else if (data.content.decoded.type == &UA_TYPES[UA_TYPES_STATUSCHANGENOTIFICATION]) {
+            const auto notification = static_cast<UA_StatusChangeNotification *>(data.content.decoded.data);
+            if (notification->status == UA_STATUSCODE_BADTIMEOUT)
+                sendTimeoutNotification();
+        }
+    }
 }
 
 double QOpen62541Subscription::interval() const
@@ -506,7 +1159,57 @@ UA_UInt32 QOpen62541Subscription::subscriptionId() const
 
 int QOpen62541Subscription::monitoredItemsCount() const
 {
-    return m_itemIdToItemMapping.size();
+    return m_itemIdToItemMapping.size() + m_unconfirmedItems.size();
+}
+
+double QOpen62541Subscription::expectedNotifications() const
+{
+    return m_expectedNotifications;
+}
+
+double QOpen62541Subscription::estimateNotifications(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings,
+                                                     double publishingInterval)
+{
+    if (settings.monitoringMode() != QOpcUaMonitoringParameters::MonitoringMode::Reporting)
+        return 0;
+
+    // The rate of events is unknown, they are counted like a value which changes once per publishing interval
+    if (attr == QOpcUa::NodeAttribute::EventNotifier && settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
+        return 1;
+
+    // Values which are sampled faster than they are published are queued up to the queue size
+    const double samplingInterval = settings.samplingInterval() > 0 ? settings.samplingInterval() : publishingInterval;
+    if (samplingInterval <= 0 || publishingInterval <= samplingInterval)
+        return 1;
+
+    const double queueSize = settings.queueSize() ? settings.queueSize() : 1;
+    return std::min(publishingInterval / samplingInterval, queueSize);
+}
+
+void QOpen62541Subscription::setExpectedNotifications(MonitoredItem *item, double expectedNotifications)
+{
+    m_expectedNotifications += expectedNotifications - item->expectedNotifications;
+    item->expectedNotifications = expectedNotifications;
+}
+
+void QOpen62541Subscription::updateExpectedNotifications(MonitoredItem *item)
+{
+    setExpectedNotifications(item, estimateNotifications(item->attr, item->parameters, m_interval));
+}
+
+QOpcUaSubscriptionStatistics QOpen62541Subscription::statistics() const
+{
+    QOpcUaSubscriptionStatistics result;
+    result.setSubscriptionId(m_subscriptionId);
+    result.setPublishingInterval(m_interval);
+    result.setMonitoredItemCount(monitoredItemsCount());
+    result.setExpectedNotificationsPerPublish(m_expectedNotifications);
+    result.setDataChangeNotifications(m_dataChangeNotifications);
+    result.setEventNotifications(m_eventNotifications);
+    result.setSequenceGaps(m_sequenceGaps);
+    result.setRepublishedMessages(m_republishedMessages);
+    result.setUnrecoverableMessages(m_unrecoverableMessages);
+    return result;
 }
 
 QOpcUaMonitoringParameters::SubscriptionType QOpen62541Subscription::shared() const
@@ -528,6 +1231,122 @@ QOpen62541Subscription::MonitoredItem *QOpen62541Subscription::getItemForAttribu
     return item.value();
 }
 
+QOpen62541Subscription::SharingKey QOpen62541Subscription::sharingKey(const QString &nodeId, QOpcUa::NodeAttribute attr,
+                                                                      const QOpcUaMonitoringParameters &settings) const
+{
+    // Event notifications and triggering links are specific to the consumer
+    if (!m_backend->m_shareMonitoredItems || !settings.triggeredItemIds().isEmpty()
+            || settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
+        return SharingKey();
+
+    // All parameters which influence the notifications of the item must match
+    SharingKey key;
+    key.nodeId = nodeId;
+    key.attr = attr;
+    key.indexRange = settings.indexRange();
+    key.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+    key.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
+    key.discardOldest = settings.discardOldest();
+    key.monitoringMode = settings.monitoringMode();
+
+    if (settings.filter().canConvert<QOpcUaMonitoringParameters::DataChangeFilter>()) {
+        const auto filter = settings.filter().value<QOpcUaMonitoringParameters::DataChangeFilter>();
+        key.hasDataChangeFilter = true;
+        key.deadbandType = filter.deadbandType();
+        key.deadbandValue = filter.deadbandValue();
+        key.trigger = filter.trigger();
+    }
+
+    return key;
+}
+
+bool QOpen62541Subscription::hasSharedItem(const QString &nodeId, QOpcUa::NodeAttribute attr,
+                                           const QOpcUaMonitoringParameters &settings) const
+{
+    if (m_sharedItems.isEmpty())
+        return false;
+
+    const SharingKey key = sharingKey(nodeId, attr, settings);
+    return key.isValid() && m_sharedItems.contains(key);
+}
+
+void QOpen62541Subscription::attachToSharedItem(quint64 handle, MonitoredItem *item)
+{
+    item->handles.push_back(handle);
+    m_nodeHandleToItemMapping[handle][item->attr] = item;
+
+    // The consumer is notified together with the others when the server confirms the item
+    if (m_unconfirmedItems.contains(item->clientHandle))
+        return;
+
+    emit m_backend->monitoringEnableDisable(handle, item->attr, true, item->parameters);
+
+    // The server only reports the current value when the item is created
+    readSharedItemValue(handle, item);
+}
+
+void QOpen62541Subscription::readSharedItemValue(quint64 handle, const MonitoredItem *item)
+{
+    if (!m_backend->m_uaclient)
+        return;
+
+    UA_ReadRequest req;
+    UA_ReadRequest_init(&req);
+    UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_clear);
+    req.requestHeader.timeoutHint = m_backend->m_asyncRequestTimeout;
+    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    req.nodesToReadSize = 1;
+    req.nodesToRead = UA_ReadValueId_new();
+    req.nodesToRead->nodeId = Open62541Utils::nodeIdFromQString(item->nodeId);
+    req.nodesToRead->attributeId = QOpen62541ValueConverter::toUaAttributeId(item->attr);
+    if (item->parameters.indexRange().size())
+        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(item->parameters.indexRange(),
+                                                                   &req.nodesToRead->indexRange);
+
+    UA_UInt32 requestId = 0;
+    const UA_StatusCode result = __UA_Client_AsyncService(m_backend->m_uaclient, &req, &UA_TYPES[UA_TYPES_READREQUEST],
+                                                          asyncSharedItemReadCallback, &UA_TYPES[UA_TYPES_READRESPONSE],
+                                                          m_backend, &requestId);
+
+    // The consumer receives the next notification of the item instead
+    if (result != UA_STATUSCODE_GOOD) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not read the current value of" << item->attr << "of node"
+                                              << item->nodeId << ":" << UA_StatusCode_name(result);
+        return;
+    }
+
+    m_backend->m_asyncRequests.insert(requestId, Open62541AsyncBackend::AsyncSharedItemReadContext{
+                                          this, handle, item->attr, item->clientHandle, item->dataChanges });
+    m_backend->triggerIterateClient();
+}
+
+void QOpen62541Subscription::sharedItemValueRead(quint64 handle, QOpcUa::NodeAttribute attr, UA_UInt32 clientHandle,
+                                                 quint64 dataChanges, UA_StatusCode serviceResult,
+                                                 const UA_DataValue *value)
+{
+    // The consumer may have left the item, or the item has already delivered a newer value
+    const MonitoredItem *item = getItemForAttribute(handle, attr);
+    if (!item || item->clientHandle != clientHandle || item->dataChanges != dataChanges)
+        return;
+
+    if (serviceResult != UA_STATUSCODE_GOOD || !value) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not read the current value of" << attr << "of node"
+                                              << item->nodeId << ":" << UA_StatusCode_name(serviceResult);
+        return;
+    }
+
+    deliverDataChange(handle, item, value);
+}
+
+void QOpen62541Subscription::unshareItem(MonitoredItem *item)
+{
+    if (!item->sharingKey.isValid())
+        return;
+
+    m_sharedItems.remove(item->sharingKey);
+    item->sharingKey = SharingKey();
+}
+
 UA_ExtensionObject QOpen62541Subscription::createFilter(const QVariant &filterData)
 {
     UA_ExtensionObject obj;
@@ -560,7 +1379,7 @@ void QOpen62541Subscription::createDataChangeFilter(const QOpcUaMonitoringParame
     out->content.decoded.data = uaFilter;
 }
 
-QOpcUaEventFilterResult QOpen62541Subscription::convertEventFilterResult(UA_ExtensionObject *obj)
+QOpcUaEventFilterResult QOpen62541Subscription::convertEventFilterResult(const UA_ExtensionObject *obj)
 {
     QOpcUaEventFilterResult result;
 
@@ -682,7 +1501,15 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
 
             m_lifetimeCount = res.revisedLifetimeCount;
             m_maxKeepaliveCount = res.revisedMaxKeepAliveCount;
-            m_interval = res.revisedPublishingInterval;
+            if (!qFuzzyCompare(res.revisedPublishingInterval, m_interval)) {
+                m_interval = res.revisedPublishingInterval;
+                for (auto it : std::as_const(m_itemIdToItemMapping))
+                    updateExpectedNotifications(it);
+                for (auto it : std::as_const(m_unconfirmedItems)) {
+                    if (!it->removeRequested)
+                        updateExpectedNotifications(it);
+                }
+            }
             if (item == QOpcUaMonitoringParameters::Parameter::Priority)
                 m_priority = value.toUInt();
             if (item == QOpcUaMonitoringParameters::Parameter::MaxNotificationsPerPublish)
@@ -696,138 +1523,289 @@ bool QOpen62541Subscription::modifySubscriptionParameters(quint64 nodeHandle, QO
             p.setPriority(m_priority);
             p.setMaxNotificationsPerPublish(m_maxNotificationsPerPublish);
 
-            for (auto it : std::as_const(m_itemIdToItemMapping))
-                emit m_backend->monitoringStatusChanged(it->handle, it->attr, changed, p);
+            for (auto it : std::as_const(m_itemIdToItemMapping)) {
+                for (const auto handle : std::as_const(it->handles))
+                    emit m_backend->monitoringStatusChanged(handle, it->attr, changed, p);
+            }
         }
         return true;
     }
     return false;
 }
 
-bool QOpen62541Subscription::modifyMonitoredItemParameters(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value)
+QOpcUaMonitoringParameters::Parameters QOpen62541Subscription::applyModifyResult(MonitoredItem *monItem,
+                                                                                 QOpcUaMonitoringParameters::Parameter item,
+                                                                                 const QVariant &value,
+                                                                                 const UA_MonitoredItemModifyResult &result)
 {
-    MonitoredItem *monItem = getItemForAttribute(nodeHandle, attr);
-    QOpcUaMonitoringParameters p = monItem->parameters;
+    QOpcUaMonitoringParameters &p = monItem->parameters;
+    p.setStatusCode(QOpcUa::UaStatusCode::Good);
 
-    UA_ModifyMonitoredItemsRequest req;
-    UA_ModifyMonitoredItemsRequest_init(&req);
-    UaDeleter<UA_ModifyMonitoredItemsRequest> requestDeleter(&req, UA_ModifyMonitoredItemsRequest_clear);
-    req.subscriptionId = m_subscriptionId;
-    req.itemsToModifySize = 1;
-    req.itemsToModify = UA_MonitoredItemModifyRequest_new();
-    UA_MonitoredItemModifyRequest_init(req.itemsToModify);
-    req.itemsToModify->monitoredItemId = monItem->monitoredItemId;
-    req.itemsToModify->requestedParameters.discardOldest = monItem->parameters.discardOldest();
-    req.itemsToModify->requestedParameters.queueSize = monItem->parameters.queueSize();
-    req.itemsToModify->requestedParameters.samplingInterval = monItem->parameters.samplingInterval();
-    req.itemsToModify->monitoredItemId = monItem->monitoredItemId;
-    req.itemsToModify->requestedParameters.clientHandle = monItem->clientHandle;
+    QOpcUaMonitoringParameters::Parameters changed = item;
+    if (!qFuzzyCompare(p.samplingInterval(), result.revisedSamplingInterval)) {
+        p.setSamplingInterval(result.revisedSamplingInterval);
+        changed |= QOpcUaMonitoringParameters::Parameter::SamplingInterval;
+    }
+    if (p.queueSize() != result.revisedQueueSize) {
+        p.setQueueSize(result.revisedQueueSize);
+        changed |= QOpcUaMonitoringParameters::Parameter::QueueSize;
+    }
 
-    bool match = true;
+    if (item == QOpcUaMonitoringParameters::Parameter::DiscardOldest) {
+        p.setDiscardOldest(value.toBool());
+        changed |= QOpcUaMonitoringParameters::Parameter::DiscardOldest;
+    }
+
+    if (item == QOpcUaMonitoringParameters::Parameter::Filter) {
+        changed |= QOpcUaMonitoringParameters::Parameter::Filter;
+        if (value.canConvert<QOpcUaMonitoringParameters::DataChangeFilter>())
+            p.setFilter(value.value<QOpcUaMonitoringParameters::DataChangeFilter>());
+        else if (value.canConvert<QOpcUaMonitoringParameters::EventFilter>())
+            p.setFilter(value.value<QOpcUaMonitoringParameters::EventFilter>());
+        if (result.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
+            p.setFilterResult(convertEventFilterResult(&result.filterResult));
+    }
+
+    updateExpectedNotifications(monItem);
+
+    return changed;
+}
 
+void QOpen62541Subscription::modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                                  QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    const auto reportError = [this, attr, item](quint64 handle, QOpcUa::UaStatusCode statusCode) {
+        QOpcUaMonitoringParameters p;
+        p.setStatusCode(statusCode);
+        emit m_backend->monitoringStatusChanged(handle, attr, item, p);
+    };
+
+    bool validValue = false;
     switch (item) {
-    case QOpcUaMonitoringParameters::Parameter::DiscardOldest: {
-        if (value.metaType().id() != QMetaType::Bool) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify DiscardOldest, value is not a bool";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-            return true;
-        }
-        req.itemsToModify->requestedParameters.discardOldest = value.toBool();
+    case QOpcUaMonitoringParameters::Parameter::MonitoringMode:
+        validValue = value.userType() == QMetaType::fromType<QOpcUaMonitoringParameters::MonitoringMode>().id();
         break;
-    }
-    case QOpcUaMonitoringParameters::Parameter::QueueSize: {
-        if (value.metaType().id() != QMetaType::UInt) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify QueueSize, value is not an integer";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-            return true;
-        }
-        req.itemsToModify->requestedParameters.queueSize = value.toUInt();
+    case QOpcUaMonitoringParameters::Parameter::DiscardOldest:
+        validValue = value.metaType().id() == QMetaType::Bool;
         break;
-    }
-    case QOpcUaMonitoringParameters::Parameter::SamplingInterval: {
-        if (value.metaType().id() != QMetaType::Double) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify SamplingInterval, value is not a double";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadTypeMismatch);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-            return true;
-        }
-        req.itemsToModify->requestedParameters.samplingInterval = value.toDouble();
+    case QOpcUaMonitoringParameters::Parameter::QueueSize:
+        validValue = value.metaType().id() == QMetaType::UInt;
         break;
-    }
-    case QOpcUaMonitoringParameters::Parameter::Filter: {
-        UA_ExtensionObject filter = createFilter(value);
-        if (filter.content.decoded.data)
-            req.itemsToModify->requestedParameters.filter = filter;
-        else {
-            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to modify filter, filter creation failed";
-            p.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-            return true;
-        }
+    case QOpcUaMonitoringParameters::Parameter::SamplingInterval:
+        validValue = value.metaType().id() == QMetaType::Double;
         break;
-    }
-    default:
-        match = false;
+    case QOpcUaMonitoringParameters::Parameter::Filter:
+        validValue = value.canConvert<QOpcUaMonitoringParameters::DataChangeFilter>()
+                || value.canConvert<QOpcUaMonitoringParameters::EventFilter>();
         break;
+    default:
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Modifying" << item << "is not supported for multiple monitored items";
+        for (const auto handle : handles)
+            reportError(handle, QOpcUa::UaStatusCode::BadNotSupported);
+        return;
     }
 
-    if (match) {
-        if (item != QOpcUaMonitoringParameters::Parameter::Filter && p.filter().isValid()) {
-            UA_ExtensionObject filter = createFilter(monItem->parameters.filter());
-            if (filter.content.decoded.data)
-                req.itemsToModify->requestedParameters.filter = filter;
-            else {
-                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify monitored item, filter creation failed";
-                p.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
-                emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-                return true;
-            }
+    if (!validValue) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify" << item << ", the value has the wrong type";
+        for (const auto handle : handles)
+            reportError(handle, QOpcUa::UaStatusCode::BadTypeMismatch);
+        return;
+    }
+
+    QList<MonitoredItem *> items;
+    QHash<MonitoredItem *, QList<quint64>> requestedHandles;
+    for (const auto handle : handles) {
+        MonitoredItem *monItem = getItemForAttribute(handle, attr);
+        if (!monItem || m_unconfirmedItems.contains(monItem->clientHandle)) {
+            reportError(handle, QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+            continue;
         }
 
-        UA_ModifyMonitoredItemsResponse res = UA_Client_MonitoredItems_modify(m_backend->m_uaclient, req);
-        UaDeleter<UA_ModifyMonitoredItemsResponse> responseDeleter(
-                    &res, UA_ModifyMonitoredItemsResponse_clear);
+        auto &entry = requestedHandles[monItem];
+        if (entry.contains(handle))
+            continue;
+        if (entry.isEmpty())
+            items.push_back(monItem);
+        entry.push_back(handle);
+    }
 
-        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD || res.results[0].statusCode != UA_STATUSCODE_GOOD) {
-            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult == UA_STATUSCODE_GOOD ? res.results[0].statusCode : res.responseHeader.serviceResult));
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, item, p);
-            return true;
-        } else {
-            p.setStatusCode(QOpcUa::UaStatusCode::Good);
-            QOpcUaMonitoringParameters::Parameters changed = item;
-            if (!qFuzzyCompare(p.samplingInterval(), res.results[0].revisedSamplingInterval)) {
-                p.setSamplingInterval(res.results[0].revisedSamplingInterval);
-                changed |= QOpcUaMonitoringParameters::Parameter::SamplingInterval;
-            }
-            if (p.queueSize() != res.results[0].revisedQueueSize) {
-                p.setQueueSize(res.results[0].revisedQueueSize);
-                changed |= QOpcUaMonitoringParameters::Parameter::QueueSize;
-            }
+    // A shared item is only modified if all of its consumers are part of the request
+    items.removeIf([&](MonitoredItem *monItem) {
+        const auto &entry = requestedHandles[monItem];
+        if (entry.size() == monItem->handles.size())
+            return false;
 
-            if (item == QOpcUaMonitoringParameters::Parameter::DiscardOldest) {
-                p.setDiscardOldest(value.toBool());
-                changed |= QOpcUaMonitoringParameters::Parameter::DiscardOldest;
-            }
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify" << item << "of" << monItem->nodeId
+                                              << ", the monitored item is shared with other consumers";
+        for (const auto handle : entry)
+            reportError(handle, QOpcUa::UaStatusCode::BadNotSupported);
+        return true;
+    });
 
-            if (item == QOpcUaMonitoringParameters::Parameter::Filter) {
-                changed |= QOpcUaMonitoringParameters::Parameter::Filter;
-                if (value.canConvert<QOpcUaMonitoringParameters::DataChangeFilter>())
-                    p.setFilter(value.value<QOpcUaMonitoringParameters::DataChangeFilter>());
-                else if (value.canConvert<QOpcUaMonitoringParameters::EventFilter>())
-                    p.setFilter(value.value<QOpcUaMonitoringParameters::EventFilter>());
-                if (res.results[0].filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
-                    p.setFilterResult(convertEventFilterResult(&res.results[0].filterResult));
-            }
+    // The parameters of the items may no longer match their sharing keys
+    for (auto monItem : std::as_const(items))
+        unshareItem(monItem);
+
+    // The items are identified by one of their consumers, an item may be removed before a queued request is sent
+    QList<quint64> itemHandles;
+    itemHandles.reserve(items.size());
+    for (const auto monItem : std::as_const(items))
+        itemHandles.push_back(requestedHandles.value(monItem).constFirst());
 
-            emit m_backend->monitoringStatusChanged(nodeHandle, attr, changed, p);
+    const quint32 maxItemsPerCall = m_backend->maxMonitoredItemsPerCall();
+    const qsizetype chunkSize = maxItemsPerCall ? maxItemsPerCall : itemHandles.size();
+
+    for (qsizetype offset = 0; offset < itemHandles.size(); offset += chunkSize)
+        dispatchModifyMonitoredItems(itemHandles.mid(offset, chunkSize), attr, item, value);
+}
+
+void QOpen62541Subscription::dispatchModifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                                          QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
+{
+    if (!m_backend->admitRequest(Open62541AsyncBackend::RequestPriority::Normal,
+                                 [self = QPointer<QOpen62541Subscription>(this), handles, attr, item, value]() {
+            // The consumers have already been notified if the subscription is gone
+            if (self)
+                self->dispatchModifyMonitoredItems(handles, attr, item, value);
+        }))
+        return;
 
-            monItem->parameters = p;
+    QList<MonitoredItem *> items;
+    QList<quint64> itemHandles;
+    QList<UA_UInt32> monitoredItemIds;
+    items.reserve(handles.size());
+    itemHandles.reserve(handles.size());
+    monitoredItemIds.reserve(handles.size());
+    for (const auto handle : handles) {
+        // Consumers of items which have been removed while the request was queued have already been notified
+        MonitoredItem *monItem = getItemForAttribute(handle, attr);
+        if (!monItem || m_unconfirmedItems.contains(monItem->clientHandle))
+            continue;
+        items.push_back(monItem);
+        itemHandles.push_back(handle);
+        monitoredItemIds.push_back(monItem->monitoredItemId);
+    }
+
+    if (items.isEmpty())
+        return;
+
+    if (!m_backend->m_uaclient) {
+        modifyMonitoredItemsFinished(attr, itemHandles, monitoredItemIds, item, value, UA_STATUSCODE_BADDISCONNECT,
+                                     nullptr, nullptr, 0);
+        return;
+    }
+
+    UA_UInt32 requestId = 0;
+    UA_StatusCode result;
+
+    if (item == QOpcUaMonitoringParameters::Parameter::MonitoringMode) {
+        UA_SetMonitoringModeRequest req;
+        UA_SetMonitoringModeRequest_init(&req);
+        UaDeleter<UA_SetMonitoringModeRequest> requestDeleter(&req, UA_SetMonitoringModeRequest_clear);
+        req.requestHeader.timeoutHint = m_backend->m_asyncRequestTimeout;
+        req.subscriptionId = m_subscriptionId;
+        req.monitoringMode = static_cast<UA_MonitoringMode>(value.value<QOpcUaMonitoringParameters::MonitoringMode>());
+        req.monitoredItemIdsSize = items.size();
+        req.monitoredItemIds = static_cast<UA_UInt32 *>(UA_Array_new(items.size(), &UA_TYPES[UA_TYPES_UINT32]));
+        std::copy(monitoredItemIds.cbegin(), monitoredItemIds.cend(), req.monitoredItemIds);
+
+        result = UA_Client_MonitoredItems_setMonitoringMode_async(m_backend->m_uaclient, req, asyncSetMonitoringModeCallback,
+                                                                  m_backend, &requestId);
+        if (result == UA_STATUSCODE_GOOD)
+            m_backend->m_asyncRequests.insert(requestId, Open62541AsyncBackend::AsyncSetMonitoringModeContext{
+                                                  this, attr, item, value, itemHandles, monitoredItemIds });
+    } else {
+        UA_ModifyMonitoredItemsRequest req;
+        UA_ModifyMonitoredItemsRequest_init(&req);
+        UaDeleter<UA_ModifyMonitoredItemsRequest> requestDeleter(&req, UA_ModifyMonitoredItemsRequest_clear);
+        req.requestHeader.timeoutHint = m_backend->m_asyncRequestTimeout;
+        req.subscriptionId = m_subscriptionId;
+        req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+        req.itemsToModifySize = items.size();
+        req.itemsToModify = static_cast<UA_MonitoredItemModifyRequest *>(
+                    UA_Array_new(items.size(), &UA_TYPES[UA_TYPES_MONITOREDITEMMODIFYREQUEST]));
+
+        for (qsizetype i = 0; i < items.size(); ++i) {
+            const MonitoredItem *monItem = items.at(i);
+            UA_MonitoredItemModifyRequest &entry = req.itemsToModify[i];
+            entry.monitoredItemId = monItem->monitoredItemId;
+            entry.requestedParameters.clientHandle = monItem->clientHandle;
+            entry.requestedParameters.samplingInterval = item == QOpcUaMonitoringParameters::Parameter::SamplingInterval
+                    ? value.toDouble() : monItem->parameters.samplingInterval();
+            entry.requestedParameters.queueSize = item == QOpcUaMonitoringParameters::Parameter::QueueSize
+                    ? value.toUInt() : monItem->parameters.queueSize();
+            entry.requestedParameters.discardOldest = item == QOpcUaMonitoringParameters::Parameter::DiscardOldest
+                    ? value.toBool() : monItem->parameters.discardOldest();
+
+            // The filter of the item must be sent again, otherwise it is removed by the server
+            const QVariant filter = item == QOpcUaMonitoringParameters::Parameter::Filter ? value : monItem->parameters.filter();
+            if (filter.isValid())
+                entry.requestedParameters.filter = createFilter(filter);
         }
-        return true;
+
+        // The items created for the publish loop of the backend are unknown to the SDK, the request
+        // is sent unchanged to keep the client handles which are needed to dispatch the notifications
+        if (m_backend->m_recoverMissingNotifications)
+            result = __UA_Client_AsyncService(m_backend->m_uaclient, &req, &UA_TYPES[UA_TYPES_MODIFYMONITOREDITEMSREQUEST],
+                                              asyncModifyMonitoredItemsCallback,
+                                              &UA_TYPES[UA_TYPES_MODIFYMONITOREDITEMSRESPONSE], m_backend, &requestId);
+        else
+            result = UA_Client_MonitoredItems_modify_async(m_backend->m_uaclient, req, asyncModifyMonitoredItemsCallback,
+                                                           m_backend, &requestId);
+        if (result == UA_STATUSCODE_GOOD)
+            m_backend->m_asyncRequests.insert(requestId, Open62541AsyncBackend::AsyncModifyMonitoredItemsContext{
+                                                  this, attr, item, value, itemHandles, monitoredItemIds });
+    }
+
+    if (result != UA_STATUSCODE_GOOD) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not send the request to modify" << item << "of" << items.size()
+                                              << "monitored items:" << UA_StatusCode_name(result);
+        modifyMonitoredItemsFinished(attr, itemHandles, monitoredItemIds, item, value, result, nullptr, nullptr, 0);
+        return;
+    }
+
+    m_backend->triggerIterateClient();
+}
+
+void QOpen62541Subscription::modifyMonitoredItemsFinished(QOpcUa::NodeAttribute attr, const QList<quint64> &handles,
+                                                          const QList<UA_UInt32> &monitoredItemIds,
+                                                          QOpcUaMonitoringParameters::Parameter item, const QVariant &value,
+                                                          UA_StatusCode serviceResult, const UA_StatusCode *modeResults,
+                                                          const UA_MonitoredItemModifyResult *modifyResults, size_t resultsSize)
+{
+    for (qsizetype i = 0; i < handles.size(); ++i) {
+        // Consumers of items which have been removed or recreated in the meantime have already been notified
+        MonitoredItem *monItem = getItemForAttribute(handles.at(i), attr);
+        if (!monItem || monItem->monitoredItemId != monitoredItemIds.at(i))
+            continue;
+
+        UA_StatusCode status = serviceResult;
+        if (status == UA_STATUSCODE_GOOD && static_cast<size_t>(i) >= resultsSize)
+            status = UA_STATUSCODE_BADINTERNALERROR;
+        else if (status == UA_STATUSCODE_GOOD)
+            status = modeResults ? modeResults[i] : modifyResults[i].statusCode;
+
+        QOpcUaMonitoringParameters::Parameters changed = item;
+        QOpcUaMonitoringParameters p;
+
+        if (status == UA_STATUSCODE_GOOD) {
+            if (modeResults) {
+                monItem->parameters.setMonitoringMode(value.value<QOpcUaMonitoringParameters::MonitoringMode>());
+                updateExpectedNotifications(monItem);
+            } else
+                changed = applyModifyResult(monItem, item, value, modifyResults[i]);
+            p = monItem->parameters;
+            p.setStatusCode(QOpcUa::UaStatusCode::Good);
+        } else {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify" << item << "of" << monItem->nodeId << ":"
+                                                  << UA_StatusCode_name(status);
+            p = monItem->parameters;
+            p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+        }
+
+        for (const auto handle : std::as_const(monItem->handles))
+            emit m_backend->monitoringStatusChanged(handle, monItem->attr, changed, p);
     }
-    return false;
 }
 
 QT_END_NAMESPACE
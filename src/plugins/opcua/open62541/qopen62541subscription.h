@@ -5,7 +5,13 @@
 #define QOPEN62541SUBSCRIPTION_H
 
 #include "qopen62541.h"
+#include "qopen62541sequencetracker.h"
 #include <QtOpcUa/qopcuanode.h>
+#include <QtOpcUa/qopcuasubscriptionstatistics.h>
+
+#include <QtCore/qhashfunctions.h>
+#include <QtCore/qset.h>
+#include <QtCore/qtimer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -25,38 +31,128 @@ public:
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
 
     bool addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings);
-    bool removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
+
+    // Batched variants, the requests are collected and sent asynchronously on the next event loop iteration
+    bool queueAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, const QOpcUaMonitoringParameters &settings);
+    bool queueRemoveAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
+    void flushPendingMonitoredItems();
+
+    // Modifies the items of all handles with one ModifyMonitoredItems or SetMonitoringMode call per chunk
+    void modifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attr,
+                              QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
+    void modifyMonitoredItemsFinished(QOpcUa::NodeAttribute attr, const QList<quint64> &handles,
+                                      const QList<UA_UInt32> &monitoredItemIds, QOpcUaMonitoringParameters::Parameter item,
+                                      const QVariant &value, UA_StatusCode serviceResult, const UA_StatusCode *modeResults,
+                                      const UA_MonitoredItemModifyResult *modifyResults, size_t resultsSize);
 
     void monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value);
     void eventReceived(UA_UInt32 monId, QVariantList list);
 
     void sendTimeoutNotification();
 
+    // Used by the publish loop of the backend if missing notifications are recovered
+    void processNotificationMessage(const UA_NotificationMessage &message, const UA_UInt32 *availableSequenceNumbers,
+                                    size_t availableSequenceNumbersSize);
+    void republishFinished(UA_UInt32 sequenceNumber, UA_StatusCode serviceResult, const UA_NotificationMessage &message);
+    void sharedItemValueRead(quint64 handle, QOpcUa::NodeAttribute attr, UA_UInt32 clientHandle, quint64 dataChanges,
+                             UA_StatusCode serviceResult, const UA_DataValue *value);
+
+    // The parameters which must match for sharing a monitored item, the node id is empty if the item can't be shared
+    struct SharingKey {
+        QString nodeId;
+        QString indexRange;
+        double samplingInterval = 0;
+        double deadbandValue = 0;
+        quint32 queueSize = 0;
+        QOpcUa::NodeAttribute attr = QOpcUa::NodeAttribute::None;
+        QOpcUaMonitoringParameters::MonitoringMode monitoringMode = QOpcUaMonitoringParameters::MonitoringMode::Reporting;
+        QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType deadbandType =
+                QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::None;
+        QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger trigger =
+                QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger::Status;
+        bool discardOldest = false;
+        bool hasDataChangeFilter = false;
+
+        bool isValid() const { return !nodeId.isEmpty(); }
+
+        friend bool operator==(const SharingKey &lhs, const SharingKey &rhs) noexcept
+        {
+            // The intervals and deadbands are requested values which must match exactly
+            QT_WARNING_PUSH
+            QT_WARNING_DISABLE_FLOAT_COMPARE
+            return lhs.nodeId == rhs.nodeId && lhs.indexRange == rhs.indexRange
+                    && lhs.samplingInterval == rhs.samplingInterval && lhs.deadbandValue == rhs.deadbandValue
+                    && lhs.queueSize == rhs.queueSize && lhs.attr == rhs.attr
+                    && lhs.monitoringMode == rhs.monitoringMode && lhs.deadbandType == rhs.deadbandType
+                    && lhs.trigger == rhs.trigger && lhs.discardOldest == rhs.discardOldest
+                    && lhs.hasDataChangeFilter == rhs.hasDataChangeFilter;
+            QT_WARNING_POP
+        }
+        friend bool operator!=(const SharingKey &lhs, const SharingKey &rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend size_t qHash(const SharingKey &key, size_t seed = 0) noexcept
+        {
+            // The remaining parameters rarely differ between items of the same node id
+            return qHashMulti(seed, key.nodeId, key.indexRange, static_cast<int>(key.attr), key.samplingInterval);
+        }
+    };
+
     struct MonitoredItem {
-        quint64 handle;
+        QList<quint64> handles; // More than one if the item is shared
         QOpcUa::NodeAttribute attr;
         UA_UInt32 monitoredItemId;
         UA_UInt32 clientHandle;
         QOpcUaMonitoringParameters parameters;
+        QString nodeId;
+        bool removeRequested;
+        SharingKey sharingKey; // Invalid if the item can't be shared
+        quint64 dataChanges; // A value read for a consumer which joins a shared item is outdated if this has changed
+        QList<quint64> detachedHandles; // Consumers which left the item before it was confirmed
+        double expectedNotifications; // Contribution to the expected notifications of the subscription
+        UA_UInt32 lastSequenceNumber; // Notification message of the last data change, keeps republished values from overwriting newer ones
         MonitoredItem(quint64 h, QOpcUa::NodeAttribute a, UA_UInt32 id)
-            : handle(h)
+            : handles{h}
             , attr(a)
             , monitoredItemId(id)
+            , removeRequested(false)
+            , dataChanges(0)
+            , expectedNotifications(0)
+            , lastSequenceNumber(0)
         {}
         MonitoredItem()
-            : handle(0)
-            , monitoredItemId(0)
+            : monitoredItemId(0)
+            , removeRequested(false)
+            , dataChanges(0)
+            , expectedNotifications(0)
+            , lastSequenceNumber(0)
         {}
+        Q_DISABLE_COPY(MonitoredItem)
     };
 
+    void createMonitoredItemsFinished(const QList<UA_UInt32> &clientHandles, UA_StatusCode serviceResult,
+                                      const UA_MonitoredItemCreateResult *results, size_t resultsSize);
+
     double interval() const;
     UA_UInt32 subscriptionId() const;
     int monitoredItemsCount() const;
+    // Returns true if a monitored item with these parameters exists and accepts further consumers
+    bool hasSharedItem(const QString &nodeId, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings) const;
+
+    // Notifications per publishing interval if all items change as fast as they are sampled
+    double expectedNotifications() const;
+    static double estimateNotifications(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings,
+                                        double publishingInterval);
+
+    QOpcUaSubscriptionStatistics statistics() const;
 
     QOpcUaMonitoringParameters::SubscriptionType shared() const;
 
 signals:
     void timeout(QOpen62541Subscription *sub, QList<QPair<quint64, QOpcUa::NodeAttribute>> items);
+    // Emitted if items have been dropped after a batched request, the items must be removed from the attribute mapping
+    void monitoredItemsReleased(QOpen62541Subscription *sub, QList<QPair<quint64, QOpcUa::NodeAttribute>> items);
 
 private:
     MonitoredItem *getItemForAttribute(quint64 nodeHandle, QOpcUa::NodeAttribute attr);
@@ -64,8 +160,27 @@ private:
     void createDataChangeFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter, UA_ExtensionObject *out);
 
     bool modifySubscriptionParameters(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
-    bool modifyMonitoredItemParameters(quint64 nodeHandle, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters::Parameter &item, const QVariant &value);
-    QOpcUaEventFilterResult convertEventFilterResult(UA_ExtensionObject *obj);
+    QOpcUaEventFilterResult convertEventFilterResult(const UA_ExtensionObject *obj);
+    QOpcUaMonitoringParameters revisedParameters(const MonitoredItem *item, const UA_MonitoredItemCreateResult &res);
+    QOpcUaMonitoringParameters::Parameters applyModifyResult(MonitoredItem *monItem, QOpcUaMonitoringParameters::Parameter item,
+                                                             const QVariant &value, const UA_MonitoredItemModifyResult &result);
+
+    SharingKey sharingKey(const QString &nodeId, QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings) const;
+    void attachToSharedItem(quint64 handle, MonitoredItem *item);
+    void readSharedItemValue(quint64 handle, const MonitoredItem *item);
+    void unshareItem(MonitoredItem *item);
+    void deliverDataChange(quint64 handle, const MonitoredItem *item, const UA_DataValue *value);
+    void setExpectedNotifications(MonitoredItem *item, double expectedNotifications);
+    void updateExpectedNotifications(MonitoredItem *item);
+
+    void deliverNotificationMessage(const UA_NotificationMessage &message, bool republished);
+    bool requestRepublish(UA_UInt32 sequenceNumber);
+
+    void dispatchCreateMonitoredItems(bool events);
+    void dispatchDeleteMonitoredItems();
+    // handles contains one consumer per monitored item
+    void dispatchModifyMonitoredItems(const QList<quint64> &handles, QOpcUa::NodeAttribute attr,
+                                      QOpcUaMonitoringParameters::Parameter item, const QVariant &value);
 
     Open62541AsyncBackend *m_backend;
     double m_interval;
@@ -78,9 +193,30 @@ private:
 
     QHash<quint64, QHash<QOpcUa::NodeAttribute, MonitoredItem *>> m_nodeHandleToItemMapping; // Handle -> Attribute -> MonitoredItem
     QHash<UA_UInt32, MonitoredItem *> m_itemIdToItemMapping; // ItemId -> Item for fast lookup on data change
+    QHash<UA_UInt32, MonitoredItem *> m_clientHandleToItemMapping; // ClientHandle -> Item for the publish loop of the backend
+    QHash<SharingKey, MonitoredItem *> m_sharedItems; // Sharing key -> Item which accepts further consumers
+
+    struct PendingCreate {
+        MonitoredItem *item;
+        UA_MonitoredItemCreateRequest request;
+        bool isEvent;
+    };
+    QList<PendingCreate> m_pendingCreates; // Not yet sent to the server
+    QHash<UA_UInt32, MonitoredItem *> m_unconfirmedItems; // ClientHandle -> Item, queued or in flight, not yet in m_itemIdToItemMapping
+    QList<MonitoredItem *> m_pendingDeletes; // Detached from the mappings, waiting to be deleted on the server
+    QTimer m_flushTimer;
 
     quint32 m_clientHandle;
     bool m_timeout;
+
+    double m_expectedNotifications;
+    quint64 m_dataChangeNotifications;
+    quint64 m_eventNotifications;
+
+    QOpen62541SequenceTracker m_sequenceTracker;
+    quint64 m_sequenceGaps;
+    quint64 m_republishedMessages;
+    quint64 m_unrecoverableMessages;
 };
 
 QT_END_NAMESPACE
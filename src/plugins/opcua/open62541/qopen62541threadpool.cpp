@@ -0,0 +1,90 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qopen62541threadpool.h"
+
+#include <QtCore/qobject.h>
+#include <QtCore/qthread.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+QOpen62541ThreadPool::QOpen62541ThreadPool(quint32 threadCount)
+{
+    for (quint32 i = 0; i < std::max<quint32>(1, threadCount); ++i) {
+        auto slot = std::make_unique<Slot>();
+        slot->thread = new QThread();
+        slot->thread->setObjectName(QStringLiteral("QOpen62541ThreadPool %1").arg(i));
+        slot->context = new QObject();
+        slot->context->moveToThread(slot->thread);
+        slot->thread->start();
+        m_slots.push_back(std::move(slot));
+    }
+}
+
+QOpen62541ThreadPool::~QOpen62541ThreadPool()
+{
+    for (const auto &slot : m_slots) {
+        slot->thread->quit();
+        slot->thread->wait();
+        delete slot->context;
+        delete slot->thread;
+    }
+}
+
+std::shared_ptr<QOpen62541ThreadPool> QOpen62541ThreadPool::instance(quint32 threadCount)
+{
+    Q_CONSTINIT static QBasicMutex mutex;
+    Q_CONSTINIT static std::weak_ptr<QOpen62541ThreadPool> sharedPool;
+
+    const QMutexLocker locker(&mutex);
+
+    auto pool = sharedPool.lock();
+    if (!pool) {
+        pool = std::make_shared<QOpen62541ThreadPool>(threadCount);
+        sharedPool = pool;
+    }
+
+    return pool;
+}
+
+QOpen62541ThreadPool::Slot *QOpen62541ThreadPool::attach(QObject *object)
+{
+    const QMutexLocker locker(&m_mutex);
+
+    Slot *best = nullptr;
+    quint64 bestBusyTime = 0;
+
+    for (const auto &slot : m_slots) {
+        const quint64 busyTime = slot->busyTimeNs.load(std::memory_order_relaxed);
+        const quint64 recentBusyTime = busyTime - slot->sampledBusyTimeNs;
+        slot->sampledBusyTimeNs = busyTime;
+
+        if (!best || recentBusyTime < bestBusyTime
+                || (recentBusyTime == bestBusyTime && slot->backendCount < best->backendCount)) {
+            best = slot.get();
+            bestBusyTime = recentBusyTime;
+        }
+    }
+
+    ++best->backendCount;
+    object->moveToThread(best->thread);
+
+    return best;
+}
+
+void QOpen62541ThreadPool::detach(Slot *slot, QObject *object)
+{
+    if (QThread::currentThread() == slot->thread) {
+        delete object;
+    } else {
+        // The object is deleted by the event loop of its thread before the call returns
+        QMetaObject::invokeMethod(slot->context, [object] { delete object; }, Qt::BlockingQueuedConnection);
+    }
+
+    const QMutexLocker locker(&m_mutex);
+    --slot->backendCount;
+}
+
+QT_END_NAMESPACE
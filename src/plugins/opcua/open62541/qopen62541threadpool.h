@@ -0,0 +1,56 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QOPEN62541THREADPOOL_H
+#define QOPEN62541THREADPOOL_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qmutex.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+class QObject;
+class QThread;
+
+// A fixed number of threads which is shared by the backends of all clients using the
+// sharedThreadPoolSize backend property.
+//
+// A backend stays on the thread it has been attached to for its whole lifetime. New backends
+// are attached to the thread which has spent the least time in UA_Client_run_iterate() since
+// the previous attach, ties are broken by the number of attached backends.
+class QOpen62541ThreadPool
+{
+public:
+    struct Slot {
+        QThread *thread = nullptr;
+        QObject *context = nullptr; // Lives in thread
+        quint32 backendCount = 0;
+        std::atomic<quint64> busyTimeNs {0}; // Updated by the backends
+        quint64 sampledBusyTimeNs = 0;
+    };
+
+    explicit QOpen62541ThreadPool(quint32 threadCount);
+    ~QOpen62541ThreadPool();
+
+    // Returns the shared pool, the thread count is only used if the pool doesn't exist yet
+    static std::shared_ptr<QOpen62541ThreadPool> instance(quint32 threadCount);
+
+    // Moves object to the least busy thread
+    Slot *attach(QObject *object);
+    // Deletes object in the thread of slot and waits for the deletion, may be called from any thread
+    void detach(Slot *slot, QObject *object);
+
+private:
+    Q_DISABLE_COPY(QOpen62541ThreadPool)
+
+    QMutex m_mutex;
+    std::vector<std::unique_ptr<Slot>> m_slots;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541THREADPOOL_H
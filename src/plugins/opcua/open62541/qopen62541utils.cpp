@@ -6,7 +6,6 @@
 #include "qopen62541valueconverter.h"
 
 #include <QtCore/qloggingcategory.h>
-#include <QtCore/qstringlist.h>
 #include <QtCore/quuid.h>
 
 #ifdef UA_ENABLE_ENCRYPTION
@@ -22,61 +21,83 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
 UA_NodeId Open62541Utils::nodeIdFromQString(const QString &name)
 {
-    quint16 namespaceIndex;
-    QString identifierString;
-    char identifierType;
-    bool success = QOpcUa::nodeIdStringSplit(name, &namespaceIndex, &identifierString, &identifierType);
+    bool success = false;
+    const QOpcUaNodeId nodeId = QOpcUaNodeId::fromString(name, &success);
 
     if (!success) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to split node id string:" << name;
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not parse node id:" << name;
         return UA_NODEID_NULL;
     }
 
-    switch (identifierType) {
-    case 'i': {
-        bool isNumber;
-        uint identifier = identifierString.toUInt(&isNumber);
-        if (isNumber && identifier <= ((std::numeric_limits<quint32>::max)()))
-            return UA_NODEID_NUMERIC(namespaceIndex, static_cast<UA_UInt32>(identifier));
-        else
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << name << "does not contain a valid numeric identifier";
+    return nodeIdFromQOpcUaNodeId(nodeId);
+}
+
+UA_NodeId Open62541Utils::nodeIdFromQOpcUaNodeId(const QOpcUaNodeId &nodeId)
+{
+    UA_NodeId result;
+    UA_NodeId_init(&result);
+    result.namespaceIndex = nodeId.namespaceIndex();
+
+    switch (nodeId.identifierType()) {
+    case QOpcUaNodeId::IdentifierType::Numeric:
+        result.identifierType = UA_NODEIDTYPE_NUMERIC;
+        result.identifier.numeric = nodeId.numericIdentifier();
         break;
-    }
-    case 's': {
-        if (identifierString.size() > 0)
-            return UA_NODEID_STRING_ALLOC(namespaceIndex, identifierString.toUtf8().constData());
-        else
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << name << "does not contain a valid string identifier";
+    case QOpcUaNodeId::IdentifierType::String: {
+        const QByteArray identifier = nodeId.utf8StringIdentifier();
+        result.identifierType = UA_NODEIDTYPE_STRING;
+        if (UA_ByteString_allocBuffer(&result.identifier.string, identifier.size()) != UA_STATUSCODE_GOOD)
+            return UA_NODEID_NULL;
+        std::memcpy(result.identifier.string.data, identifier.constData(), identifier.size());
         break;
     }
-    case 'g': {
-        QUuid uuid(identifierString);
-
-        if (uuid.isNull()) {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << name << "does not contain a valid guid identifier";
-            break;
-        }
-
-        UA_Guid guid;
-        guid.data1 = uuid.data1;
-        guid.data2 = uuid.data2;
-        guid.data3 = uuid.data3;
-        std::memcpy(guid.data4, uuid.data4, sizeof(uuid.data4));
-        return UA_NODEID_GUID(namespaceIndex, guid);
+    case QOpcUaNodeId::IdentifierType::Guid: {
+        const QUuid uuid = nodeId.guidIdentifier();
+        result.identifierType = UA_NODEIDTYPE_GUID;
+        result.identifier.guid.data1 = uuid.data1;
+        result.identifier.guid.data2 = uuid.data2;
+        result.identifier.guid.data3 = uuid.data3;
+        std::memcpy(result.identifier.guid.data4, uuid.data4, sizeof(uuid.data4));
+        break;
     }
-    case 'b': {
-        const QByteArray temp = QByteArray::fromBase64(identifierString.toLatin1());
-        if (temp.size() > 0) {
-            return UA_NODEID_BYTESTRING_ALLOC(namespaceIndex, temp.constData());
-        }
-        else
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << name << "does not contain a valid byte string identifier";
+    case QOpcUaNodeId::IdentifierType::Opaque: {
+        const QByteArray identifier = nodeId.opaqueIdentifier();
+        result.identifierType = UA_NODEIDTYPE_BYTESTRING;
+        if (UA_ByteString_allocBuffer(&result.identifier.byteString, identifier.size()) != UA_STATUSCODE_GOOD)
+            return UA_NODEID_NULL;
+        std::memcpy(result.identifier.byteString.data, identifier.constData(), identifier.size());
         break;
     }
     default:
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not parse node id:" << name;
+        return UA_NODEID_NULL;
+    }
+
+    return result;
+}
+
+QOpcUaNodeId Open62541Utils::nodeIdToQOpcUaNodeId(const UA_NodeId &id)
+{
+    switch (id.identifierType) {
+    case UA_NODEIDTYPE_NUMERIC:
+        return QOpcUaNodeId(id.namespaceIndex, static_cast<quint32>(id.identifier.numeric));
+    case UA_NODEIDTYPE_STRING:
+        return QOpcUaNodeId::fromUtf8String(id.namespaceIndex,
+                                            QByteArray(reinterpret_cast<const char *>(id.identifier.string.data),
+                                                       id.identifier.string.length));
+    case UA_NODEIDTYPE_GUID: {
+        const UA_Guid &src = id.identifier.guid;
+        const QUuid uuid(src.data1, src.data2, src.data3, src.data4[0], src.data4[1], src.data4[2],
+                src.data4[3], src.data4[4], src.data4[5], src.data4[6], src.data4[7]);
+        return QOpcUaNodeId(id.namespaceIndex, uuid);
+    }
+    case UA_NODEIDTYPE_BYTESTRING:
+        return QOpcUaNodeId::fromOpaque(id.namespaceIndex,
+                                        QByteArray(reinterpret_cast<const char *>(id.identifier.byteString.data),
+                                                   id.identifier.byteString.length));
+    default:
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Open62541 Utils: Could not convert UA_NodeId to QOpcUaNodeId";
+        return QOpcUaNodeId();
     }
-    return UA_NODEID_NULL;
 }
 
 QString Open62541Utils::nodeIdToQString(UA_NodeId id)
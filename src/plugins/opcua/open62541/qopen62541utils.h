@@ -5,6 +5,7 @@
 #define QOPEN62541UTILS_H
 
 #include <QtOpcUa/qopcuamonitoringparameters.h>
+#include <QtOpcUa/qopcuanodeid.h>
 
 #include "qopen62541.h"
 
@@ -65,6 +66,8 @@ private:
 namespace Open62541Utils {
     UA_NodeId nodeIdFromQString(const QString &name);
     QString nodeIdToQString(UA_NodeId id);
+    UA_NodeId nodeIdFromQOpcUaNodeId(const QOpcUaNodeId &nodeId);
+    QOpcUaNodeId nodeIdToQOpcUaNodeId(const UA_NodeId &id);
 
     void createEventFilter(const QOpcUaMonitoringParameters::EventFilter &filter, UA_ExtensionObject *out);
 
@@ -31,6 +31,7 @@
 #include <QtCore/qtimezone.h>
 #include <QtCore/quuid.h>
 
+#include <array>
 #include <cstring>
 
 QT_BEGIN_NAMESPACE
@@ -41,6 +42,91 @@ using namespace QOpcUa::NodeIds;
 
 namespace QOpen62541ValueConverter {
 
+// Returns the QOpcUa type of the elements of a contiguous numeric QList or Undefined for other types
+static QOpcUa::Types typedArrayElementType(QMetaType metaType)
+{
+    if (metaType == QMetaType::fromType<QList<double>>())
+        return QOpcUa::Double;
+    if (metaType == QMetaType::fromType<QList<float>>())
+        return QOpcUa::Float;
+    if (metaType == QMetaType::fromType<QList<qint32>>())
+        return QOpcUa::Int32;
+    if (metaType == QMetaType::fromType<QList<quint32>>())
+        return QOpcUa::UInt32;
+    if (metaType == QMetaType::fromType<QList<qint16>>())
+        return QOpcUa::Int16;
+    if (metaType == QMetaType::fromType<QList<quint16>>())
+        return QOpcUa::UInt16;
+    if (metaType == QMetaType::fromType<QList<qint64>>())
+        return QOpcUa::Int64;
+    if (metaType == QMetaType::fromType<QList<quint64>>())
+        return QOpcUa::UInt64;
+    if (metaType == QMetaType::fromType<QList<signed char>>())
+        return QOpcUa::SByte;
+    if (metaType == QMetaType::fromType<QList<uchar>>())
+        return QOpcUa::Byte;
+    if (metaType == QMetaType::fromType<QList<bool>>())
+        return QOpcUa::Boolean;
+    return QOpcUa::Undefined;
+}
+
+template<typename UATYPE, typename QTTYPE>
+static UA_Variant typedArrayFromQVariant(const QVariant &var, const UA_DataType *type)
+{
+    static_assert(sizeof(UATYPE) == sizeof(QTTYPE), "The element types must have the same memory layout");
+
+    UA_Variant open62541value;
+    UA_Variant_init(&open62541value);
+
+    const auto &list = *static_cast<const QList<QTTYPE> *>(var.constData());
+    if (list.isEmpty())
+        return open62541value;
+
+    UATYPE *arr = static_cast<UATYPE *>(UA_Array_new(list.size(), type));
+    if (!arr)
+        return open62541value;
+
+    std::memcpy(arr, list.constData(), list.size() * sizeof(UATYPE));
+    UA_Variant_setArray(&open62541value, arr, list.size(), type);
+    return open62541value;
+}
+
+static UA_Variant typedArrayToOpen62541Variant(const QVariant &value, QOpcUa::Types elementType)
+{
+    const UA_DataType *dt = toDataType(elementType);
+
+    switch (elementType) {
+    case QOpcUa::Boolean:
+        return typedArrayFromQVariant<UA_Boolean, bool>(value, dt);
+    case QOpcUa::SByte:
+        return typedArrayFromQVariant<UA_SByte, signed char>(value, dt);
+    case QOpcUa::Byte:
+        return typedArrayFromQVariant<UA_Byte, uchar>(value, dt);
+    case QOpcUa::Int16:
+        return typedArrayFromQVariant<UA_Int16, qint16>(value, dt);
+    case QOpcUa::UInt16:
+        return typedArrayFromQVariant<UA_UInt16, quint16>(value, dt);
+    case QOpcUa::Int32:
+        return typedArrayFromQVariant<UA_Int32, qint32>(value, dt);
+    case QOpcUa::UInt32:
+        return typedArrayFromQVariant<UA_UInt32, quint32>(value, dt);
+    case QOpcUa::Int64:
+        return typedArrayFromQVariant<UA_Int64, qint64>(value, dt);
+    case QOpcUa::UInt64:
+        return typedArrayFromQVariant<UA_UInt64, quint64>(value, dt);
+    case QOpcUa::Float:
+        return typedArrayFromQVariant<UA_Float, float>(value, dt);
+    case QOpcUa::Double:
+        return typedArrayFromQVariant<UA_Double, double>(value, dt);
+    default:
+        break;
+    }
+
+    UA_Variant open62541value;
+    UA_Variant_init(&open62541value);
+    return open62541value;
+}
+
 UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 {
     UA_Variant open62541value;
@@ -48,7 +134,8 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 
     if (value.canConvert<QOpcUaMultiDimensionalArray>()) {
         QOpcUaMultiDimensionalArray data = value.value<QOpcUaMultiDimensionalArray>();
-        UA_Variant result = toOpen62541Variant(data.valueArray(), type);
+        UA_Variant result = data.hasTypedValueArray() ? toOpen62541Variant(data.typedValueArray(), type)
+                                                      : toOpen62541Variant(data.valueArray(), type);
 
         const auto &arrayDimensions = data.arrayDimensions();
 
@@ -63,6 +150,14 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
         return result;
     }
 
+    const QOpcUa::Types typedArrayType = typedArrayElementType(value.metaType());
+    if (typedArrayType != QOpcUa::Undefined) {
+        if (type == QOpcUa::Undefined || type == typedArrayType)
+            return typedArrayToOpen62541Variant(value, typedArrayType);
+        // The element type doesn't match the requested type, convert element by element
+        return toOpen62541Variant(value.toList(), type);
+    }
+
     if (value.metaType().id() == QMetaType::QVariantList && value.toList().size() == 0)
         return open62541value;
 
@@ -162,98 +257,220 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
     return open62541value;
 }
 
+using ToQVariantFunction = QVariant (*)(const UA_Variant &);
+
+// Conversion functions indexed by the position of the type in UA_TYPES
+static const std::array<ToQVariantFunction, UA_TYPES_COUNT> &toQVariantTable()
+{
+    static const auto table = [] {
+        std::array<ToQVariantFunction, UA_TYPES_COUNT> t {};
+        t[UA_TYPES_BOOLEAN] = [](const UA_Variant &v) { return arrayToQVariant<bool, UA_Boolean>(v, QMetaType::Bool); };
+        t[UA_TYPES_SBYTE] = [](const UA_Variant &v) { return arrayToQVariant<signed char, UA_SByte>(v, QMetaType::SChar); };
+        t[UA_TYPES_BYTE] = [](const UA_Variant &v) { return arrayToQVariant<uchar, UA_Byte>(v, QMetaType::UChar); };
+        t[UA_TYPES_INT16] = [](const UA_Variant &v) { return arrayToQVariant<qint16, UA_Int16>(v, QMetaType::Short); };
+        t[UA_TYPES_UINT16] = [](const UA_Variant &v) { return arrayToQVariant<quint16, UA_UInt16>(v, QMetaType::UShort); };
+        t[UA_TYPES_INT32] = [](const UA_Variant &v) { return arrayToQVariant<qint32, UA_Int32>(v, QMetaType::Int); };
+        t[UA_TYPES_UINT32] = [](const UA_Variant &v) { return arrayToQVariant<quint32, UA_UInt32>(v, QMetaType::UInt); };
+        t[UA_TYPES_INT64] = [](const UA_Variant &v) { return arrayToQVariant<qlonglong, UA_Int64>(v, QMetaType::LongLong); };
+        t[UA_TYPES_UINT64] = [](const UA_Variant &v) { return arrayToQVariant<qulonglong, UA_UInt64>(v, QMetaType::ULongLong); };
+        t[UA_TYPES_FLOAT] = [](const UA_Variant &v) { return arrayToQVariant<float, UA_Float>(v, QMetaType::Float); };
+        t[UA_TYPES_DOUBLE] = [](const UA_Variant &v) { return arrayToQVariant<double, UA_Double>(v, QMetaType::Double); };
+        t[UA_TYPES_STRING] = [](const UA_Variant &v) { return arrayToQVariant<QString, UA_String>(v, QMetaType::QString); };
+        t[UA_TYPES_BYTESTRING] = [](const UA_Variant &v) { return arrayToQVariant<QByteArray, UA_ByteString>(v, QMetaType::QByteArray); };
+        t[UA_TYPES_LOCALIZEDTEXT] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaLocalizedText, UA_LocalizedText>(v); };
+        t[UA_TYPES_NODEID] = [](const UA_Variant &v) { return arrayToQVariant<QString, UA_NodeId>(v, QMetaType::QString); };
+        t[UA_TYPES_DATETIME] = [](const UA_Variant &v) { return arrayToQVariant<QDateTime, UA_DateTime>(v, QMetaType::QDateTime); };
+        t[UA_TYPES_GUID] = [](const UA_Variant &v) { return arrayToQVariant<QUuid, UA_Guid>(v, QMetaType::QUuid); };
+        t[UA_TYPES_XMLELEMENT] = [](const UA_Variant &v) { return arrayToQVariant<QString, UA_XmlElement>(v, QMetaType::QString); };
+        t[UA_TYPES_QUALIFIEDNAME] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaQualifiedName, UA_QualifiedName>(v); };
+        t[UA_TYPES_STATUSCODE] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUa::UaStatusCode, UA_StatusCode>(v, QMetaType::UInt); };
+        t[UA_TYPES_EXTENSIONOBJECT] = [](const UA_Variant &v) { return arrayToQVariant<QVariant, UA_ExtensionObject>(v); };
+        t[UA_TYPES_EXPANDEDNODEID] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaExpandedNodeId, UA_ExpandedNodeId>(v); };
+        t[UA_TYPES_ARGUMENT] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaArgument, UA_Argument>(v); };
+        t[UA_TYPES_RANGE] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaRange, UA_Range>(v); };
+        t[UA_TYPES_EUINFORMATION] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaEUInformation, UA_EUInformation>(v); };
+        t[UA_TYPES_AXISINFORMATION] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaAxisInformation, UA_AxisInformation>(v); };
+        t[UA_TYPES_COMPLEXNUMBERTYPE] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaComplexNumber, UA_ComplexNumberType>(v); };
+        t[UA_TYPES_DOUBLECOMPLEXNUMBERTYPE] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaDoubleComplexNumber, UA_DoubleComplexNumberType>(v); };
+        t[UA_TYPES_XVTYPE] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaXValue, UA_XVType>(v); };
+        t[UA_TYPES_STRUCTUREDEFINITION] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaStructureDefinition, UA_StructureDefinition>(v); };
+        t[UA_TYPES_STRUCTUREFIELD] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaStructureField, UA_StructureField>(v); };
+        t[UA_TYPES_ENUMDEFINITION] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaEnumDefinition, UA_EnumDefinition>(v); };
+        t[UA_TYPES_ENUMFIELD] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaEnumField, UA_EnumField>(v); };
+        t[UA_TYPES_DIAGNOSTICINFO] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaDiagnosticInfo, UA_DiagnosticInfo>(v); };
+        t[UA_TYPES_SIMPLEATTRIBUTEOPERAND] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaSimpleAttributeOperand, UA_SimpleAttributeOperand>(v); };
+        t[UA_TYPES_ATTRIBUTEOPERAND] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaSimpleAttributeOperand, UA_SimpleAttributeOperand>(v); };
+        t[UA_TYPES_LITERALOPERAND] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaLiteralOperand, UA_LiteralOperand>(v); };
+        t[UA_TYPES_ELEMENTOPERAND] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaElementOperand, UA_ElementOperand>(v); };
+        t[UA_TYPES_RELATIVEPATHELEMENT] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaRelativePathElement, UA_RelativePathElement>(v); };
+        t[UA_TYPES_CONTENTFILTERELEMENT] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaContentFilterElement, UA_ContentFilterElement>(v); };
+        t[UA_TYPES_EVENTFILTER] = [](const UA_Variant &v) { return arrayToQVariant<QOpcUaMonitoringParameters::EventFilter, UA_EventFilter>(v); };
+        return t;
+    }();
+
+    return table;
+}
+
+// Returns the position of a type in UA_TYPES or UA_TYPES_COUNT for custom types
+static inline size_t uaTypeIndex(const UA_DataType *type)
+{
+    if (type < &UA_TYPES[0] || type >= &UA_TYPES[UA_TYPES_COUNT])
+        return UA_TYPES_COUNT;
+    return static_cast<size_t>(type - &UA_TYPES[0]);
+}
+
 QVariant toQVariant(const UA_Variant &value)
 {
     if (value.type == nullptr) {
         return QVariant();
     }
 
-    if (value.type == &UA_TYPES[UA_TYPES_BOOLEAN])
-        return arrayToQVariant<bool, UA_Boolean>(value, QMetaType::Bool);
-    else if (value.type == &UA_TYPES[UA_TYPES_SBYTE])
-        return arrayToQVariant<signed char, UA_SByte>(value, QMetaType::SChar);
-    else if (value.type == &UA_TYPES[UA_TYPES_BYTE])
-        return arrayToQVariant<uchar, UA_Byte>(value, QMetaType::UChar);
-    else if (value.type == &UA_TYPES[UA_TYPES_INT16])
-        return arrayToQVariant<qint16, UA_Int16>(value, QMetaType::Short);
-    else if (value.type == &UA_TYPES[UA_TYPES_UINT16])
-        return arrayToQVariant<quint16, UA_UInt16>(value, QMetaType::UShort);
-    else if (value.type == &UA_TYPES[UA_TYPES_INT32])
-        return arrayToQVariant<qint32, UA_Int32>(value, QMetaType::Int);
-    else if (value.type == &UA_TYPES[UA_TYPES_UINT32])
-        return arrayToQVariant<quint32, UA_UInt32>(value, QMetaType::UInt);
-    else if (value.type == &UA_TYPES[UA_TYPES_INT64])
-        return arrayToQVariant<int64_t, UA_Int64>(value, QMetaType::LongLong);
-    else if (value.type == &UA_TYPES[UA_TYPES_UINT64])
-        return arrayToQVariant<uint64_t, UA_UInt64>(value, QMetaType::ULongLong);
-    else if (value.type == &UA_TYPES[UA_TYPES_FLOAT])
-        return arrayToQVariant<float, UA_Float>(value, QMetaType::Float);
-    else if (value.type == &UA_TYPES[UA_TYPES_DOUBLE])
-        return arrayToQVariant<double, UA_Double>(value, QMetaType::Double);
-    else if (value.type == &UA_TYPES[UA_TYPES_STRING])
-        return arrayToQVariant<QString, UA_String>(value, QMetaType::QString);
-    else if (value.type == &UA_TYPES[UA_TYPES_BYTESTRING])
-        return arrayToQVariant<QByteArray, UA_ByteString>(value, QMetaType::QByteArray);
-    else if (value.type == &UA_TYPES[UA_TYPES_LOCALIZEDTEXT])
-        return arrayToQVariant<QOpcUaLocalizedText, UA_LocalizedText>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_NODEID])
-        return arrayToQVariant<QString, UA_NodeId>(value, QMetaType::QString);
-    else if (value.type == &UA_TYPES[UA_TYPES_DATETIME])
-        return arrayToQVariant<QDateTime, UA_DateTime>(value, QMetaType::QDateTime);
-    else if (value.type == &UA_TYPES[UA_TYPES_GUID])
-        return arrayToQVariant<QUuid, UA_Guid>(value, QMetaType::QUuid);
-    else if (value.type == &UA_TYPES[UA_TYPES_XMLELEMENT])
-        return arrayToQVariant<QString, UA_XmlElement>(value, QMetaType::QString);
-    else if (value.type == &UA_TYPES[UA_TYPES_QUALIFIEDNAME])
-        return arrayToQVariant<QOpcUaQualifiedName, UA_QualifiedName>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_STATUSCODE])
-        return arrayToQVariant<QOpcUa::UaStatusCode, UA_StatusCode>(value, QMetaType::UInt);
-    else if (value.type == &UA_TYPES[UA_TYPES_EXTENSIONOBJECT])
-        return arrayToQVariant<QVariant, UA_ExtensionObject>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_EXPANDEDNODEID])
-        return arrayToQVariant<QOpcUaExpandedNodeId, UA_ExpandedNodeId>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_ARGUMENT])
-        return arrayToQVariant<QOpcUaArgument, UA_Argument>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_RANGE])
-        return arrayToQVariant<QOpcUaRange, UA_Range>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_EUINFORMATION])
-        return arrayToQVariant<QOpcUaEUInformation, UA_EUInformation>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_AXISINFORMATION])
-        return arrayToQVariant<QOpcUaAxisInformation, UA_AxisInformation>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_COMPLEXNUMBERTYPE])
-        return arrayToQVariant<QOpcUaComplexNumber, UA_ComplexNumberType>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_DOUBLECOMPLEXNUMBERTYPE])
-        return arrayToQVariant<QOpcUaDoubleComplexNumber, UA_DoubleComplexNumberType>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_XVTYPE])
-        return arrayToQVariant<QOpcUaXValue, UA_XVType>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_STRUCTUREDEFINITION])
-        return arrayToQVariant<QOpcUaStructureDefinition, UA_StructureDefinition>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_STRUCTUREFIELD])
-        return arrayToQVariant<QOpcUaStructureField, UA_StructureField>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_ENUMDEFINITION])
-        return arrayToQVariant<QOpcUaEnumDefinition, UA_EnumDefinition>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_ENUMFIELD])
-        return arrayToQVariant<QOpcUaEnumField, UA_EnumField>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_DIAGNOSTICINFO])
-        return arrayToQVariant<QOpcUaDiagnosticInfo, UA_DiagnosticInfo>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_SIMPLEATTRIBUTEOPERAND])
-        return arrayToQVariant<QOpcUaSimpleAttributeOperand, UA_SimpleAttributeOperand>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_ATTRIBUTEOPERAND])
-        return arrayToQVariant<QOpcUaSimpleAttributeOperand, UA_SimpleAttributeOperand>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_LITERALOPERAND])
-        return arrayToQVariant<QOpcUaLiteralOperand, UA_LiteralOperand>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_ELEMENTOPERAND])
-        return arrayToQVariant<QOpcUaElementOperand, UA_ElementOperand>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT])
-        return arrayToQVariant<QOpcUaRelativePathElement, UA_RelativePathElement>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_CONTENTFILTERELEMENT])
-        return arrayToQVariant<QOpcUaContentFilterElement, UA_ContentFilterElement>(value);
-    else if (value.type == &UA_TYPES[UA_TYPES_EVENTFILTER])
-        return arrayToQVariant<QOpcUaMonitoringParameters::EventFilter, UA_EventFilter>(value);
+    const size_t index = uaTypeIndex(value.type);
+    if (index < UA_TYPES_COUNT) {
+        if (const auto function = toQVariantTable()[index])
+            return function(value);
+    }
 
     return uaVariantToQtExtensionObject(value);
 }
 
+template<typename QTTYPE, typename UATYPE>
+static QVariant typedArrayToQVariant(const UA_Variant &var)
+{
+    static_assert(sizeof(UATYPE) == sizeof(QTTYPE), "The element types must have the same memory layout");
+
+    // Ensure that the array fits in a QList
+    if (var.arrayLength > static_cast<quint64>((std::numeric_limits<qsizetype>::max)()) / sizeof(QTTYPE))
+        return QVariant();
+
+    QList<QTTYPE> list;
+    list.resize(var.arrayLength);
+    std::memcpy(list.data(), var.data, var.arrayLength * sizeof(QTTYPE));
+
+    if (var.arrayDimensionsSize > 0) {
+        // Ensure that the array dimensions fit in a QList
+        if (var.arrayDimensionsSize > static_cast<quint64>((std::numeric_limits<int>::max)()))
+            return QOpcUaMultiDimensionalArray();
+        QList<quint32> arrayDimensions;
+        std::copy(var.arrayDimensions, var.arrayDimensions+var.arrayDimensionsSize, std::back_inserter(arrayDimensions));
+        QOpcUaMultiDimensionalArray result(arrayDimensions);
+        result.setTypedValueArray(QVariant::fromValue(list));
+        return result;
+    }
+
+    return QVariant::fromValue(list);
+}
+
+QVariant toQVariant(const UA_Variant &value, bool typedNumericArrays)
+{
+    if (!typedNumericArrays || value.type == nullptr || UA_Variant_isScalar(&value) || value.arrayLength == 0)
+        return toQVariant(value);
+
+    switch (uaTypeIndex(value.type)) {
+    case UA_TYPES_BOOLEAN:
+        return typedArrayToQVariant<bool, UA_Boolean>(value);
+    case UA_TYPES_SBYTE:
+        return typedArrayToQVariant<signed char, UA_SByte>(value);
+    case UA_TYPES_BYTE:
+        return typedArrayToQVariant<uchar, UA_Byte>(value);
+    case UA_TYPES_INT16:
+        return typedArrayToQVariant<qint16, UA_Int16>(value);
+    case UA_TYPES_UINT16:
+        return typedArrayToQVariant<quint16, UA_UInt16>(value);
+    case UA_TYPES_INT32:
+        return typedArrayToQVariant<qint32, UA_Int32>(value);
+    case UA_TYPES_UINT32:
+        return typedArrayToQVariant<quint32, UA_UInt32>(value);
+    case UA_TYPES_INT64:
+        return typedArrayToQVariant<qint64, UA_Int64>(value);
+    case UA_TYPES_UINT64:
+        return typedArrayToQVariant<quint64, UA_UInt64>(value);
+    case UA_TYPES_FLOAT:
+        return typedArrayToQVariant<float, UA_Float>(value);
+    case UA_TYPES_DOUBLE:
+        return typedArrayToQVariant<double, UA_Double>(value);
+    default:
+        return toQVariant(value);
+    }
+}
+
+using ToScalarDataChangeFunction = void (*)(const void *, QOpcUaScalarDataChange &);
+
+// Conversion functions for the scalar types supported by QOpcUaScalarDataChange, indexed by the position in UA_TYPES
+static const std::array<ToScalarDataChangeFunction, UA_TYPES_COUNT> &toScalarDataChangeTable()
+{
+    static const auto table = [] {
+        std::array<ToScalarDataChangeFunction, UA_TYPES_COUNT> t {};
+        t[UA_TYPES_BOOLEAN] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setBoolean(*static_cast<const UA_Boolean *>(d));
+        };
+        t[UA_TYPES_SBYTE] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setSignedInteger(*static_cast<const UA_SByte *>(d), QOpcUa::Types::SByte);
+        };
+        t[UA_TYPES_BYTE] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setUnsignedInteger(*static_cast<const UA_Byte *>(d), QOpcUa::Types::Byte);
+        };
+        t[UA_TYPES_INT16] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setSignedInteger(*static_cast<const UA_Int16 *>(d), QOpcUa::Types::Int16);
+        };
+        t[UA_TYPES_UINT16] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setUnsignedInteger(*static_cast<const UA_UInt16 *>(d), QOpcUa::Types::UInt16);
+        };
+        t[UA_TYPES_INT32] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setSignedInteger(*static_cast<const UA_Int32 *>(d), QOpcUa::Types::Int32);
+        };
+        t[UA_TYPES_UINT32] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setUnsignedInteger(*static_cast<const UA_UInt32 *>(d), QOpcUa::Types::UInt32);
+        };
+        t[UA_TYPES_INT64] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setSignedInteger(*static_cast<const UA_Int64 *>(d), QOpcUa::Types::Int64);
+        };
+        t[UA_TYPES_UINT64] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setUnsignedInteger(*static_cast<const UA_UInt64 *>(d), QOpcUa::Types::UInt64);
+        };
+        t[UA_TYPES_FLOAT] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setFloatingPoint(*static_cast<const UA_Float *>(d), QOpcUa::Types::Float);
+        };
+        t[UA_TYPES_DOUBLE] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setFloatingPoint(*static_cast<const UA_Double *>(d), QOpcUa::Types::Double);
+        };
+        t[UA_TYPES_DATETIME] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setDateTime(*static_cast<const UA_DateTime *>(d));
+        };
+        t[UA_TYPES_STATUSCODE] = [](const void *d, QOpcUaScalarDataChange &c) {
+            c.setUnsignedInteger(*static_cast<const UA_StatusCode *>(d), QOpcUa::Types::StatusCode);
+        };
+        return t;
+    }();
+
+    return table;
+}
+
+bool toScalarDataChange(const UA_DataValue &value, QOpcUaScalarDataChange *change)
+{
+    if (value.hasValue) {
+        if (!UA_Variant_isScalar(&value.value))
+            return false;
+
+        const size_t index = uaTypeIndex(value.value.type);
+        if (index >= UA_TYPES_COUNT)
+            return false;
+
+        const auto function = toScalarDataChangeTable()[index];
+        if (!function)
+            return false;
+
+        function(value.value.data, *change);
+    } else {
+        change->clearValue();
+    }
+
+    change->setStatusCode(value.hasStatus ? QOpcUa::UaStatusCode(value.status) : QOpcUa::UaStatusCode::Good);
+    change->setSourceTimestamp(value.hasSourceTimestamp ? value.sourceTimestamp : 0);
+    change->setServerTimestamp(value.hasServerTimestamp ? value.serverTimestamp : 0);
+    return true;
+}
+
 const UA_DataType *toDataType(QOpcUa::Types valueType)
 {
     switch (valueType) {
@@ -9,6 +9,7 @@
 #include <QtOpcUa/qopcuatype.h>
 #include <QtOpcUa/qopcuabinarydataencoding.h>
 #include <QtOpcUa/qopcuaextensionobject.h>
+#include <QtOpcUa/qopcuascalardatachange.h>
 
 #include <QtCore/qvariant.h>
 
@@ -36,6 +37,8 @@ namespace QOpen62541ValueConverter {
 
     UA_Variant toOpen62541Variant(const QVariant&, QOpcUa::Types);
     QVariant toQVariant(const UA_Variant&);
+    QVariant toQVariant(const UA_Variant &value, bool typedNumericArrays);
+    bool toScalarDataChange(const UA_DataValue &value, QOpcUaScalarDataChange *change);
     const UA_DataType *toDataType(QOpcUa::Types valueType);
     QOpcUa::Types toQtDataType(const UA_DataType *type);
     QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type);
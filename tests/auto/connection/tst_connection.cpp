@@ -14,6 +14,8 @@
 #include <QTcpSocket>
 #include <QTcpServer>
 
+#include "../shared/testserverbackends.h"
+
 #define defineDataMethod(name) void name()\
 {\
     QTest::addColumn<QOpcUaClient *>("opcuaClient");\
@@ -56,7 +58,7 @@ private:
 
 Tst_Connection::Tst_Connection()
 {
-    m_backends = QOpcUaProvider::availableBackends();
+    m_backends = testServerBackends();
 }
 
 Tst_Connection::~Tst_Connection()
@@ -2,16 +2,11 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
 
 import QtQuick
-import QtOpcUa as QtOpcUa
 
 Item {
     property int currentTest: 0
     property string testName
 
-    QtOpcUa.Connection {
-        id: connection
-    }
-
     Component.onCompleted: {
         var component = Qt.createComponent(testName + ".qml")
         if (component.status != Component.Ready) {
@@ -19,8 +14,8 @@ Item {
             return;
         }
 
-        for (var backendIndex in connection.availableBackends) {
-            var backend = connection.availableBackends[backendIndex];
+        for (var backendIndex in TEST_SERVER_BACKENDS) {
+            var backend = TEST_SERVER_BACKENDS[backendIndex];
             console.log("Setting up", testName, "for", backend);
             var child = component.createObject(this, { "backendName": backend });
             if (child == null) {
@@ -9,6 +9,8 @@
 #include <QTcpServer>
 #include <QTcpSocket>
 
+#include "../shared/testserverbackends.h"
+
 static QString envOrDefault(const char *env, QString def)
 {
     return qEnvironmentVariableIsSet(env) ? qgetenv(env).constData() : def;
@@ -102,6 +104,7 @@ public slots:
 #endif
         engine->rootContext()->setContextProperty("SERVER_SUPPORTS_SECURITY", value);
         engine->rootContext()->setContextProperty("OPCUA_DISCOVERY_URL", m_opcuaDiscoveryUrl);
+        engine->rootContext()->setContextProperty("TEST_SERVER_BACKENDS", testServerBackends());
     }
     void cleanupTestCase() {
         if (m_serverProcess.state() == QProcess::Running) {
@@ -0,0 +1,199 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaEndpointDescription>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+#include <QtOpcUa/QOpcUaQualifiedName>
+#include <QtOpcUa/QOpcUaReadResult>
+#include <QtOpcUa/qopcuascalardatachange.h>
+
+#include <QtCore/QList>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QVariantMap>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QtTest>
+
+// The loopback backend serves generated values without a server
+class Tst_Loopback : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Delivery {
+        Node,
+        Batched,
+        Typed,
+        NotificationRing
+    };
+    Q_ENUM(Delivery)
+
+private slots:
+    void initTestCase();
+    void readGeneratorNode();
+    void monitorUnknownNode();
+    void generatedValues_data();
+    void generatedValues();
+
+private:
+    QOpcUaClient *connectClient(const QVariantMap &backendProperties);
+
+    QOpcUaProvider m_opcUa;
+};
+
+void Tst_Loopback::initTestCase()
+{
+    if (!QOpcUaProvider::availableBackends().contains(QStringLiteral("loopback")))
+        QSKIP("The loopback backend is not available");
+}
+
+QOpcUaClient *Tst_Loopback::connectClient(const QVariantMap &backendProperties)
+{
+    auto client = m_opcUa.createClient(QStringLiteral("loopback"), backendProperties);
+    if (!client)
+        return nullptr;
+
+    QOpcUaEndpointDescription endpoint;
+    endpoint.setEndpointUrl(QStringLiteral("opc.tcp://localhost:4840"));
+    client->connectToEndpoint(endpoint);
+
+    return client;
+}
+
+void Tst_Loopback::readGeneratorNode()
+{
+    QScopedPointer<QOpcUaClient> client(connectClient({ { QStringLiteral("generatorNodeCount"), 2 } }));
+    QVERIFY(client);
+    QTRY_COMPARE(client->state(), QOpcUaClient::ClientState::Connected);
+
+    QScopedPointer<QOpcUaNode> node(client->node(QStringLiteral("ns=1;s=Generator.1")));
+    QVERIFY(node);
+
+    QSignalSpy readSpy(node.data(), &QOpcUaNode::attributeRead);
+    QVERIFY(node->readAttributes(QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::BrowseName));
+    QTRY_COMPARE(readSpy.size(), 1);
+
+    QCOMPARE(node->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).metaType(), QMetaType::fromType<double>());
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::BrowseName).value<QOpcUaQualifiedName>().name(),
+             QStringLiteral("Generator.1"));
+
+    client->disconnectFromEndpoint();
+    QTRY_COMPARE(client->state(), QOpcUaClient::ClientState::Disconnected);
+}
+
+void Tst_Loopback::monitorUnknownNode()
+{
+    QScopedPointer<QOpcUaClient> client(connectClient({ { QStringLiteral("generatorNodeCount"), 1 } }));
+    QVERIFY(client);
+    QTRY_COMPARE(client->state(), QOpcUaClient::ClientState::Connected);
+
+    QScopedPointer<QOpcUaNode> node(client->node(QStringLiteral("ns=1;s=Generator.1")));
+    QVERIFY(node);
+
+    QSignalSpy monitoringSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    QVERIFY(node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(10)));
+    QTRY_COMPARE(monitoringSpy.size(), 1);
+    QCOMPARE(monitoringSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+}
+
+void Tst_Loopback::generatedValues_data()
+{
+    QTest::addColumn<Delivery>("delivery");
+    QTest::addColumn<QVariantMap>("backendProperties");
+
+    const QVariantMap generator = {
+        { QStringLiteral("generatorNodeCount"), 4 },
+        { QStringLiteral("generatorIntervalMs"), 10 },
+        { QStringLiteral("generatorSamplesPerInterval"), 4 }
+    };
+
+    QTest::newRow("node") << Delivery::Node << generator;
+
+    auto properties = generator;
+    properties.insert(QStringLiteral("batchDataChanges"), true);
+    QTest::newRow("batched") << Delivery::Batched << properties;
+
+    properties = generator;
+    properties.insert(QStringLiteral("typedDataChanges"), true);
+    QTest::newRow("typed") << Delivery::Typed << properties;
+
+    // A small ring in Block mode pauses the generator until the ring has been drained
+    properties = generator;
+    properties.insert(QStringLiteral("notificationRingCapacity"), 8);
+    properties.insert(QStringLiteral("notificationRingOverflowPolicy"), QStringLiteral("Block"));
+    QTest::newRow("notification ring") << Delivery::NotificationRing << properties;
+}
+
+void Tst_Loopback::generatedValues()
+{
+    QFETCH(Delivery, delivery);
+    QFETCH(QVariantMap, backendProperties);
+
+    QScopedPointer<QOpcUaClient> client(connectClient(backendProperties));
+    QVERIFY(client);
+    QTRY_COMPARE(client->state(), QOpcUaClient::ClientState::Connected);
+
+    QScopedPointer<QOpcUaNode> node(client->node(QStringLiteral("ns=1;s=Generator.2")));
+    QVERIFY(node);
+
+    QList<double> values;
+
+    switch (delivery) {
+    case Delivery::Node:
+        connect(node.data(), &QOpcUaNode::dataChangeOccurred, this,
+                [&values](QOpcUa::NodeAttribute attr, const QVariant &value) {
+            if (attr == QOpcUa::NodeAttribute::Value)
+                values.push_back(value.toDouble());
+        });
+        break;
+    case Delivery::Batched:
+        connect(client.data(), &QOpcUaClient::dataChangesReceived, this,
+                [&values](const QList<QOpcUaReadResult> &results) {
+            for (const auto &result : results) {
+                if (result.attribute() == QOpcUa::NodeAttribute::Value)
+                    values.push_back(result.value().toDouble());
+            }
+        });
+        break;
+    case Delivery::Typed:
+        connect(node.data(), &QOpcUaNode::scalarDataChangeOccurred, this,
+                [&values](const QOpcUaScalarDataChange &change) {
+            if (change.attribute() == QOpcUa::NodeAttribute::Value)
+                values.push_back(change.toDouble());
+        });
+        break;
+    case Delivery::NotificationRing:
+        connect(client.data(), &QOpcUaClient::notificationsAvailable, this, [&values, &client]() {
+            client->drainNotifications([&values](QOpcUaNode *, const QOpcUaScalarDataChange &change,
+                                                 const QVariant &) {
+                if (change.attribute() == QOpcUa::NodeAttribute::Value)
+                    values.push_back(change.toDouble());
+            });
+        });
+        break;
+    }
+
+    QSignalSpy monitoringSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    QVERIFY(node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(10)));
+    QTRY_COMPARE(monitoringSpy.size(), 1);
+    QCOMPARE(monitoringSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    QTRY_VERIFY(values.size() >= 40);
+
+    // The n-th value of a generator node is n, no value must be lost or reordered
+    for (qsizetype i = 1; i < values.size(); ++i)
+        QCOMPARE(values.at(i), values.at(i - 1) + 1);
+
+    if (delivery == Delivery::NotificationRing)
+        QCOMPARE(client->droppedNotifications(), quint64(0));
+
+    client->disconnectFromEndpoint();
+    QTRY_COMPARE(client->state(), QOpcUaClient::ClientState::Disconnected);
+}
+
+QTEST_GUILESS_MAIN(Tst_Loopback)
+
+#include "tst_loopback.moc"
@@ -0,0 +1,258 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtOpcUa/private/qopcuanotificationring_p.h>
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QThread>
+
+#include <QtTest/QtTest>
+
+#include <atomic>
+#include <memory>
+
+using Ring = QOpcUaNotificationRing;
+using Policy = QOpcUaNotificationRing::OverflowPolicy;
+
+static Ring::Record makeRecord(quint64 handle, quint64 value)
+{
+    Ring::Record record;
+    record.handle = handle;
+    record.change.setUnsignedInteger(value, QOpcUa::Types::UInt64);
+    return record;
+}
+
+static QList<quint64> drainValues(Ring &ring)
+{
+    QList<quint64> values;
+    ring.drain([&values](Ring::Record &record) {
+        values.push_back(record.change.toULongLong());
+    });
+    return values;
+}
+
+class Tst_NotificationRing : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void capacity();
+    void overflowPolicyFromString();
+    void consumerNotification();
+    void dropOldest();
+    void blockKeepsBacklog();
+    void blockAfterClose();
+    void conflate();
+    void concurrentProducerAndConsumer_data();
+    void concurrentProducerAndConsumer();
+};
+
+void Tst_NotificationRing::capacity()
+{
+    QCOMPARE(Ring(0, Policy::DropOldest).capacity(), 2u);
+    QCOMPARE(Ring(1, Policy::DropOldest).capacity(), 2u);
+    QCOMPARE(Ring(5, Policy::DropOldest).capacity(), 8u);
+    QCOMPARE(Ring(8, Policy::DropOldest).capacity(), 8u);
+}
+
+void Tst_NotificationRing::overflowPolicyFromString()
+{
+    Policy policy = Policy::DropOldest;
+    QVERIFY(Ring::overflowPolicyFromString(u"block", &policy));
+    QCOMPARE(policy, Policy::Block);
+    QVERIFY(Ring::overflowPolicyFromString(u"Conflate", &policy));
+    QCOMPARE(policy, Policy::Conflate);
+    QVERIFY(Ring::overflowPolicyFromString(u"DROPOLDEST", &policy));
+    QCOMPARE(policy, Policy::DropOldest);
+    QVERIFY(!Ring::overflowPolicyFromString(u"Newest", &policy));
+    QCOMPARE(policy, Policy::DropOldest);
+}
+
+void Tst_NotificationRing::consumerNotification()
+{
+    Ring ring(4, Policy::DropOldest);
+
+    // Only the first record after a drain wakes up the consumer
+    QVERIFY(ring.post(makeRecord(1, 0)));
+    QVERIFY(!ring.post(makeRecord(1, 1)));
+    QCOMPARE(drainValues(ring), QList<quint64>({0, 1}));
+
+    QVERIFY(ring.post(makeRecord(1, 2)));
+    QCOMPARE(drainValues(ring), QList<quint64>({2}));
+    QCOMPARE(ring.drain([](Ring::Record &) {}), qsizetype(0));
+}
+
+void Tst_NotificationRing::dropOldest()
+{
+    Ring ring(4, Policy::DropOldest);
+
+    for (quint64 i = 0; i < 6; ++i)
+        ring.post(makeRecord(1, i));
+
+    QVERIFY(!ring.isBlocked());
+    QVERIFY(!ring.hasBacklog());
+    QCOMPARE(ring.droppedCount(), quint64(2));
+    QCOMPARE(drainValues(ring), QList<quint64>({2, 3, 4, 5}));
+}
+
+void Tst_NotificationRing::blockKeepsBacklog()
+{
+    Ring ring(4, Policy::Block);
+
+    for (quint64 i = 0; i < 4; ++i)
+        ring.post(makeRecord(1, i));
+
+    QVERIFY(!ring.isBlocked());
+    QVERIFY(!ring.hasBacklog());
+
+    // The producer is not blocked, the records are kept in order until the consumer has made room
+    ring.post(makeRecord(1, 4));
+    ring.post(makeRecord(1, 5));
+    QVERIFY(ring.isBlocked());
+    QVERIFY(ring.hasBacklog());
+
+    QCOMPARE(drainValues(ring), QList<quint64>({0, 1, 2, 3}));
+    QVERIFY(ring.hasBacklog());
+    QVERIFY(ring.flush());
+    QVERIFY(!ring.isBlocked());
+    QVERIFY(!ring.hasBacklog());
+    QVERIFY(!ring.flush());
+
+    QCOMPARE(drainValues(ring), QList<quint64>({4, 5}));
+    QCOMPARE(ring.droppedCount(), quint64(0));
+
+    // A partial flush keeps the producer blocked
+    for (quint64 i = 6; i < 12; ++i)
+        ring.post(makeRecord(1, i));
+    QVERIFY(ring.isBlocked());
+    QCOMPARE(ring.drain([](Ring::Record &) {}), qsizetype(4));
+    ring.post(makeRecord(1, 12));
+    QVERIFY(!ring.isBlocked());
+    QCOMPARE(drainValues(ring), QList<quint64>({10, 11, 12}));
+}
+
+void Tst_NotificationRing::blockAfterClose()
+{
+    Ring ring(2, Policy::Block);
+
+    for (quint64 i = 0; i < 3; ++i)
+        ring.post(makeRecord(1, i));
+    QVERIFY(ring.isBlocked());
+
+    ring.close();
+    QVERIFY(!ring.isBlocked());
+    QVERIFY(!ring.post(makeRecord(1, 3)));
+    QCOMPARE(ring.droppedCount(), quint64(1));
+    QCOMPARE(drainValues(ring), QList<quint64>({0, 1}));
+}
+
+void Tst_NotificationRing::conflate()
+{
+    Ring ring(2, Policy::Conflate);
+
+    ring.post(makeRecord(1, 0));
+    ring.post(makeRecord(2, 1));
+
+    // Only the newest record per handle is kept, in the order of the first record of each handle
+    ring.post(makeRecord(3, 2));
+    ring.post(makeRecord(4, 3));
+    ring.post(makeRecord(3, 4));
+    QVERIFY(!ring.isBlocked());
+    QVERIFY(ring.hasBacklog());
+    QCOMPARE(ring.conflatedCount(), quint64(1));
+
+    QCOMPARE(drainValues(ring), QList<quint64>({0, 1}));
+    QVERIFY(ring.flush());
+    QVERIFY(!ring.hasBacklog());
+
+    // The backlog keeps the order in which the handles have been added
+    QCOMPARE(drainValues(ring), QList<quint64>({4, 3}));
+    QCOMPARE(ring.droppedCount(), quint64(0));
+}
+
+void Tst_NotificationRing::concurrentProducerAndConsumer_data()
+{
+    QTest::addColumn<int>("policy");
+
+    QTest::newRow("Block") << int(Policy::Block);
+    QTest::newRow("DropOldest") << int(Policy::DropOldest);
+    QTest::newRow("Conflate") << int(Policy::Conflate);
+}
+
+void Tst_NotificationRing::concurrentProducerAndConsumer()
+{
+    QFETCH(int, policy);
+
+    constexpr quint64 recordCount = 200000;
+    constexpr quint64 handleCount = 16;
+
+    Ring ring(64, static_cast<Policy>(policy));
+    std::atomic<bool> producerFinished {false};
+
+    std::unique_ptr<QThread> producer(QThread::create([&ring, &producerFinished]() {
+        for (quint64 i = 0; i < recordCount; ++i) {
+            // Like the backends, the producer doesn't produce records while it is blocked
+            while (ring.isBlocked()) {
+                ring.flush();
+                QThread::yieldCurrentThread();
+            }
+            ring.post(makeRecord(i % handleCount, i));
+        }
+
+        while (ring.hasBacklog()) {
+            ring.flush();
+            QThread::yieldCurrentThread();
+        }
+        producerFinished.store(true, std::memory_order_release);
+    }));
+    producer->start();
+
+    QList<quint64> values;
+    QHash<quint64, quint64> lastValues;
+    bool ordered = true;
+
+    const auto handler = [&](Ring::Record &record) {
+        const quint64 value = record.change.toULongLong();
+        const auto last = lastValues.constFind(record.handle);
+        // Conflation only keeps the order per handle
+        if (record.handle != value % handleCount || (last != lastValues.cend() && *last >= value)
+                || (policy != int(Policy::Conflate) && !values.isEmpty() && values.last() >= value)) {
+            ordered = false;
+        }
+        values.push_back(value);
+        lastValues.insert(record.handle, value);
+    };
+
+    while (!producerFinished.load(std::memory_order_acquire)) {
+        if (!ring.drain(handler))
+            QThread::yieldCurrentThread();
+    }
+    ring.drain(handler);
+
+    QVERIFY(producer->wait(10000));
+    QVERIFY(ordered);
+
+    switch (static_cast<Policy>(policy)) {
+    case Policy::Block:
+        QCOMPARE(quint64(values.size()), recordCount);
+        QCOMPARE(ring.droppedCount(), quint64(0));
+        break;
+    case Policy::DropOldest:
+        QCOMPARE(quint64(values.size()) + ring.droppedCount(), recordCount);
+        QCOMPARE(values.last(), recordCount - 1);
+        break;
+    case Policy::Conflate:
+        QCOMPARE(quint64(values.size()) + ring.conflatedCount(), recordCount);
+        QCOMPARE(ring.droppedCount(), quint64(0));
+        // The newest record of each handle is never conflated away
+        QCOMPARE(quint64(lastValues.size()), handleCount);
+        for (auto it = lastValues.cbegin(); it != lastValues.cend(); ++it)
+            QCOMPARE(it.value(), recordCount - handleCount + it.key());
+        break;
+    }
+}
+
+QTEST_GUILESS_MAIN(Tst_NotificationRing)
+
+#include "tst_notificationring.moc"
@@ -0,0 +1,198 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include "qopen62541logsink.h"
+
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QSet>
+#include <QtCore/QThread>
+
+#include <QtTest/QtTest>
+
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541, "qt.opcua.plugins.open62541")
+QT_END_NAMESPACE
+
+struct LoggedMessage
+{
+    QString category;
+    QString text;
+    QThread *thread = nullptr;
+};
+
+static QMutex messagesMutex;
+static QList<LoggedMessage> loggedMessages;
+
+static void messageHandler(QtMsgType, const QMessageLogContext &context, const QString &message)
+{
+    const QMutexLocker locker(&messagesMutex);
+    loggedMessages.push_back({ QString::fromLatin1(context.category), message, QThread::currentThread() });
+}
+
+static QList<LoggedMessage> takeMessages()
+{
+    const QMutexLocker locker(&messagesMutex);
+    return std::exchange(loggedMessages, {});
+}
+
+static qsizetype messageCount()
+{
+    const QMutexLocker locker(&messagesMutex);
+    return loggedMessages.size();
+}
+
+class Tst_Open62541LogSink : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+
+    void sharedLoggerThread();
+    void truncatedMessages();
+    void flushOnDestruction();
+    void droppedMessages();
+
+private:
+    QtMessageHandler m_previousHandler = nullptr;
+};
+
+void Tst_Open62541LogSink::initTestCase()
+{
+    QLoggingCategory::setFilterRules(QStringLiteral("qt.opcua.plugins.open62541*=true"));
+    m_previousHandler = qInstallMessageHandler(messageHandler);
+}
+
+void Tst_Open62541LogSink::cleanupTestCase()
+{
+    qInstallMessageHandler(m_previousHandler);
+}
+
+void Tst_Open62541LogSink::init()
+{
+    takeMessages();
+}
+
+void Tst_Open62541LogSink::sharedLoggerThread()
+{
+    constexpr int sinkCount = 8;
+
+    std::vector<std::unique_ptr<QOpen62541LogSink>> sinks;
+    for (int i = 0; i < sinkCount; ++i)
+        sinks.push_back(std::make_unique<QOpen62541LogSink>());
+
+    for (int i = 0; i < sinkCount; ++i)
+        sinks[i]->post(UA_LOGCATEGORY_CLIENT, QtInfoMsg, QByteArray::number(i).constData());
+
+    QTRY_COMPARE(messageCount(), sinkCount);
+
+    // All sinks are drained by one low priority thread
+    const auto messages = takeMessages();
+    QSet<QThread *> threads;
+    QSet<QString> texts;
+    for (const auto &message : messages) {
+        QCOMPARE(message.category, QStringLiteral("qt.opcua.plugins.open62541.sdk.client"));
+        threads.insert(message.thread);
+        texts.insert(message.text);
+    }
+
+    QCOMPARE(threads.size(), 1);
+    QThread *loggerThread = *threads.cbegin();
+    QVERIFY(loggerThread != QThread::currentThread());
+    QCOMPARE(loggerThread->objectName(), QStringLiteral("QOpen62541LogSink"));
+    QCOMPARE(texts.size(), sinkCount);
+
+    // A sink created while others exist uses the same thread
+    QOpen62541LogSink additionalSink;
+    additionalSink.post(UA_LOGCATEGORY_NETWORK, QtWarningMsg, "additional");
+    QTRY_COMPARE(messageCount(), 1);
+    QCOMPARE(takeMessages().constFirst().thread, loggerThread);
+}
+
+void Tst_Open62541LogSink::truncatedMessages()
+{
+    QOpen62541LogSink sink;
+
+    const QByteArray longMessage(1000, 'x');
+    const QByteArray exactMessage(QOpen62541LogSink::MaxMessageLength - 1, 'y');
+
+    sink.post(UA_LOGCATEGORY_CLIENT, QtWarningMsg, "short");
+    sink.post(UA_LOGCATEGORY_CLIENT, QtWarningMsg, longMessage.constData());
+    sink.post(UA_LOGCATEGORY_CLIENT, QtWarningMsg, exactMessage.constData());
+    // Truncated while formatting by the backend
+    sink.post(UA_LOGCATEGORY_CLIENT, QtWarningMsg, "formatted", true);
+
+    QTRY_COMPARE(messageCount(), 4);
+    const auto messages = takeMessages();
+
+    QCOMPARE(messages.at(0).text, QStringLiteral("short"));
+    QCOMPARE(messages.at(1).text, QString::fromLatin1(longMessage.left(QOpen62541LogSink::MaxMessageLength - 1))
+             + QLatin1StringView("... [truncated]"));
+    QCOMPARE(messages.at(2).text, QString::fromLatin1(exactMessage));
+    QCOMPARE(messages.at(3).text, QStringLiteral("formatted... [truncated]"));
+
+    // Synchronous logging
+    QOpen62541LogSink::write(UA_LOGCATEGORY_SESSION, QtWarningMsg, "sync", true);
+    QOpen62541LogSink::write(UA_LOGCATEGORY_SESSION, QtWarningMsg, "sync");
+    const auto syncMessages = takeMessages();
+    QCOMPARE(syncMessages.size(), 2);
+    QCOMPARE(syncMessages.at(0).text, QStringLiteral("sync... [truncated]"));
+    QCOMPARE(syncMessages.at(1).text, QStringLiteral("sync"));
+    QCOMPARE(syncMessages.at(0).thread, QThread::currentThread());
+}
+
+void Tst_Open62541LogSink::flushOnDestruction()
+{
+    constexpr int count = 100; // Less than the capacity, nothing is dropped
+
+    {
+        QOpen62541LogSink sink;
+        for (int i = 0; i < count; ++i)
+            sink.post(UA_LOGCATEGORY_USERLAND, QtInfoMsg, QByteArray::number(i).constData());
+    }
+
+    // The remaining messages have been written by the destructor
+    const auto messages = takeMessages();
+    QCOMPARE(messages.size(), count);
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(messages.at(i).text, QString::number(i));
+}
+
+void Tst_Open62541LogSink::droppedMessages()
+{
+    constexpr int count = 20000;
+
+    {
+        QOpen62541LogSink sink;
+        for (int i = 0; i < count; ++i)
+            sink.post(UA_LOGCATEGORY_USERLAND, QtInfoMsg, "message");
+    }
+
+    // Every message is either written or counted as dropped
+    static const QRegularExpression droppedPattern(QStringLiteral("^Dropped (\\d+) SDK log messages"));
+    qsizetype written = 0;
+    qsizetype dropped = 0;
+    for (const auto &message : takeMessages()) {
+        if (message.category == QLatin1StringView("qt.opcua.plugins.open62541.sdk.userland")) {
+            QCOMPARE(message.text, QStringLiteral("message"));
+            ++written;
+        } else {
+            const auto match = droppedPattern.match(message.text);
+            QVERIFY2(match.hasMatch(), qPrintable(message.text));
+            dropped += match.captured(1).toLongLong();
+        }
+    }
+
+    QCOMPARE(written + dropped, count);
+}
+
+QTEST_GUILESS_MAIN(Tst_Open62541LogSink)
+
+#include "tst_open62541logsink.moc"
@@ -0,0 +1,264 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include "qopen62541requesttable.h"
+
+#include <QtCore/QList>
+#include <QtCore/QRandomGenerator>
+#include <QtCore/QString>
+
+#include <QtTest/QtTest>
+
+#include <algorithm>
+#include <limits>
+
+struct ReadContext {
+    quint32 handle = 0;
+    QString nodeId;
+};
+
+struct BrowseContext {
+    quint32 handle = 0;
+    QList<QString> results;
+};
+
+using RequestTable = QOpen62541RequestTable<ReadContext, BrowseContext>;
+
+class Tst_Open62541RequestTable : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void serviceIndex();
+    void addAndComplete();
+    void completeWithWrongType();
+    void completeUnknownRequest();
+    void timedOutRequests();
+    void collidingRequestIds();
+    void growAndReuseSlots();
+    void removeAll();
+    void clear();
+};
+
+void Tst_Open62541RequestTable::serviceIndex()
+{
+    QCOMPARE(RequestTable::ServiceCount, size_t(2));
+    QCOMPARE(RequestTable::serviceIndex<ReadContext>(), size_t(0));
+    QCOMPARE(RequestTable::serviceIndex<BrowseContext>(), size_t(1));
+}
+
+void Tst_Open62541RequestTable::addAndComplete()
+{
+    RequestTable table;
+    QCOMPARE(table.size(), size_t(0));
+    QCOMPARE(table.inFlight(0), 0u);
+    QCOMPARE(table.inFlight(1), 0u);
+    QCOMPARE(table.inFlight(2), 0u); // Out of range
+
+    table.insert(1, ReadContext{ 10, QStringLiteral("ns=2;s=Read") });
+    table.insert(2, BrowseContext{ 20, { QStringLiteral("a"), QStringLiteral("b") } });
+    table.insert(3, ReadContext{ 30, QStringLiteral("ns=2;s=Read2") });
+
+    QCOMPARE(table.size(), size_t(3));
+    QCOMPARE(table.inFlight(RequestTable::serviceIndex<ReadContext>()), 2u);
+    QCOMPARE(table.inFlight(RequestTable::serviceIndex<BrowseContext>()), 1u);
+    QCOMPARE(table.inFlight<ReadContext>(), 2u);
+    QCOMPARE((table.inFlight<ReadContext, BrowseContext>()), 3u);
+    QCOMPARE(table.inFlight<>(), 0u);
+
+    const auto browse = table.take<BrowseContext>(2);
+    QCOMPARE(browse.handle, 20u);
+    QCOMPARE(browse.results, QList<QString>({ QStringLiteral("a"), QStringLiteral("b") }));
+    QCOMPARE(table.size(), size_t(2));
+    QCOMPARE(table.inFlight(RequestTable::serviceIndex<BrowseContext>()), 0u);
+
+    const auto read = table.take<ReadContext>(3);
+    QCOMPARE(read.handle, 30u);
+    QCOMPARE(read.nodeId, QStringLiteral("ns=2;s=Read2"));
+
+    // A request completes only once
+    QCOMPARE(table.take<ReadContext>(3).handle, 0u);
+
+    QCOMPARE(table.take<ReadContext>(1).handle, 10u);
+    QCOMPARE(table.size(), size_t(0));
+    QCOMPARE(table.inFlight(RequestTable::serviceIndex<ReadContext>()), 0u);
+}
+
+void Tst_Open62541RequestTable::completeWithWrongType()
+{
+    RequestTable table;
+    table.insert(5, ReadContext{ 1, QStringLiteral("x") });
+
+    // The entry is kept if the callback expects a different service
+    const auto browse = table.take<BrowseContext>(5);
+    QCOMPARE(browse.handle, 0u);
+    QVERIFY(browse.results.isEmpty());
+    QCOMPARE(table.size(), size_t(1));
+    QCOMPARE(table.inFlight(0), 1u);
+
+    QCOMPARE(table.take<ReadContext>(5).nodeId, QStringLiteral("x"));
+    QCOMPARE(table.size(), size_t(0));
+}
+
+void Tst_Open62541RequestTable::completeUnknownRequest()
+{
+    RequestTable table;
+    QCOMPARE(table.take<ReadContext>(42).handle, 0u);
+
+    table.insert(1, ReadContext{ 1, {} });
+    QCOMPARE(table.take<ReadContext>(42).handle, 0u);
+    QCOMPARE(table.size(), size_t(1));
+    QCOMPARE(table.inFlight(0), 1u);
+}
+
+void Tst_Open62541RequestTable::timedOutRequests()
+{
+    // Timed out requests are completed by the SDK with BadTimeout through the same callback,
+    // but in a different order than they have been sent. The other requests must stay reachable.
+    RequestTable table;
+    constexpr quint32 requestCount = 200;
+
+    for (quint32 id = 1; id <= requestCount; ++id)
+        table.insert(id, ReadContext{ id, QString::number(id) });
+
+    // Every third request times out, starting with the newest ones
+    for (quint32 id = requestCount; id >= 1; --id) {
+        if (id % 3 == 0)
+            QCOMPARE(table.take<ReadContext>(id).handle, id);
+    }
+
+    QCOMPARE(table.size(), size_t(requestCount - requestCount / 3));
+    QCOMPARE(table.inFlight(0), requestCount - requestCount / 3);
+
+    for (quint32 id = 1; id <= requestCount; ++id) {
+        const auto context = table.take<ReadContext>(id);
+        if (id % 3 == 0) {
+            QCOMPARE(context.handle, 0u);
+        } else {
+            QCOMPARE(context.handle, id);
+            QCOMPARE(context.nodeId, QString::number(id));
+        }
+    }
+
+    QCOMPARE(table.size(), size_t(0));
+    QCOMPARE(table.inFlight(0), 0u);
+}
+
+void Tst_Open62541RequestTable::collidingRequestIds()
+{
+    // Request ids which are a multiple of the capacity apart land in the same bucket
+    RequestTable table;
+    constexpr quint32 stride = 1024;
+    const QList<quint32> ids { 7, 7 + stride, 7 + 2 * stride, 8, 7 + 3 * stride, 9 };
+
+    for (const auto id : ids)
+        table.insert(id, ReadContext{ id, {} });
+
+    // Removing from the middle of a probe sequence must not hide the entries behind it
+    QCOMPARE(table.take<ReadContext>(7 + stride).handle, 7 + stride);
+    QCOMPARE(table.take<ReadContext>(7).handle, 7);
+
+    for (const auto id : { 8u, 7 + 3 * stride, 9u, 7 + 2 * stride })
+        QCOMPARE(table.take<ReadContext>(id).handle, id);
+
+    QCOMPARE(table.size(), size_t(0));
+
+    // Request ids wrap around
+    const quint32 maxId = std::numeric_limits<quint32>::max();
+    table.insert(maxId, ReadContext{ 1, {} });
+    table.insert(0, ReadContext{ 2, {} });
+    table.insert(1, ReadContext{ 3, {} });
+    QCOMPARE(table.take<ReadContext>(0).handle, 2u);
+    QCOMPARE(table.take<ReadContext>(maxId).handle, 1u);
+    QCOMPARE(table.take<ReadContext>(1).handle, 3u);
+}
+
+void Tst_Open62541RequestTable::growAndReuseSlots()
+{
+    RequestTable table;
+    QRandomGenerator random(1234);
+
+    QList<quint32> inFlight;
+    quint32 nextId = 1;
+    quint32 reads = 0;
+
+    for (int round = 0; round < 20; ++round) {
+        // Add a burst of requests, the table grows beyond its initial capacity
+        for (int i = 0; i < 100; ++i) {
+            const quint32 id = nextId++;
+            if (id % 2) {
+                table.insert(id, ReadContext{ id, QString::number(id) });
+                ++reads;
+            } else {
+                table.insert(id, BrowseContext{ id, { QString::number(id) } });
+            }
+            inFlight.push_back(id);
+        }
+
+        // Complete a random subset, the slots are reused by the next burst
+        std::shuffle(inFlight.begin(), inFlight.end(), random);
+        const qsizetype toComplete = inFlight.size() * 3 / 4;
+        for (qsizetype i = 0; i < toComplete; ++i) {
+            const quint32 id = inFlight.takeLast();
+            if (id % 2) {
+                const auto context = table.take<ReadContext>(id);
+                QCOMPARE(context.handle, id);
+                QCOMPARE(context.nodeId, QString::number(id));
+                --reads;
+            } else {
+                const auto context = table.take<BrowseContext>(id);
+                QCOMPARE(context.handle, id);
+                QCOMPARE(context.results, QList<QString>({ QString::number(id) }));
+            }
+        }
+
+        QCOMPARE(table.size(), size_t(inFlight.size()));
+        QCOMPARE(table.inFlight(0), reads);
+        QCOMPARE(table.inFlight(1), quint32(inFlight.size()) - reads);
+    }
+}
+
+void Tst_Open62541RequestTable::removeAll()
+{
+    RequestTable table;
+    for (quint32 id = 1; id <= 100; ++id) {
+        if (id % 4)
+            table.insert(id, ReadContext{ id, {} });
+        else
+            table.insert(id, BrowseContext{ id, {} });
+    }
+
+    table.removeAll<ReadContext>();
+    QCOMPARE(table.size(), size_t(25));
+    QCOMPARE(table.inFlight(0), 0u);
+    QCOMPARE(table.inFlight(1), 25u);
+
+    for (quint32 id = 1; id <= 100; ++id) {
+        if (id % 4)
+            QCOMPARE(table.take<ReadContext>(id).handle, 0u);
+        else
+            QCOMPARE(table.take<BrowseContext>(id).handle, id);
+    }
+    QCOMPARE(table.size(), size_t(0));
+}
+
+void Tst_Open62541RequestTable::clear()
+{
+    RequestTable table;
+    for (quint32 id = 1; id <= 10; ++id)
+        table.insert(id, ReadContext{ id, {} });
+
+    table.clear();
+    QCOMPARE(table.size(), size_t(0));
+    QCOMPARE(table.inFlight(0), 0u);
+    QCOMPARE(table.take<ReadContext>(1).handle, 0u);
+
+    // The table is usable after clearing it
+    table.insert(1, BrowseContext{ 1, {} });
+    QCOMPARE(table.inFlight(1), 1u);
+    QCOMPARE(table.take<BrowseContext>(1).handle, 1u);
+}
+
+QTEST_APPLESS_MAIN(Tst_Open62541RequestTable)
+
+#include "tst_open62541requesttable.moc"
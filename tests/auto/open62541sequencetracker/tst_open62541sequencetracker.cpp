@@ -0,0 +1,209 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include "qopen62541sequencetracker.h"
+
+#include <QtTest/QtTest>
+
+using Order = QOpen62541SequenceTracker::Order;
+
+class Tst_Open62541SequenceTracker : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void arithmetic();
+    void inOrder();
+    void keepAlive();
+    void duplicates();
+    void gap();
+    void gapAfterKeepAlive();
+    void wrapAround();
+    void gapAcrossWrapAround();
+    void droppedMessageRepublished();
+    void droppedMessageArrivesLate();
+    void reset();
+};
+
+void Tst_Open62541SequenceTracker::arithmetic()
+{
+    QCOMPARE(QOpen62541SequenceTracker::next(1), 2u);
+    QCOMPARE(QOpen62541SequenceTracker::next(0xFFFFFFFEu), 0xFFFFFFFFu);
+    QCOMPARE(QOpen62541SequenceTracker::next(0xFFFFFFFFu), 1u); // 0 is skipped
+
+    QCOMPARE(QOpen62541SequenceTracker::distance(1, 1), 0u);
+    QCOMPARE(QOpen62541SequenceTracker::distance(1, 4), 3u);
+    QCOMPARE(QOpen62541SequenceTracker::distance(0xFFFFFFFFu, 1), 1u);
+    QCOMPARE(QOpen62541SequenceTracker::distance(0xFFFFFFFEu, 2), 3u);
+
+    QVERIFY(QOpen62541SequenceTracker::isBefore(1, 2));
+    QVERIFY(!QOpen62541SequenceTracker::isBefore(2, 1));
+    QVERIFY(!QOpen62541SequenceTracker::isBefore(5, 5));
+    QVERIFY(QOpen62541SequenceTracker::isBefore(0xFFFFFFFFu, 1));
+    QVERIFY(!QOpen62541SequenceTracker::isBefore(1, 0xFFFFFFFFu));
+    QVERIFY(QOpen62541SequenceTracker::isBefore(0xFFFFFFF0u, 0x10));
+}
+
+void Tst_Open62541SequenceTracker::inOrder()
+{
+    QOpen62541SequenceTracker tracker;
+    QCOMPARE(tracker.nextSequenceNumber(), 1u);
+
+    for (quint32 i = 1; i <= 10; ++i) {
+        QCOMPARE(tracker.track(i, false), Order::InOrder);
+        QCOMPARE(tracker.gapSize(), 0u);
+    }
+    QCOMPARE(tracker.nextSequenceNumber(), 11u);
+    QCOMPARE(tracker.missingCount(), qsizetype(0));
+}
+
+void Tst_Open62541SequenceTracker::keepAlive()
+{
+    QOpen62541SequenceTracker tracker;
+
+    // A keep-alive message announces the next sequence number without consuming it
+    QCOMPARE(tracker.track(1, true), Order::InOrder);
+    QCOMPARE(tracker.nextSequenceNumber(), 1u);
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+    QCOMPARE(tracker.track(2, true), Order::InOrder);
+    QCOMPARE(tracker.track(2, true), Order::InOrder);
+    QCOMPARE(tracker.track(2, false), Order::InOrder);
+    QCOMPARE(tracker.nextSequenceNumber(), 3u);
+}
+
+void Tst_Open62541SequenceTracker::duplicates()
+{
+    QOpen62541SequenceTracker tracker;
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+    QCOMPARE(tracker.track(2, false), Order::InOrder);
+
+    QCOMPARE(tracker.track(2, false), Order::Duplicate);
+    QCOMPARE(tracker.track(1, false), Order::Duplicate);
+    QCOMPARE(tracker.track(2, true), Order::Duplicate);
+    QCOMPARE(tracker.nextSequenceNumber(), 3u);
+}
+
+void Tst_Open62541SequenceTracker::gap()
+{
+    QOpen62541SequenceTracker tracker;
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+
+    QCOMPARE(tracker.track(4, false), Order::Gap);
+    QCOMPARE(tracker.gapStart(), 2u);
+    QCOMPARE(tracker.gapSize(), 2u);
+    QVERIFY(!tracker.isInGap(1));
+    QVERIFY(tracker.isInGap(2));
+    QVERIFY(tracker.isInGap(3));
+    QVERIFY(!tracker.isInGap(4));
+    QCOMPARE(tracker.nextSequenceNumber(), 5u);
+
+    // Messages of the gap which have not been requested again are duplicates
+    QCOMPARE(tracker.track(3, false), Order::Duplicate);
+    QCOMPARE(tracker.track(5, false), Order::InOrder);
+    QCOMPARE(tracker.gapSize(), 0u);
+}
+
+void Tst_Open62541SequenceTracker::gapAfterKeepAlive()
+{
+    QOpen62541SequenceTracker tracker;
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+
+    // Message 2 has been lost, the keep-alive announces 3
+    QCOMPARE(tracker.track(3, true), Order::Gap);
+    QCOMPARE(tracker.gapStart(), 2u);
+    QCOMPARE(tracker.gapSize(), 1u);
+    QCOMPARE(tracker.nextSequenceNumber(), 3u);
+    QCOMPARE(tracker.track(3, false), Order::InOrder);
+}
+
+void Tst_Open62541SequenceTracker::wrapAround()
+{
+    QOpen62541SequenceTracker tracker;
+    tracker.reset(0xFFFFFFFEu);
+
+    QCOMPARE(tracker.track(0xFFFFFFFEu, false), Order::InOrder);
+    QCOMPARE(tracker.track(0xFFFFFFFFu, false), Order::InOrder);
+    QCOMPARE(tracker.nextSequenceNumber(), 1u);
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+    QCOMPARE(tracker.nextSequenceNumber(), 2u);
+
+    QCOMPARE(tracker.track(0xFFFFFFFFu, false), Order::Duplicate);
+}
+
+void Tst_Open62541SequenceTracker::gapAcrossWrapAround()
+{
+    QOpen62541SequenceTracker tracker;
+    tracker.reset(0xFFFFFFFEu);
+    QCOMPARE(tracker.track(0xFFFFFFFEu, false), Order::InOrder);
+
+    QCOMPARE(tracker.track(2, false), Order::Gap);
+    QCOMPARE(tracker.gapStart(), 0xFFFFFFFFu);
+    QCOMPARE(tracker.gapSize(), 2u);
+    QVERIFY(!tracker.isInGap(0xFFFFFFFEu));
+    QVERIFY(tracker.isInGap(0xFFFFFFFFu));
+    QVERIFY(tracker.isInGap(1));
+    QVERIFY(!tracker.isInGap(2));
+    QCOMPARE(tracker.nextSequenceNumber(), 3u);
+}
+
+void Tst_Open62541SequenceTracker::droppedMessageRepublished()
+{
+    QOpen62541SequenceTracker tracker;
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+
+    // Message 2 is dropped, message 3 reveals the gap and the server still has 1 to 3
+    QCOMPARE(tracker.track(3, false), Order::Gap);
+    const quint32 available[] = { 1, 2, 3 };
+    QList<quint32> requested;
+    for (const auto sequenceNumber : available) {
+        if (tracker.isInGap(sequenceNumber)) {
+            tracker.markMissing(sequenceNumber);
+            requested.push_back(sequenceNumber);
+        }
+    }
+    QCOMPARE(requested, QList<quint32>({ 2 }));
+    QCOMPARE(tracker.missingCount(), qsizetype(1));
+
+    // The Republish response delivers the message
+    QVERIFY(tracker.takeMissing(2));
+    QCOMPARE(tracker.missingCount(), qsizetype(0));
+
+    // The original message must not be delivered a second time
+    QCOMPARE(tracker.track(2, false), Order::Duplicate);
+    QCOMPARE(tracker.track(4, false), Order::InOrder);
+}
+
+void Tst_Open62541SequenceTracker::droppedMessageArrivesLate()
+{
+    QOpen62541SequenceTracker tracker;
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+    QCOMPARE(tracker.track(3, false), Order::Gap);
+    tracker.markMissing(2);
+
+    // A keep-alive never recovers a message
+    QCOMPARE(tracker.track(2, true), Order::Duplicate);
+    QCOMPARE(tracker.missingCount(), qsizetype(1));
+
+    // The original message overtakes the Republish response, which is then ignored
+    QCOMPARE(tracker.track(2, false), Order::Recovered);
+    QVERIFY(!tracker.takeMissing(2));
+    QCOMPARE(tracker.nextSequenceNumber(), 4u);
+}
+
+void Tst_Open62541SequenceTracker::reset()
+{
+    QOpen62541SequenceTracker tracker;
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+    QCOMPARE(tracker.track(5, false), Order::Gap);
+    tracker.markMissing(3);
+
+    tracker.reset();
+    QCOMPARE(tracker.nextSequenceNumber(), 1u);
+    QCOMPARE(tracker.missingCount(), qsizetype(0));
+    QCOMPARE(tracker.gapSize(), 0u);
+    QCOMPARE(tracker.track(1, false), Order::InOrder);
+}
+
+QTEST_APPLESS_MAIN(Tst_Open62541SequenceTracker)
+
+#include "tst_open62541sequencetracker.moc"
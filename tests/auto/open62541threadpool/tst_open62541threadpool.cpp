@@ -0,0 +1,188 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include "qopen62541threadpool.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtCore/QThread>
+
+#include <QtTest/QtTest>
+
+#include <atomic>
+
+// Stands in for a backend and records the thread it has been deleted in
+class Backend : public QObject
+{
+public:
+    explicit Backend(std::atomic<QThread *> *deletedIn = nullptr)
+        : m_deletedIn(deletedIn)
+    {}
+
+    ~Backend() override
+    {
+        if (m_deletedIn)
+            m_deletedIn->store(QThread::currentThread());
+    }
+
+private:
+    std::atomic<QThread *> *m_deletedIn;
+};
+
+class Tst_Open62541ThreadPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void sharedInstance();
+    void balanceByBackendCount();
+    void balanceByBusyTime();
+    void detach();
+    void detachFromPoolThread();
+};
+
+void Tst_Open62541ThreadPool::sharedInstance()
+{
+    {
+        const auto pool = QOpen62541ThreadPool::instance(2);
+        // The thread count of an existing pool is not changed
+        const auto samePool = QOpen62541ThreadPool::instance(5);
+        QCOMPARE(pool.get(), samePool.get());
+
+        QHash<QThread *, int> backendsPerThread;
+        QList<QPair<QOpen62541ThreadPool::Slot *, Backend *>> attached;
+        for (int i = 0; i < 6; ++i) {
+            auto backend = new Backend();
+            auto slot = samePool->attach(backend);
+            QCOMPARE(backend->thread(), slot->thread);
+            QVERIFY(slot->thread != QThread::currentThread());
+            QVERIFY(slot->thread->isRunning());
+            QVERIFY(slot->thread->objectName().startsWith(QLatin1StringView("QOpen62541ThreadPool")));
+            ++backendsPerThread[slot->thread];
+            attached.push_back({ slot, backend });
+        }
+
+        QCOMPARE(backendsPerThread.size(), 2);
+        for (const auto count : std::as_const(backendsPerThread))
+            QCOMPARE(count, 3);
+
+        for (const auto &[slot, backend] : std::as_const(attached))
+            pool->detach(slot, backend);
+    }
+
+    // The pool has been destroyed with its last user, a new pool uses the new thread count
+    const auto pool = QOpen62541ThreadPool::instance(3);
+    QSet<QThread *> threads;
+    QList<QPair<QOpen62541ThreadPool::Slot *, Backend *>> attached;
+    for (int i = 0; i < 3; ++i) {
+        auto backend = new Backend();
+        auto slot = pool->attach(backend);
+        threads.insert(slot->thread);
+        attached.push_back({ slot, backend });
+    }
+
+    QCOMPARE(threads.size(), 3);
+
+    for (const auto &[slot, backend] : std::as_const(attached))
+        pool->detach(slot, backend);
+}
+
+void Tst_Open62541ThreadPool::balanceByBackendCount()
+{
+    QOpen62541ThreadPool pool(2);
+
+    auto first = new Backend();
+    auto firstSlot = pool.attach(first);
+    auto second = new Backend();
+    auto secondSlot = pool.attach(second);
+
+    // Without load, the backends are distributed by count
+    QVERIFY(firstSlot != secondSlot);
+    QVERIFY(first->thread() != second->thread());
+    QCOMPARE(firstSlot->backendCount, 1u);
+    QCOMPARE(secondSlot->backendCount, 1u);
+
+    // A detached backend frees its place
+    pool.detach(firstSlot, first);
+    QCOMPARE(firstSlot->backendCount, 0u);
+
+    auto third = new Backend();
+    QCOMPARE(pool.attach(third), firstSlot);
+    QCOMPARE(firstSlot->backendCount, 1u);
+
+    pool.detach(firstSlot, third);
+    pool.detach(secondSlot, second);
+}
+
+void Tst_Open62541ThreadPool::balanceByBusyTime()
+{
+    QOpen62541ThreadPool pool(2);
+
+    auto first = new Backend();
+    auto busySlot = pool.attach(first);
+    auto second = new Backend();
+    auto idleSlot = pool.attach(second);
+    QVERIFY(busySlot != idleSlot);
+
+    // The thread which has been busier since the last attach is avoided, even with fewer backends
+    auto third = new Backend();
+    busySlot->busyTimeNs.fetch_add(1000000);
+    QCOMPARE(pool.attach(third), idleSlot);
+    QCOMPARE(idleSlot->backendCount, 2u);
+
+    auto fourth = new Backend();
+    busySlot->busyTimeNs.fetch_add(1000000);
+    QCOMPARE(pool.attach(fourth), idleSlot);
+    QCOMPARE(idleSlot->backendCount, 3u);
+
+    // Only the busy time since the previous attach counts, ties are broken by the backend count
+    auto fifth = new Backend();
+    QCOMPARE(pool.attach(fifth), busySlot);
+    QCOMPARE(busySlot->backendCount, 2u);
+
+    pool.detach(busySlot, first);
+    pool.detach(idleSlot, second);
+    pool.detach(idleSlot, third);
+    pool.detach(idleSlot, fourth);
+    pool.detach(busySlot, fifth);
+    QCOMPARE(busySlot->backendCount, 0u);
+    QCOMPARE(idleSlot->backendCount, 0u);
+}
+
+void Tst_Open62541ThreadPool::detach()
+{
+    QOpen62541ThreadPool pool(1);
+
+    std::atomic<QThread *> deletedIn = nullptr;
+    auto backend = new Backend(&deletedIn);
+    auto slot = pool.attach(backend);
+
+    // The backend has been deleted in its thread when detach() returns
+    pool.detach(slot, backend);
+    QCOMPARE(deletedIn.load(), slot->thread);
+    QCOMPARE(slot->backendCount, 0u);
+}
+
+void Tst_Open62541ThreadPool::detachFromPoolThread()
+{
+    QOpen62541ThreadPool pool(1);
+
+    std::atomic<QThread *> deletedIn = nullptr;
+    auto backend = new Backend(&deletedIn);
+    auto slot = pool.attach(backend);
+
+    // Waiting for the own thread must not deadlock
+    std::atomic<bool> detached = false;
+    QMetaObject::invokeMethod(slot->context, [&]() {
+        pool.detach(slot, backend);
+        detached = true;
+    }, Qt::QueuedConnection);
+
+    QTRY_VERIFY(detached.load());
+    QCOMPARE(deletedIn.load(), slot->thread);
+    QCOMPARE(slot->backendCount, 0u);
+}
+
+QTEST_GUILESS_MAIN(Tst_Open62541ThreadPool)
+
+#include "tst_open62541threadpool.moc"
@@ -25,13 +25,19 @@
 #include <QtOpcUa/qopcuaattributeoperand.h>
 #include <QtOpcUa/qopcuaelementoperand.h>
 #include <QtOpcUa/qopcuarange.h>
+#include <QtOpcUa/qopcuareadgroup.h>
+#include <QtOpcUa/qopcuarecordingplayer.h>
+#include <QtOpcUa/qopcuasubscriptionrecorder.h>
+#include <QtOpcUa/qopcuatagsink.h>
 #include <QtOpcUa/qopcuastructuredefinition.h>
 #include <QtOpcUa/qopcuastructurefield.h>
 #include <QtOpcUa/qopcuaxvalue.h>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QProcess>
+#include <QtCore/QScopeGuard>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QTemporaryDir>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
@@ -41,6 +47,11 @@
 #include <QTcpServer>
 #include <QVariantMap>
 
+#include "../shared/testserverbackends.h"
+
+#include <memory>
+#include <vector>
+
 const int signalSpyTimeout = 10000;
 
 class OpcuaConnector
@@ -110,6 +121,48 @@ public:
     QOpcUaClient *opcuaClient;
 };
 
+class RecordingTagSink : public QOpcUaTagSink
+{
+public:
+    void tagAttributesRead(QOpcUaTagHandle tag, const QList<QOpcUaReadResult> &results,
+                           QOpcUa::UaStatusCode serviceResult) override
+    {
+        Q_UNUSED(serviceResult);
+        readTags.push_back(tag);
+        readResults.append(results);
+    }
+
+    void tagAttributeWritten(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute,
+                             QOpcUa::UaStatusCode statusCode) override
+    {
+        Q_UNUSED(tag);
+        Q_UNUSED(attribute);
+        writeResults.push_back(statusCode);
+    }
+
+    void tagMonitoringChanged(QOpcUaTagHandle tag, QOpcUa::NodeAttribute attribute, bool enabled,
+                              const QOpcUaMonitoringParameters &status) override
+    {
+        Q_UNUSED(tag);
+        Q_UNUSED(attribute);
+        if (enabled)
+            monitoringResults.push_back(status.statusCode());
+    }
+
+    void tagDataChanged(QOpcUaTagHandle tag, const QOpcUaReadResult &value) override
+    {
+        dataChangeTags.push_back(tag);
+        dataChanges.push_back(value);
+    }
+
+    QList<QOpcUaTagHandle> readTags;
+    QList<QOpcUaReadResult> readResults;
+    QList<QOpcUa::UaStatusCode> writeResults;
+    QList<QOpcUa::UaStatusCode> monitoringResults;
+    QList<QOpcUaTagHandle> dataChangeTags;
+    QList<QOpcUaReadResult> dataChanges;
+};
+
 const QString readWriteNode = QStringLiteral("ns=3;s=TestNode.ReadWrite");
 const QList<QString> xmlElements = {
     QStringLiteral("<?xml version=\"1\" encoding=\"UTF-8\"?>"),
@@ -527,6 +580,12 @@ private slots:
     void writeNodeAttributes();
     defineDataMethod(readNodeAttributes_data)
     void readNodeAttributes();
+    defineDataMethod(parsedNodeIds_data)
+    void parsedNodeIds();
+    defineDataMethod(readGroups_data)
+    void readGroups();
+    defineDataMethod(inFlightRequests_data)
+    void inFlightRequests();
 
     defineDataMethod(readDataTypeDefinition_data)
     void readDataTypeDefinition();
@@ -571,6 +630,8 @@ private slots:
     void dataChangeSubscriptionInvalidNode();
     defineDataMethod(dataChangeSubscriptionSharing_data)
     void dataChangeSubscriptionSharing();
+    defineDataMethod(dataChangeSubscriptionBatched_data)
+    void dataChangeSubscriptionBatched();
     defineDataMethod(methodCall_data)
     void dataChangeSubscriptionTriggering();
     defineDataMethod(dataChangeSubscriptionTriggering_data);
@@ -588,6 +649,28 @@ private slots:
 
     defineDataMethod(multipleClients_data)
     void multipleClients();
+    defineDataMethod(eventDrivenClientIterate_data)
+    void eventDrivenClientIterate();
+    defineDataMethod(sharedThreadPool_data)
+    void sharedThreadPool();
+    defineDataMethod(notificationRing_data)
+    void notificationRing();
+    defineDataMethod(valueTable_data)
+    void valueTable();
+    defineDataMethod(trendBuffer_data)
+    void trendBuffer();
+    defineDataMethod(subscriptionRecorder_data)
+    void subscriptionRecorder();
+    defineDataMethod(tagHandles_data)
+    void tagHandles();
+    defineDataMethod(batchedDataChanges_data)
+    void batchedDataChanges();
+    defineDataMethod(typedDataChanges_data)
+    void typedDataChanges();
+    defineDataMethod(requestWindow_data)
+    void requestWindow();
+    defineDataMethod(chunkedRequests_data)
+    void chunkedRequests();
     defineDataMethod(nodeClass_data)
     void nodeClass();
     defineDataMethod(writeArray_data)
@@ -616,6 +699,14 @@ private slots:
     void modifyMonitoredItem();
     defineDataMethod(addDuplicateMonitoredItem_data)
     void addDuplicateMonitoredItem();
+    defineDataMethod(sharedMonitoredItems_data)
+    void sharedMonitoredItems();
+    defineDataMethod(modifyMultipleMonitoredItems_data)
+    void modifyMultipleMonitoredItems();
+    defineDataMethod(subscriptionPartitioning_data)
+    void subscriptionPartitioning();
+    defineDataMethod(recoverMissingNotifications_data)
+    void recoverMissingNotifications();
     defineDataMethod(subscriptionUnreadableNode_data);
     void subscriptionUnreadableNode();
     defineDataMethod(checkMonitoredItemCleanup_data);
@@ -635,6 +726,8 @@ private slots:
 
     defineDataMethod(multiDimensionalArray_data)
     void multiDimensionalArray();
+    defineDataMethod(typedNumericArrays_data)
+    void typedNumericArrays();
 
     defineDataMethod(dateTimeConversion_data)
     void dateTimeConversion();
@@ -667,6 +760,7 @@ private slots:
     void encodeEmptyStringNodeId();
 
     void statusStrings();
+    void namespace0IdNames();
 
     defineDataMethod(readHistoryDataFromNode_data)
     void readHistoryDataFromNode();
@@ -753,9 +847,21 @@ private:
     QCOMPARE(resultSpy.at(0).at(1), QOpcUa::UaStatusCode::Good); \
 }
 
+// Skips the test for the other backends
+#define FETCH_OPEN62541_CLIENT(MESSAGE) \
+    QFETCH(QOpcUaClient *, opcuaClient); \
+    if (opcuaClient->backend() != QLatin1String("open62541")) \
+        QSKIP(MESSAGE)
+
+// Creates a client of the backend under test with backend properties and connects it until the end of the scope
+#define CREATE_CONNECTED_CLIENT(CLIENT, ...) \
+    QScopedPointer<QOpcUaClient> CLIENT(m_opcUa.createClient(opcuaClient->backend(), __VA_ARGS__)); \
+    QVERIFY(CLIENT != nullptr); \
+    OpcuaConnector CLIENT##Connector(CLIENT.get(), m_endpoint)
+
 Tst_QOpcUaClient::Tst_QOpcUaClient()
 {
-    m_backends = QOpcUaProvider::availableBackends();
+    m_backends = testServerBackends();
 }
 
 void Tst_QOpcUaClient::initTestCase()
@@ -1414,6 +1520,188 @@ void Tst_QOpcUaClient::readNodeAttributes()
     QCOMPARE(result[1].sourceTimestamp(), QDateTime::fromString(QStringLiteral("2018-08-03 01:00:00"), Qt::ISODate));
 }
 
+void Tst_QOpcUaClient::parsedNodeIds()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    bool ok = false;
+    const QOpcUaNodeId stringId = QOpcUaNodeId::fromString(u"ns=2;s=Demo.Static.Scalar.Double", &ok);
+    QVERIFY(ok);
+    QCOMPARE(stringId.identifierType(), QOpcUaNodeId::IdentifierType::String);
+    QCOMPARE(stringId.namespaceIndex(), quint16(2));
+    QCOMPARE(stringId.stringIdentifier(), QStringLiteral("Demo.Static.Scalar.Double"));
+    QCOMPARE(stringId, QOpcUaNodeId(2, QStringLiteral("Demo.Static.Scalar.Double")));
+    QCOMPARE(stringId.toString(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+
+    const QOpcUaNodeId numericId = QOpcUaNodeId::fromString(u"i=84", &ok);
+    QVERIFY(ok);
+    QCOMPARE(numericId, QOpcUaNodeId(0, quint32(84)));
+    QCOMPARE(numericId.toString(), QStringLiteral("ns=0;i=84"));
+
+    const QOpcUaNodeId guidId = QOpcUaNodeId::fromString(u"ns=3;g=08081e75-8e5e-319b-954f-f3a7613dc29b", &ok);
+    QVERIFY(ok);
+    QCOMPARE(guidId.guidIdentifier(), QUuid(QStringLiteral("08081e75-8e5e-319b-954f-f3a7613dc29b")));
+    QCOMPARE(guidId.toString(), QStringLiteral("ns=3;g=08081e75-8e5e-319b-954f-f3a7613dc29b"));
+
+    const QOpcUaNodeId opaqueId = QOpcUaNodeId::fromString(u"ns=3;b=UXQgZnR3IQ==", &ok);
+    QVERIFY(ok);
+    QCOMPARE(opaqueId.opaqueIdentifier(), QByteArray("Qt ftw!"));
+    QCOMPARE(opaqueId.toString(), QStringLiteral("ns=3;b=UXQgZnR3IQ=="));
+
+    QVERIFY(QOpcUaNodeId::fromString(u"ns=70000;i=1", &ok).isNull());
+    QVERIFY(!ok);
+    QVERIFY(QOpcUaNodeId::fromString(u"ns=2;x=1", &ok).isNull());
+    QVERIFY(!ok);
+    QVERIFY(QOpcUaNodeId::fromString(u"ns=2;i=1;s=2", &ok).isNull());
+    QVERIFY(!ok);
+    QVERIFY(QOpcUaNodeId::fromString(u"ns=2;i=abc", &ok).isNull());
+    QVERIFY(!ok);
+
+    QHash<QOpcUaNodeId, int> hash;
+    hash.insert(stringId, 1);
+    hash.insert(numericId, 2);
+    QCOMPARE(hash.value(QOpcUaNodeId(2, QStringLiteral("Demo.Static.Scalar.Double"))), 1);
+    QCOMPARE(hash.value(QOpcUaNodeId(0, quint32(84))), 2);
+    QVERIFY(!hash.contains(QOpcUaNodeId::fromOpaque(2, QByteArray("Demo.Static.Scalar.Double"))));
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(stringId));
+    QVERIFY(node != nullptr);
+    QCOMPARE(node->nodeId(), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    READ_MANDATORY_VARIABLE_NODE(node);
+    QCOMPARE(node->valueAttribute(), 23.0);
+
+    QVERIFY(opcuaClient->node(QOpcUaNodeId()) == nullptr);
+
+    QList<QOpcUaReadItem> request;
+    request.push_back(QOpcUaReadItem(stringId));
+    request.push_back(QOpcUaReadItem(QOpcUaNodeId(0, quint32(QOpcUa::NodeIds::Namespace0::Server_ServerStatus_State))));
+
+    QCOMPARE(request.at(0).parsedNodeId(), stringId);
+    QCOMPARE(request.at(0).nodeId(), stringId.toString());
+
+    QSignalSpy readNodeAttributesSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+    opcuaClient->readNodeAttributes(request);
+    readNodeAttributesSpy.wait(signalSpyTimeout);
+    QCOMPARE(readNodeAttributesSpy.size(), 1);
+    QCOMPARE(readNodeAttributesSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const auto result = readNodeAttributesSpy.at(0).at(0).value<QList<QOpcUaReadResult>>();
+    QCOMPARE(result.size(), 2);
+    for (int i = 0; i < result.size(); ++i) {
+        QCOMPARE(result[i].statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(result[i].nodeId(), request[i].nodeId());
+    }
+    QCOMPARE(result[0].value(), 23.0);
+    if (opcuaClient->backend() == QLatin1String("open62541"))
+        QCOMPARE(result[0].parsedNodeId(), stringId);
+}
+
+void Tst_QOpcUaClient::readGroups()
+{
+    FETCH_OPEN62541_CLIENT("Read groups are only supported by the open62541 backend");
+
+    QVERIFY(opcuaClient->createReadGroup({ QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")) }) == nullptr);
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QVERIFY(opcuaClient->createReadGroup({}) == nullptr);
+
+    const QList<QOpcUaReadItem> request {
+        QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")),
+        QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"), QOpcUa::NodeAttribute::DisplayName),
+        QOpcUaReadItem(QOpcUaNodeId(0, quint32(QOpcUa::NodeIds::Namespace0::Server_ServerStatus_State))),
+        QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.DoesNotExist"))
+    };
+
+    for (const bool useRegisteredNodes : { false, true }) {
+        QScopedPointer<QOpcUaReadGroup> group(opcuaClient->createReadGroup(request, useRegisteredNodes));
+        QVERIFY(group != nullptr);
+        QCOMPARE(group->useRegisteredNodes(), useRegisteredNodes);
+        QCOMPARE(group->nodesToRead(), request);
+        QCOMPARE(group->results().size(), request.size());
+        QCOMPARE(group->results().at(0).statusCode(), QOpcUa::UaStatusCode::BadWaitingForInitialData);
+
+        QSignalSpy stateSpy(group.get(), &QOpcUaReadGroup::stateChanged);
+        QSignalSpy readSpy(group.get(), &QOpcUaReadGroup::readFinished);
+
+        // A read requested while the group is being prepared is sent when the group is ready
+        QVERIFY(group->read());
+
+        QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 1, signalSpyTimeout);
+        QCOMPARE(group->state(), QOpcUaReadGroup::State::Ready);
+        QCOMPARE(stateSpy.size(), 1);
+        QCOMPARE(readSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+        auto results = group->results();
+        QCOMPARE(results.size(), request.size());
+        for (qsizetype i = 0; i < results.size(); ++i) {
+            QCOMPARE(results.at(i).nodeId(), request.at(i).nodeId());
+            QCOMPARE(results.at(i).attribute(), request.at(i).attribute());
+        }
+        QCOMPARE(results.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(results.at(0).value(), 23.0);
+        QCOMPARE(results.at(1).value().value<QOpcUaLocalizedText>().text(), QStringLiteral("DoubleScalarTest"));
+        QCOMPARE(results.at(2).statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(results.at(2).value().toInt(), 0); // ServerState::Running
+        QVERIFY(results.at(2).serverTimestamp().isValid());
+        QCOMPARE(results.at(3).statusCode(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+
+        readSpy.clear();
+        QVERIFY(group->startCyclicRead(50));
+        QCOMPARE(group->cyclicReadInterval(), 50);
+        QTRY_VERIFY_WITH_TIMEOUT(readSpy.size() >= 3, signalSpyTimeout);
+        group->stopCyclicRead();
+        QCOMPARE(group->cyclicReadInterval(), 0);
+
+        for (const auto &args : readSpy)
+            QCOMPARE(args.at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(group->results().at(0).value(), 23.0);
+    }
+
+    QScopedPointer<QOpcUaReadGroup> group(opcuaClient->createReadGroup(request));
+    QVERIFY(group != nullptr);
+    QTRY_COMPARE_WITH_TIMEOUT(group->state(), QOpcUaReadGroup::State::Ready, signalSpyTimeout);
+
+    // The group becomes unusable when the client disconnects
+    opcuaClient->disconnectFromEndpoint();
+    QTRY_COMPARE_WITH_TIMEOUT(group->state(), QOpcUaReadGroup::State::Error, signalSpyTimeout);
+    QCOMPARE(group->serviceResult(), QOpcUa::UaStatusCode::BadDisconnect);
+    QVERIFY(!group->read());
+}
+
+void Tst_QOpcUaClient::inFlightRequests()
+{
+    FETCH_OPEN62541_CLIENT("Request counters are only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    auto counters = opcuaClient->inFlightRequests();
+    QVERIFY(counters.contains(QOpcUaClient::Service::Read));
+    QVERIFY(counters.contains(QOpcUaClient::Service::Browse));
+    QVERIFY(counters.contains(QOpcUaClient::Service::CreateMonitoredItems));
+    QVERIFY(counters.contains(QOpcUaClient::Service::Republish));
+
+    QList<QOpcUaReadItem> request;
+    for (int i = 0; i < 100; ++i)
+        request.push_back(QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")));
+
+    QSignalSpy readSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+    for (int i = 0; i < 10; ++i)
+        QVERIFY(opcuaClient->readNodeAttributes(request));
+
+    QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 10, signalSpyTimeout);
+    for (const auto &args : readSpy) {
+        QCOMPARE(args.at(0).value<QList<QOpcUaReadResult>>().size(), request.size());
+        QCOMPARE(args.at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    }
+
+    counters = opcuaClient->inFlightRequests();
+    for (auto it = counters.constBegin(); it != counters.constEnd(); ++it)
+        QCOMPARE(it.value(), 0u);
+}
+
 void Tst_QOpcUaClient::readDataTypeDefinition()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -2627,6 +2915,78 @@ void Tst_QOpcUaClient::dataChangeSubscriptionSharing()
     QCOMPARE(attrs.size(), 0);
 }
 
+void Tst_QOpcUaClient::dataChangeSubscriptionBatched()
+{
+    // Monitored items for many nodes requested at once are created in batches on the same subscription
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QStringList nodeIds = {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Boolean"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Byte"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Float"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.String"),
+        QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::RootFolder) // Has no value attribute
+    };
+
+    std::vector<std::unique_ptr<QOpcUaNode>> nodes;
+    std::vector<std::unique_ptr<QSignalSpy>> enabledSpies;
+    for (const auto &nodeId : nodeIds) {
+        nodes.emplace_back(opcuaClient->node(nodeId));
+        QVERIFY(nodes.back() != nullptr);
+        enabledSpies.emplace_back(new QSignalSpy(nodes.back().get(), &QOpcUaNode::enableMonitoringFinished));
+    }
+
+    for (const auto &node : nodes)
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+
+    for (const auto &spy : enabledSpies) {
+        if (spy->isEmpty())
+            spy->wait(signalSpyTimeout);
+        QCOMPARE(spy->size(), 1);
+    }
+
+    const quint32 subscriptionId = nodes.front()->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId();
+    QVERIFY(subscriptionId != 0);
+
+    for (size_t i = 0; i < nodes.size() - 1; ++i) {
+        const auto status = nodes.at(i)->monitoringStatus(QOpcUa::NodeAttribute::Value);
+        QCOMPARE(status.statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(status.subscriptionId(), subscriptionId);
+        QVERIFY(status.monitoredItemId() != 0);
+    }
+    QCOMPARE(nodes.back()->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(),
+             QOpcUa::UaStatusCode::BadAttributeIdInvalid);
+
+    std::vector<std::unique_ptr<QSignalSpy>> disabledSpies;
+    for (size_t i = 0; i < nodes.size() - 1; ++i) {
+        disabledSpies.emplace_back(new QSignalSpy(nodes.at(i).get(), &QOpcUaNode::disableMonitoringFinished));
+        nodes.at(i)->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    }
+
+    for (const auto &spy : disabledSpies) {
+        if (spy->isEmpty())
+            spy->wait(signalSpyTimeout);
+        QCOMPARE(spy->size(), 1);
+        QCOMPARE(spy->at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    }
+
+    // Disable before the server has confirmed the creation of the monitored item
+    QSignalSpy enabledSpy(nodes.front().get(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy disabledSpy(nodes.front().get(), &QOpcUaNode::disableMonitoringFinished);
+    nodes.front()->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    nodes.front()->disableMonitoring(QOpcUa::NodeAttribute::Value);
+
+    disabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(enabledSpy.size(), 1);
+    QCOMPARE(disabledSpy.size(), 1);
+    QCOMPARE(disabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(nodes.front()->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(),
+             QOpcUa::UaStatusCode::BadNoEntryExists);
+}
+
 void Tst_QOpcUaClient::dataChangeSubscriptionTriggering()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -2966,6 +3326,614 @@ void Tst_QOpcUaClient::multipleClients()
     QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 42.0);
 }
 
+void Tst_QOpcUaClient::eventDrivenClientIterate()
+{
+    FETCH_OPEN62541_CLIENT("The eventDrivenClientIterate option is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("eventDrivenClientIterate"), true}});
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, 23.0, QOpcUa::Types::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 23.0);
+
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    if (dataChangeSpy.isEmpty())
+        dataChangeSpy.wait(signalSpyTimeout); // Initial value
+    QVERIFY(dataChangeSpy.size() >= 1);
+    dataChangeSpy.clear();
+
+    WRITE_VALUE_ATTRIBUTE(node, 42.0, QOpcUa::Types::Double);
+    if (dataChangeSpy.isEmpty())
+        dataChangeSpy.wait(signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 42.0);
+}
+
+void Tst_QOpcUaClient::sharedThreadPool()
+{
+    FETCH_OPEN62541_CLIENT("The sharedThreadPoolSize option is only supported by the open62541 backend");
+
+    const QVariantMap backendProperties {{QStringLiteral("sharedThreadPoolSize"), 2}};
+
+    // More clients than threads
+    std::vector<std::unique_ptr<QOpcUaClient>> clients;
+    std::vector<std::unique_ptr<OpcuaConnector>> connectors;
+    for (int i = 0; i < 3; ++i) {
+        clients.emplace_back(m_opcUa.createClient(opcuaClient->backend(), backendProperties));
+        QVERIFY(clients.back() != nullptr);
+        connectors.push_back(std::make_unique<OpcuaConnector>(clients.back().get(), m_endpoint));
+    }
+
+    for (const auto &client : clients) {
+        QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+        QVERIFY(node != nullptr);
+        WRITE_VALUE_ATTRIBUTE(node, 23.0, QOpcUa::Types::Double);
+        READ_MANDATORY_VARIABLE_NODE(node);
+        QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 23.0);
+    }
+
+    // The remaining clients must not be affected by the deletion of a client on their thread
+    connectors.erase(connectors.begin());
+    clients.erase(clients.begin());
+
+    for (const auto &client : clients) {
+        QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+        QVERIFY(node != nullptr);
+        READ_MANDATORY_VARIABLE_NODE(node);
+        QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 23.0);
+    }
+}
+
+void Tst_QOpcUaClient::notificationRing()
+{
+    FETCH_OPEN62541_CLIENT("The notificationRingCapacity option is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("notificationRingCapacity"), 16},
+                                     {QStringLiteral("notificationRingOverflowPolicy"),
+                                      QStringLiteral("Conflate")}});
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, 23.0, QOpcUa::Types::Double);
+
+    QSignalSpy notificationSpy(client.data(), &QOpcUaClient::notificationsAvailable);
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+
+    QList<double> values;
+    const auto handler = [&](QOpcUaNode *n, const QOpcUaScalarDataChange &change, const QVariant &value) {
+        QCOMPARE(n, node.data());
+        QCOMPARE(change.attribute(), QOpcUa::NodeAttribute::Value);
+        QCOMPARE(change.statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(change.valueType(), QOpcUa::Types::Double);
+        QVERIFY(!value.isValid());
+        values.push_back(change.toDouble());
+    };
+
+    QTRY_VERIFY_WITH_TIMEOUT(notificationSpy.size() == 1, signalSpyTimeout); // Initial value
+    QCOMPARE(client->drainNotifications(handler), 1);
+    QCOMPARE(values, QList<double>({23.0}));
+
+    WRITE_VALUE_ATTRIBUTE(node, 42.0, QOpcUa::Types::Double);
+    QTRY_VERIFY_WITH_TIMEOUT(notificationSpy.size() == 2, signalSpyTimeout);
+    QCOMPARE(client->drainNotifications(handler), 1);
+    QCOMPARE(values, QList<double>({23.0, 42.0}));
+
+    // Data changes are only delivered by the ring
+    QCOMPARE(dataChangeSpy.size(), 0);
+    QCOMPARE(client->droppedNotifications(), quint64(0));
+    QCOMPARE(client->conflatedNotifications(), quint64(0));
+}
+
+void Tst_QOpcUaClient::valueTable()
+{
+    FETCH_OPEN62541_CLIENT("The valueTableSize option is only supported by the open62541 backend");
+
+    QVERIFY(opcuaClient->valueTable() == nullptr);
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("valueTableSize"), 8}});
+
+    const QOpcUaValueTable *table = client->valueTable();
+    QVERIFY(table != nullptr);
+    QCOMPARE(table->size(), 8);
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, 23.0, QOpcUa::Types::Double);
+
+    QVERIFY(!node->setValueTableSlot(QOpcUa::NodeAttribute::Value, 8));
+    QVERIFY(node->setValueTableSlot(QOpcUa::NodeAttribute::Value, 3));
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+
+    QOpcUaScalarDataChange value;
+    quint64 version = 0;
+    QTRY_VERIFY_WITH_TIMEOUT(table->read(3, &value, &version), signalSpyTimeout); // Initial value
+    QCOMPARE(value.attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(value.statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(value.valueType(), QOpcUa::Types::Double);
+    QCOMPARE(value.toDouble(), 23.0);
+    QCOMPARE(table->version(3), version);
+    QVERIFY(!table->read(2, &value));
+
+    WRITE_VALUE_ATTRIBUTE(node, 42.0, QOpcUa::Types::Double);
+    QTRY_VERIFY_WITH_TIMEOUT(table->version(3) > version, signalSpyTimeout);
+    QVERIFY(table->read(3, &value));
+    QCOMPARE(value.toDouble(), 42.0);
+
+    // The normal delivery is not affected
+    QTRY_COMPARE_WITH_TIMEOUT(dataChangeSpy.size(), 2, signalSpyTimeout);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 42.0);
+
+    QList<QOpcUaScalarDataChange> values(4);
+    QCOMPARE(table->read(6, QSpan(values)), 2);
+    QCOMPARE(table->read(0, QSpan(values)), 4);
+    QCOMPARE(values.at(3).toDouble(), 42.0);
+    QCOMPARE(values.at(0).valueType(), QOpcUa::Types::Undefined);
+}
+
+void Tst_QOpcUaClient::trendBuffer()
+{
+    FETCH_OPEN62541_CLIENT("Trend buffers are only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("trendBufferMemoryBudget"),
+                                      QOpcUaTrendBuffer::memoryUsage(3)}});
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, 1.0, QOpcUa::Types::Double);
+
+    QVERIFY(!node->trendBuffer(QOpcUa::NodeAttribute::Value));
+    QVERIFY(!node->setTrendBufferDepth(QOpcUa::NodeAttribute::Value, 4)); // Exceeds the budget
+    // Rejected before the samples are allocated
+    QVERIFY(!node->setTrendBufferDepth(QOpcUa::NodeAttribute::Value, (std::numeric_limits<qsizetype>::max)()));
+    QVERIFY(node->setTrendBufferDepth(QOpcUa::NodeAttribute::Value, 3));
+
+    const auto buffer = node->trendBuffer(QOpcUa::NodeAttribute::Value);
+    QVERIFY(buffer);
+    QCOMPARE(buffer->depth(), 3);
+
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QTRY_COMPARE_WITH_TIMEOUT(buffer->totalCount(), quint64(1), signalSpyTimeout); // Initial value
+
+    for (double value : {2.0, 6.0, 4.0}) {
+        WRITE_VALUE_ATTRIBUTE(node, value, QOpcUa::Types::Double);
+        QTRY_COMPARE_WITH_TIMEOUT(buffer->last(1).value(0).value, value, signalSpyTimeout);
+    }
+
+    QCOMPARE(buffer->totalCount(), quint64(4));
+    QCOMPARE(buffer->size(), 3);
+
+    const auto samples = buffer->last(10);
+    QCOMPARE(samples.size(), 3);
+    QCOMPARE(samples.at(0).value, 2.0);
+    QCOMPARE(samples.at(2).value, 4.0);
+    QCOMPARE(samples.at(2).statusCode, QOpcUa::UaStatusCode::Good);
+    QVERIFY(samples.at(0).timestamp <= samples.at(2).timestamp);
+
+    auto statistics = buffer->statistics();
+    QCOMPARE(statistics.count, 3);
+    QCOMPARE(statistics.minimum, 2.0);
+    QCOMPARE(statistics.maximum, 6.0);
+    QCOMPARE(statistics.average, 4.0);
+
+    QCOMPARE(buffer->since(samples.at(1).timestamp).size(), 2);
+    statistics = buffer->statistics(samples.at(1).timestamp);
+    QCOMPARE(statistics.count, 2);
+    QCOMPARE(statistics.minimum, 4.0);
+    QCOMPARE(statistics.maximum, 6.0);
+
+    // Removing the buffer releases the budget
+    QVERIFY(node->setTrendBufferDepth(QOpcUa::NodeAttribute::Value, 0));
+    QVERIFY(!node->trendBuffer(QOpcUa::NodeAttribute::Value));
+    QVERIFY(node->setTrendBufferDepth(QOpcUa::NodeAttribute::Value, 2));
+}
+
+void Tst_QOpcUaClient::subscriptionRecorder()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const auto fileName = dir.filePath(QStringLiteral("recording.qopcuarec"));
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, 23.0, QOpcUa::Types::Double);
+
+    QOpcUaSubscriptionRecorder recorder(opcuaClient);
+    QVERIFY(recorder.open(fileName));
+    QVERIFY(recorder.isOpen());
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QTRY_COMPARE_WITH_TIMEOUT(dataChangeSpy.size(), 1, signalSpyTimeout); // Initial value
+
+    WRITE_VALUE_ATTRIBUTE(node, 42.0, QOpcUa::Types::Double);
+    QTRY_COMPARE_WITH_TIMEOUT(dataChangeSpy.size(), 2, signalSpyTimeout);
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+
+    recorder.close();
+    QVERIFY(!recorder.isOpen());
+    QCOMPARE(recorder.recordCount(), quint64(2));
+
+    QOpcUaRecordingPlayer player;
+    QVERIFY(player.open(fileName));
+    QCOMPARE(player.recordCount(), quint64(2));
+    QVERIFY(player.startTime().isValid());
+
+    // The recorded values are delivered to all nodes with the recorded node id
+    QScopedPointer<QOpcUaNode> replayNode(opcuaClient->node(readWriteNode));
+    QVERIFY(replayNode != nullptr);
+    QSignalSpy replaySpy(replayNode.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy finishedSpy(&player, &QOpcUaRecordingPlayer::finished);
+
+    player.setSpeed(0);
+    QVERIFY(player.start(opcuaClient));
+    finishedSpy.wait(signalSpyTimeout);
+    QCOMPARE(finishedSpy.size(), 1);
+    QVERIFY(!player.isPlaying());
+    QCOMPARE(player.replayedRecordCount(), quint64(2));
+
+    QCOMPARE(replaySpy.size(), 2);
+    QCOMPARE(replaySpy.at(0).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(replaySpy.at(0).at(1).toDouble(), 23.0);
+    QCOMPARE(replaySpy.at(1).at(1).toDouble(), 42.0);
+    QCOMPARE(replayNode->valueAttribute().toDouble(), 42.0);
+
+    // Records before the start position are skipped
+    replaySpy.clear();
+    QVERIFY(player.start(opcuaClient, player.duration() + 1));
+    finishedSpy.wait(signalSpyTimeout);
+    QCOMPARE(finishedSpy.size(), 2);
+    QCOMPARE(replaySpy.size(), 0);
+}
+
+void Tst_QOpcUaClient::tagHandles()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    RecordingTagSink sink;
+    opcuaClient->setTagSink(&sink);
+    const auto sinkGuard = qScopeGuard([opcuaClient] { opcuaClient->setTagSink(nullptr); });
+    QCOMPARE(opcuaClient->tagSink(), &sink);
+
+    const auto tags = opcuaClient->createTags({readWriteNode, QStringLiteral("ns=3;x=Invalid")});
+    QCOMPARE(tags.size(), 2);
+    QVERIFY(tags.at(0).isValid());
+    QVERIFY(!tags.at(1).isValid());
+    QCOMPARE(opcuaClient->tagCount(), 1);
+
+    const auto tag = tags.at(0);
+    QCOMPARE(opcuaClient->tagNodeId(tag), readWriteNode);
+    QVERIFY(!opcuaClient->readTags({tag, tags.at(1)}));
+
+    QVERIFY(opcuaClient->writeTag(tag, 23.0, QOpcUa::Types::Double));
+    QTRY_COMPARE_WITH_TIMEOUT(sink.writeResults.size(), 1, signalSpyTimeout);
+    QCOMPARE(sink.writeResults.at(0), QOpcUa::UaStatusCode::Good);
+
+    QVERIFY(opcuaClient->readTags({tag}, QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName));
+    QTRY_COMPARE_WITH_TIMEOUT(sink.readTags.size(), 1, signalSpyTimeout);
+    QCOMPARE(sink.readTags.at(0), tag);
+    QCOMPARE(sink.readResults.size(), 2);
+    QCOMPARE(sink.readResults.at(0).attribute(), QOpcUa::NodeAttribute::DisplayName);
+    QCOMPARE(sink.readResults.at(1).attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(sink.readResults.at(1).value().toDouble(), 23.0);
+
+    QVERIFY(opcuaClient->enableTagMonitoring({tag}, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+    QTRY_COMPARE_WITH_TIMEOUT(sink.monitoringResults.size(), 1, signalSpyTimeout);
+    QCOMPARE(sink.monitoringResults.at(0), QOpcUa::UaStatusCode::Good);
+    QTRY_COMPARE_WITH_TIMEOUT(sink.dataChanges.size(), 1, signalSpyTimeout); // Initial value
+    QCOMPARE(sink.dataChangeTags.at(0), tag);
+    QCOMPARE(sink.dataChanges.at(0).value().toDouble(), 23.0);
+
+    QVERIFY(opcuaClient->writeTag(tag, 42.0, QOpcUa::Types::Double));
+    QTRY_COMPARE_WITH_TIMEOUT(sink.dataChanges.size(), 2, signalSpyTimeout);
+    QCOMPARE(sink.dataChanges.at(1).value().toDouble(), 42.0);
+
+    // Released handles are not accepted and not reused
+    opcuaClient->releaseTags({tag});
+    QCOMPARE(opcuaClient->tagCount(), 0);
+    QVERIFY(opcuaClient->tagNodeId(tag).isEmpty());
+    QVERIFY(!opcuaClient->writeTag(tag, 1.0, QOpcUa::Types::Double));
+
+    const auto newTags = opcuaClient->createTags({readWriteNode});
+    QVERIFY(newTags.at(0).isValid());
+    QVERIFY(newTags.at(0) != tag);
+    opcuaClient->releaseTags(newTags);
+}
+
+void Tst_QOpcUaClient::batchedDataChanges()
+{
+    FETCH_OPEN62541_CLIENT("The batchDataChanges option is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("batchDataChanges"), true}});
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, 23.0, QOpcUa::Types::Double);
+
+    QSignalSpy batchSpy(client.get(), &QOpcUaClient::dataChangesReceived);
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    if (batchSpy.isEmpty())
+        batchSpy.wait(signalSpyTimeout); // Initial value
+    QCOMPARE(batchSpy.size(), 1);
+    auto batch = batchSpy.at(0).at(0).value<QList<QOpcUaReadResult>>();
+    QCOMPARE(batch.size(), 1);
+    QCOMPARE(batch.at(0).nodeId(), readWriteNode);
+    QCOMPARE(batch.at(0).attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(batch.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(batch.at(0).value().toDouble(), 23.0);
+    batchSpy.clear();
+
+    WRITE_VALUE_ATTRIBUTE(node, 42.0, QOpcUa::Types::Double);
+    if (batchSpy.isEmpty())
+        batchSpy.wait(signalSpyTimeout);
+    QCOMPARE(batchSpy.size(), 1);
+    batch = batchSpy.at(0).at(0).value<QList<QOpcUaReadResult>>();
+    QCOMPARE(batch.size(), 1);
+    QCOMPARE(batch.at(0).nodeId(), readWriteNode);
+    QCOMPARE(batch.at(0).value().toDouble(), 42.0);
+
+    // The nodes are bypassed in batch mode
+    QCOMPARE(dataChangeSpy.size(), 0);
+}
+
+void Tst_QOpcUaClient::typedDataChanges()
+{
+    FETCH_OPEN62541_CLIENT("The typedDataChanges option is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("typedDataChanges"), true}});
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, 23.0, QOpcUa::Types::Double);
+
+    QSignalSpy scalarSpy(node.data(), &QOpcUaNode::scalarDataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    if (scalarSpy.isEmpty())
+        scalarSpy.wait(signalSpyTimeout); // Initial value
+    QCOMPARE(scalarSpy.size(), 1);
+    auto change = scalarSpy.at(0).at(0).value<QOpcUaScalarDataChange>();
+    QCOMPARE(change.attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(change.statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(change.valueType(), QOpcUa::Types::Double);
+    QCOMPARE(change.toDouble(), 23.0);
+    QVERIFY(change.serverTimestamp() != 0);
+
+    // The attribute cache is populated on demand
+    QCOMPARE(node->valueAttribute().metaType(), QMetaType::fromType<double>());
+    QCOMPARE(node->valueAttribute().toDouble(), 23.0);
+    QCOMPARE(node->valueAttributeError(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(node->serverTimestamp(QOpcUa::NodeAttribute::Value),
+             QOpcUaScalarDataChange::toDateTime(change.serverTimestamp()));
+    QCOMPARE(change.toReadResult().value(), node->valueAttribute());
+    scalarSpy.clear();
+
+    // The QVariant based signals are still emitted for connected consumers
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    WRITE_VALUE_ATTRIBUTE(node, 42.0, QOpcUa::Types::Double);
+    if (scalarSpy.isEmpty())
+        scalarSpy.wait(signalSpyTimeout);
+    QCOMPARE(scalarSpy.size(), 1);
+    change = scalarSpy.at(0).at(0).value<QOpcUaScalarDataChange>();
+    QCOMPARE(change.toDouble(), 42.0);
+    QCOMPARE(dataChangeSpy.size(), 1);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 42.0);
+}
+
+void Tst_QOpcUaClient::requestWindow()
+{
+    FETCH_OPEN62541_CLIENT("The maxInFlightRequests option is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("maxInFlightRequests"), 1}});
+
+    QCOMPARE(client->queuedRequests(), 0);
+
+    const QList<QOpcUaReadItem> readRequest { QOpcUaReadItem(readWriteNode) };
+    const QList<QOpcUaWriteItem> writeRequest { QOpcUaWriteItem(readWriteNode, QOpcUa::NodeAttribute::Value,
+                                                                42.0, QOpcUa::Types::Double) };
+
+    constexpr int readCount = 10;
+    int readsBeforeWrite = -1;
+
+    QSignalSpy queueSpy(client.get(), &QOpcUaClient::requestQueueChanged);
+    QSignalSpy readSpy(client.get(), &QOpcUaClient::readNodeAttributesFinished);
+    QSignalSpy writeSpy(client.get(), &QOpcUaClient::writeNodeAttributesFinished);
+    QObject::connect(client.get(), &QOpcUaClient::writeNodeAttributesFinished, this, [&]() {
+        readsBeforeWrite = readSpy.size();
+    });
+
+    for (int i = 0; i < readCount; ++i)
+        QVERIFY(client->readNodeAttributes(readRequest));
+    QVERIFY(client->writeNodeAttributes(writeRequest));
+
+    QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), readCount, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(writeSpy.size(), 1, signalSpyTimeout);
+
+    // The write has a higher priority than the queued reads
+    QVERIFY(readsBeforeWrite >= 0);
+    QVERIFY(readsBeforeWrite < readCount);
+
+    for (const auto &args : readSpy)
+        QCOMPARE(args.at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    QVERIFY(!queueSpy.isEmpty());
+    bool queued = false;
+    for (const auto &args : queueSpy)
+        queued |= args.at(0).toInt() > 0 && args.at(1).toBool();
+    QVERIFY(queued);
+
+    QTRY_COMPARE_WITH_TIMEOUT(client->queuedRequests(), 0, signalSpyTimeout);
+    QTRY_VERIFY_WITH_TIMEOUT(!client->isRequestWindowSaturated(), signalSpyTimeout);
+}
+
+void Tst_QOpcUaClient::chunkedRequests()
+{
+    FETCH_OPEN62541_CLIENT("Splitting requests is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("maxNodesPerRead"), 2},
+                                     {QStringLiteral("maxNodesPerWrite"), 2},
+                                     {QStringLiteral("maxNodesPerRegisterNodes"), 2},
+                                     {QStringLiteral("maxConcurrentChunks"), 2}});
+
+    const QString doubleNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+    const QOpcUaNodeId stateNode(0, quint32(QOpcUa::NodeIds::Namespace0::Server_ServerStatus_State));
+
+    // 7 items are read with 4 requests, the results are reassembled in the order of the request
+    QList<QOpcUaReadItem> readRequest;
+    for (int i = 0; i < 7; ++i) {
+        switch (i % 3) {
+        case 0:
+            readRequest.push_back(QOpcUaReadItem(doubleNode));
+            break;
+        case 1:
+            readRequest.push_back(QOpcUaReadItem(stateNode));
+            break;
+        default:
+            readRequest.push_back(QOpcUaReadItem(doubleNode, QOpcUa::NodeAttribute::DisplayName));
+            break;
+        }
+    }
+
+    QSignalSpy readSpy(client.get(), &QOpcUaClient::readNodeAttributesFinished);
+    QVERIFY(client->readNodeAttributes(readRequest));
+    QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    auto readResults = readSpy.at(0).at(0).value<QList<QOpcUaReadResult>>();
+    QCOMPARE(readResults.size(), readRequest.size());
+    for (qsizetype i = 0; i < readResults.size(); ++i) {
+        QCOMPARE(readResults.at(i).attribute(), readRequest.at(i).attribute());
+        QCOMPARE(readResults.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+        switch (i % 3) {
+        case 0:
+            QCOMPARE(readResults.at(i).value(), 23.0);
+            break;
+        case 1:
+            QCOMPARE(readResults.at(i).value().toInt(), 0); // ServerState::Running
+            break;
+        default:
+            QCOMPARE(readResults.at(i).value().value<QOpcUaLocalizedText>().text(), QStringLiteral("DoubleScalarTest"));
+            break;
+        }
+    }
+
+    // A node which doesn't exist only fails its own result
+    readRequest[3] = QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.DoesNotExist"));
+    readSpy.clear();
+    QVERIFY(client->readNodeAttributes(readRequest));
+    QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    readResults = readSpy.at(0).at(0).value<QList<QOpcUaReadResult>>();
+    QCOMPARE(readResults.size(), readRequest.size());
+    QCOMPARE(readResults.at(3).statusCode(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+    QCOMPARE(readResults.at(4).value().toInt(), 0);
+
+    QList<QOpcUaWriteItem> writeRequest;
+    for (int i = 0; i < 5; ++i)
+        writeRequest.push_back(QOpcUaWriteItem(readWriteNode, QOpcUa::NodeAttribute::Value, double(i), QOpcUa::Types::Double));
+
+    QSignalSpy writeSpy(client.get(), &QOpcUaClient::writeNodeAttributesFinished);
+    QVERIFY(client->writeNodeAttributes(writeRequest));
+    QTRY_COMPARE_WITH_TIMEOUT(writeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    const auto writeResults = writeSpy.at(0).at(0).value<QList<QOpcUaWriteResult>>();
+    QCOMPARE(writeResults.size(), writeRequest.size());
+    for (const auto &result : writeResults)
+        QCOMPARE(result.statusCode(), QOpcUa::UaStatusCode::Good);
+
+    const QStringList nodesToRegister(5, doubleNode);
+    QSignalSpy registerSpy(client.get(), &QOpcUaClient::registerNodesFinished);
+    QVERIFY(client->registerNodes(nodesToRegister));
+    QTRY_COMPARE_WITH_TIMEOUT(registerSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(registerSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    const auto registeredNodes = registerSpy.at(0).at(1).toStringList();
+    QCOMPARE(registeredNodes.size(), nodesToRegister.size());
+
+    QSignalSpy unregisterSpy(client.get(), &QOpcUaClient::unregisterNodesFinished);
+    QVERIFY(client->unregisterNodes(registeredNodes));
+    QTRY_COMPARE_WITH_TIMEOUT(unregisterSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(unregisterSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    // Read groups are split in the same way
+    QScopedPointer<QOpcUaReadGroup> group(client->createReadGroup(readRequest));
+    QVERIFY(group != nullptr);
+    QSignalSpy groupSpy(group.get(), &QOpcUaReadGroup::readFinished);
+    QVERIFY(group->read());
+    QTRY_COMPARE_WITH_TIMEOUT(groupSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(groupSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    const auto groupResults = group->results();
+    QCOMPARE(groupResults.size(), readRequest.size());
+    for (qsizetype i = 0; i < groupResults.size(); ++i)
+        QCOMPARE(groupResults.at(i).statusCode(), readResults.at(i).statusCode());
+    QCOMPARE(groupResults.at(0).value(), 23.0);
+    QCOMPARE(groupResults.at(6).value(), 23.0);
+
+    // Tags are read with one request per chunk, each tag gets the results of its own attributes
+    RecordingTagSink sink;
+    client->setTagSink(&sink);
+    const auto sinkGuard = qScopeGuard([&client] { client->setTagSink(nullptr); });
+
+    const auto tags = client->createTags({doubleNode, stateNode.toString(), doubleNode, stateNode.toString(), doubleNode});
+    QVERIFY(client->readTags(tags, QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName));
+    QTRY_COMPARE_WITH_TIMEOUT(sink.readTags.size(), tags.size(), signalSpyTimeout);
+    QCOMPARE(sink.readResults.size(), 2 * tags.size());
+
+    for (qsizetype i = 0; i < sink.readTags.size(); ++i) {
+        const auto index = tags.indexOf(sink.readTags.at(i));
+        QVERIFY(index >= 0);
+        QCOMPARE(sink.readResults.at(2 * i).attribute(), QOpcUa::NodeAttribute::DisplayName);
+        QCOMPARE(sink.readResults.at(2 * i + 1).attribute(), QOpcUa::NodeAttribute::Value);
+        QCOMPARE(sink.readResults.at(2 * i + 1).statusCode(), QOpcUa::UaStatusCode::Good);
+        if (index % 2)
+            QCOMPARE(sink.readResults.at(2 * i + 1).value().toInt(), 0); // ServerState::Running
+        else
+            QCOMPARE(sink.readResults.at(2 * i + 1).value(), 23.0);
+    }
+
+    client->releaseTags(tags);
+}
+
 void Tst_QOpcUaClient::nodeClass()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -4547,6 +5515,296 @@ void Tst_QOpcUaClient::addDuplicateMonitoredItem()
     QCOMPARE(monitoringDisabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
 }
 
+void Tst_QOpcUaClient::sharedMonitoredItems()
+{
+    FETCH_OPEN62541_CLIENT("The shareMonitoredItems option is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("shareMonitoredItems"), true}});
+
+    QScopedPointer<QOpcUaNode> firstNode(client->node(readWriteNode));
+    QScopedPointer<QOpcUaNode> secondNode(client->node(readWriteNode));
+    QScopedPointer<QOpcUaNode> lateNode(client->node(readWriteNode));
+    QVERIFY(firstNode != nullptr);
+    QVERIFY(secondNode != nullptr);
+    QVERIFY(lateNode != nullptr);
+    WRITE_VALUE_ATTRIBUTE(firstNode, 23.0, QOpcUa::Types::Double);
+
+    QSignalSpy firstEnabledSpy(firstNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy secondEnabledSpy(secondNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy lateEnabledSpy(lateNode.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy firstDataChangeSpy(firstNode.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy secondDataChangeSpy(secondNode.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy lateDataChangeSpy(lateNode.data(), &QOpcUaNode::dataChangeOccurred);
+
+    // Both nodes join the item before it has been confirmed by the server
+    firstNode->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    secondNode->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    QTRY_COMPARE_WITH_TIMEOUT(firstEnabledSpy.size(), 1, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(secondEnabledSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(firstNode->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(secondNode->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    const quint32 monitoredItemId = firstNode->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoredItemId();
+    QCOMPARE(secondNode->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoredItemId(), monitoredItemId);
+
+    QTRY_COMPARE_WITH_TIMEOUT(firstDataChangeSpy.size(), 1, signalSpyTimeout); // Initial value
+    QTRY_COMPARE_WITH_TIMEOUT(secondDataChangeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(firstDataChangeSpy.at(0).at(1).toDouble(), 23.0);
+    QCOMPARE(secondDataChangeSpy.at(0).at(1).toDouble(), 23.0);
+
+    // A node joining a confirmed item receives the latest value
+    lateNode->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    QTRY_COMPARE_WITH_TIMEOUT(lateEnabledSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(lateNode->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(lateNode->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoredItemId(), monitoredItemId);
+    QTRY_COMPARE_WITH_TIMEOUT(lateDataChangeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(lateDataChangeSpy.at(0).at(1).toDouble(), 23.0);
+
+    firstDataChangeSpy.clear();
+    secondDataChangeSpy.clear();
+    lateDataChangeSpy.clear();
+
+    WRITE_VALUE_ATTRIBUTE(firstNode, 42.0, QOpcUa::Types::Double);
+    QTRY_COMPARE_WITH_TIMEOUT(firstDataChangeSpy.size(), 1, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(secondDataChangeSpy.size(), 1, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(lateDataChangeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(firstDataChangeSpy.at(0).at(1).toDouble(), 42.0);
+    QCOMPARE(secondDataChangeSpy.at(0).at(1).toDouble(), 42.0);
+    QCOMPARE(lateDataChangeSpy.at(0).at(1).toDouble(), 42.0);
+
+    // The parameters of an item with several consumers can't be modified
+    QSignalSpy modifySpy(secondNode.data(), &QOpcUaNode::monitoringStatusChanged);
+    secondNode->modifyMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters::Parameter::SamplingInterval, 200.0);
+    QTRY_COMPARE_WITH_TIMEOUT(modifySpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(modifySpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNotSupported);
+
+    // The item stays on the server for the remaining consumers
+    QSignalSpy firstDisabledSpy(firstNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    firstNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    QTRY_COMPARE_WITH_TIMEOUT(firstDisabledSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(firstDisabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    firstDataChangeSpy.clear();
+    secondDataChangeSpy.clear();
+    lateDataChangeSpy.clear();
+
+    WRITE_VALUE_ATTRIBUTE(secondNode, 43.0, QOpcUa::Types::Double);
+    QTRY_COMPARE_WITH_TIMEOUT(secondDataChangeSpy.size(), 1, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(lateDataChangeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(secondDataChangeSpy.at(0).at(1).toDouble(), 43.0);
+    QCOMPARE(firstDataChangeSpy.size(), 0);
+
+    QSignalSpy secondDisabledSpy(secondNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    QSignalSpy lateDisabledSpy(lateNode.data(), &QOpcUaNode::disableMonitoringFinished);
+    secondNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    lateNode->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    QTRY_COMPARE_WITH_TIMEOUT(secondDisabledSpy.size(), 1, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(lateDisabledSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(secondDisabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(lateDisabledSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+}
+
+void Tst_QOpcUaClient::modifyMultipleMonitoredItems()
+{
+    FETCH_OPEN62541_CLIENT("Modifying multiple monitored items is only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QStringList nodeIds {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Float")
+    };
+
+    std::vector<std::unique_ptr<QOpcUaNode>> nodeObjects;
+    QList<QOpcUaNode *> nodes;
+    for (const auto &nodeId : nodeIds) {
+        nodeObjects.emplace_back(opcuaClient->node(nodeId));
+        QVERIFY(nodeObjects.back() != nullptr);
+        nodes.push_back(nodeObjects.back().get());
+    }
+
+    for (const auto node : std::as_const(nodes)) {
+        QSignalSpy monitoringEnabledSpy(node, &QOpcUaNode::enableMonitoringFinished);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+        monitoringEnabledSpy.wait(signalSpyTimeout);
+        QCOMPARE(monitoringEnabledSpy.size(), 1);
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    }
+
+    // Only parameters of monitored items are supported
+    QVERIFY(!opcuaClient->modifyMonitoring(nodes, QOpcUa::NodeAttribute::Value,
+                                           QOpcUaMonitoringParameters::Parameter::PublishingInterval, 200.0));
+    QVERIFY(!opcuaClient->modifyMonitoring({nodes.at(0), nullptr}, QOpcUa::NodeAttribute::Value,
+                                           QOpcUaMonitoringParameters::Parameter::SamplingInterval, 200.0));
+
+    const auto verifyModification = [&](const std::function<bool()> &modify, QOpcUaMonitoringParameters::Parameter parameter) {
+        std::vector<std::unique_ptr<QSignalSpy>> spies;
+        for (const auto node : std::as_const(nodes))
+            spies.emplace_back(new QSignalSpy(node, &QOpcUaNode::monitoringStatusChanged));
+
+        QVERIFY(modify());
+
+        for (const auto &spy : spies) {
+            QTRY_COMPARE_WITH_TIMEOUT(spy->size(), 1, signalSpyTimeout);
+            QCOMPARE(spy->at(0).at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+            QVERIFY(spy->at(0).at(1).value<QOpcUaMonitoringParameters::Parameters>() & parameter);
+            QCOMPARE(spy->at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        }
+    };
+
+    verifyModification([&]() {
+        return opcuaClient->setMonitoringMode(nodes, QOpcUa::NodeAttribute::Value,
+                                              QOpcUaMonitoringParameters::MonitoringMode::Disabled);
+    }, QOpcUaMonitoringParameters::Parameter::MonitoringMode);
+
+    for (const auto node : std::as_const(nodes)) {
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).monitoringMode(),
+                 QOpcUaMonitoringParameters::MonitoringMode::Disabled);
+    }
+
+    // Disabled items don't report data changes
+    QScopedPointer<QOpcUaNode> writeNode(opcuaClient->node(nodeIds.at(0)));
+    QVERIFY(writeNode != nullptr);
+    QSignalSpy dataChangeSpy(nodes.at(0), &QOpcUaNode::dataChangeOccurred);
+    WRITE_VALUE_ATTRIBUTE(writeNode, 5.0, QOpcUa::Types::Double);
+    dataChangeSpy.wait(1000);
+    QCOMPARE(dataChangeSpy.size(), 0);
+
+    verifyModification([&]() {
+        return opcuaClient->modifyMonitoring(nodes, QOpcUa::NodeAttribute::Value,
+                                             QOpcUaMonitoringParameters::Parameter::SamplingInterval, 200.0);
+    }, QOpcUaMonitoringParameters::Parameter::SamplingInterval);
+
+    for (const auto node : std::as_const(nodes))
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).samplingInterval(), 200.0);
+
+    verifyModification([&]() {
+        return opcuaClient->setMonitoringMode(nodes, QOpcUa::NodeAttribute::Value,
+                                              QOpcUaMonitoringParameters::MonitoringMode::Reporting);
+    }, QOpcUaMonitoringParameters::Parameter::MonitoringMode);
+
+    // The current value is reported after switching back to reporting
+    if (dataChangeSpy.isEmpty())
+        dataChangeSpy.wait(signalSpyTimeout);
+    QVERIFY(dataChangeSpy.size() >= 1);
+
+    for (const auto node : std::as_const(nodes)) {
+        QSignalSpy monitoringDisabledSpy(node, &QOpcUaNode::disableMonitoringFinished);
+        node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+        monitoringDisabledSpy.wait(signalSpyTimeout);
+        QCOMPARE(monitoringDisabledSpy.size(), 1);
+    }
+}
+
+void Tst_QOpcUaClient::subscriptionPartitioning()
+{
+    FETCH_OPEN62541_CLIENT("Subscription partitioning is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("maxItemsPerSubscription"), 2},
+                                     {QStringLiteral("outstandingPublishRequests"), 4}});
+
+    const QStringList nodeIds {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Float"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Boolean"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.String")
+    };
+
+    std::vector<std::unique_ptr<QOpcUaNode>> nodes;
+    for (const auto &nodeId : nodeIds) {
+        nodes.emplace_back(client->node(nodeId));
+        QVERIFY(nodes.back() != nullptr);
+    }
+
+    QSet<quint32> subscriptionIds;
+    for (const auto &node : nodes) {
+        QSignalSpy monitoringEnabledSpy(node.get(), &QOpcUaNode::enableMonitoringFinished);
+        QSignalSpy dataChangeSpy(node.get(), &QOpcUaNode::dataChangeOccurred);
+        node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+        monitoringEnabledSpy.wait(signalSpyTimeout);
+        QCOMPARE(monitoringEnabledSpy.size(), 1);
+        QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+        QTRY_COMPARE_WITH_TIMEOUT(dataChangeSpy.size(), 1, signalSpyTimeout); // Initial value
+        subscriptionIds.insert(node->monitoringStatus(QOpcUa::NodeAttribute::Value).subscriptionId());
+    }
+
+    // Five items with at most two items per subscription
+    QCOMPARE(subscriptionIds.size(), 3);
+
+    QSignalSpy statisticsSpy(client.get(), &QOpcUaClient::subscriptionStatisticsReceived);
+    QVERIFY(client->requestSubscriptionStatistics());
+    QTRY_COMPARE_WITH_TIMEOUT(statisticsSpy.size(), 1, signalSpyTimeout);
+
+    const auto statistics = statisticsSpy.at(0).at(0).value<QList<QOpcUaSubscriptionStatistics>>();
+    QCOMPARE(statistics.size(), 3);
+
+    quint32 itemCount = 0;
+    for (const auto &entry : statistics) {
+        QVERIFY(subscriptionIds.contains(entry.subscriptionId()));
+        QVERIFY(entry.monitoredItemCount() <= 2);
+        QCOMPARE(entry.publishingInterval(), 100.0);
+        QCOMPARE(entry.expectedNotificationsPerPublish(), double(entry.monitoredItemCount()));
+        QCOMPARE(entry.dataChangeNotifications(), quint64(entry.monitoredItemCount()));
+        itemCount += entry.monitoredItemCount();
+    }
+    QCOMPARE(itemCount, quint32(nodeIds.size()));
+
+    for (const auto &node : nodes) {
+        QSignalSpy monitoringDisabledSpy(node.get(), &QOpcUaNode::disableMonitoringFinished);
+        node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+        monitoringDisabledSpy.wait(signalSpyTimeout);
+        QCOMPARE(monitoringDisabledSpy.size(), 1);
+    }
+
+    statisticsSpy.clear();
+    QVERIFY(client->requestSubscriptionStatistics());
+    QTRY_COMPARE_WITH_TIMEOUT(statisticsSpy.size(), 1, signalSpyTimeout);
+    QVERIFY(statisticsSpy.at(0).at(0).value<QList<QOpcUaSubscriptionStatistics>>().isEmpty());
+}
+
+void Tst_QOpcUaClient::recoverMissingNotifications()
+{
+    FETCH_OPEN62541_CLIENT("Notification recovery is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("recoverMissingNotifications"), true}});
+
+    QScopedPointer<QOpcUaNode> node(client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")));
+    QVERIFY(node != nullptr);
+
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QTRY_COMPARE_WITH_TIMEOUT(dataChangeSpy.size(), 1, signalSpyTimeout); // Initial value
+
+    // The notifications are delivered by the publish loop of the backend
+    QSignalSpy writeSpy(node.data(), &QOpcUaNode::attributeWritten);
+    node->writeValueAttribute(23.0, QOpcUa::Types::Double);
+    writeSpy.wait(signalSpyTimeout);
+    QCOMPARE(writeSpy.size(), 1);
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QTRY_COMPARE_WITH_TIMEOUT(node->valueAttribute(), QVariant(23.0), signalSpyTimeout);
+
+    QSignalSpy statisticsSpy(client.get(), &QOpcUaClient::subscriptionStatisticsReceived);
+    QVERIFY(client->requestSubscriptionStatistics());
+    QTRY_COMPARE_WITH_TIMEOUT(statisticsSpy.size(), 1, signalSpyTimeout);
+
+    const auto statistics = statisticsSpy.at(0).at(0).value<QList<QOpcUaSubscriptionStatistics>>();
+    QCOMPARE(statistics.size(), 1);
+    QCOMPARE(statistics.at(0).dataChangeNotifications(), quint64(dataChangeSpy.size()));
+    QCOMPARE(statistics.at(0).sequenceGaps(), quint64(0));
+    QCOMPARE(statistics.at(0).unrecoverableMessages(), quint64(0));
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
 void Tst_QOpcUaClient::subscriptionUnreadableNode()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -4862,6 +6120,51 @@ void Tst_QOpcUaClient::multiDimensionalArray()
     QCOMPARE(arr, readBack);
 }
 
+void Tst_QOpcUaClient::typedNumericArrays()
+{
+    FETCH_OPEN62541_CLIENT("The typedNumericArrays option is only supported by the open62541 backend");
+
+    CREATE_CONNECTED_CLIENT(client, {{QStringLiteral("typedNumericArrays"), true}});
+
+    QScopedPointer<QOpcUaNode> node(client->node("ns=2;s=Demo.Static.Arrays.Double"));
+    QVERIFY(node != nullptr);
+    READ_MANDATORY_VARIABLE_NODE(node);
+    const QVariant originalValue = node->valueAttribute();
+    QCOMPARE(originalValue.metaType(), QMetaType::fromType<QList<double>>());
+
+    const QList<double> doubleValues({1.5, -2.25, 1e100, 0.0});
+    WRITE_VALUE_ATTRIBUTE(node, QVariant::fromValue(doubleValues), QOpcUa::Types::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+    QCOMPARE(node->valueAttribute().value<QList<double>>(), doubleValues);
+
+    // The element type doesn't match, the values are converted one by one
+    WRITE_VALUE_ATTRIBUTE(node, QVariant::fromValue(QList<float>({3.0f, 4.0f})), QOpcUa::Types::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+    QCOMPARE(node->valueAttribute().value<QList<double>>(), QList<double>({3.0, 4.0}));
+
+    WRITE_VALUE_ATTRIBUTE(node, originalValue, QOpcUa::Types::Double);
+
+    node.reset(client->node("ns=2;s=Demo.Static.Arrays.MultiDimensionalDouble"));
+    QVERIFY(node != nullptr);
+
+    const QList<double> multiDimensionalValues({0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0});
+    QOpcUaMultiDimensionalArray arr({2, 2, 3});
+    QVERIFY(arr.setTypedValueArray(QVariant::fromValue(multiDimensionalValues)));
+    QVERIFY(arr.isValid());
+    QVERIFY(arr.hasTypedValueArray());
+    QCOMPARE(arr.value({1, 0, 2}), 8.0);
+    WRITE_VALUE_ATTRIBUTE(node, arr, QOpcUa::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    const auto readBack = node->valueAttribute().value<QOpcUaMultiDimensionalArray>();
+    QVERIFY(readBack.isValid());
+    QVERIFY(readBack.hasTypedValueArray());
+    QCOMPARE(readBack.arrayDimensions(), QList<quint32>({2, 2, 3}));
+    QCOMPARE(readBack.typedValueArray().value<QList<double>>(), multiDimensionalValues);
+    QCOMPARE(readBack.value({1, 1, 2}), 11.0);
+    QCOMPARE(readBack, arr);
+}
+
 void Tst_QOpcUaClient::dateTimeConversion()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -5229,6 +6532,26 @@ void Tst_QOpcUaClient::statusStrings()
 {
     QCOMPARE(statusToString(QOpcUa::Good), "Good");
     QCOMPARE(statusToString(QOpcUa::BadAggregateConfigurationRejected), "BadAggregateConfigurationRejected");
+    QCOMPARE(statusToString(static_cast<QOpcUa::UaStatusCode>(0x80FF0000)), "Invalid enum value for UaStatusCode");
+}
+
+void Tst_QOpcUaClient::namespace0IdNames()
+{
+    // Empty if Qt OPC UA has been configured with -no-feature-ns0idnames
+    if (QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::RootFolder).isEmpty())
+        QSKIP("Namespace 0 id names are not available");
+
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Server_ServerStatus_State), QStringLiteral("Server_ServerStatus_State"));
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0::Unknown), QString());
+    QCOMPARE(QOpcUa::namespace0IdName(QOpcUa::NodeIds::Namespace0(0xFFFFFFFF)), QString());
+
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("Server_ServerStatus_State")), QOpcUa::NodeIds::Namespace0::Server_ServerStatus_State);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("RootFolder")), QOpcUa::NodeIds::Namespace0::RootFolder);
+    QCOMPARE(QOpcUa::namespace0IdFromName(QStringLiteral("NoSuchNode")), QOpcUa::NodeIds::Namespace0::Unknown);
+
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=0;i=2259")), QOpcUa::NodeIds::Namespace0::Server_ServerStatus_State);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=0;i=4294967295")), QOpcUa::NodeIds::Namespace0::Unknown);
+    QCOMPARE(QOpcUa::namespace0IdFromNodeId(QStringLiteral("ns=1;i=2259")), QOpcUa::NodeIds::Namespace0::Unknown);
 }
 
 void Tst_QOpcUaClient::addNamespace()
@@ -15,6 +15,8 @@
 #include <QTcpSocket>
 #include <QTcpServer>
 
+#include "../shared/testserverbackends.h"
+
 const int signalSpyTimeout = 10000;
 
 class OpcuaConnector
@@ -137,7 +139,7 @@ private:
 
 Tst_QOpcUaSecurity::Tst_QOpcUaSecurity()
 {
-    m_backends = QOpcUaProvider::availableBackends();
+    m_backends = testServerBackends();
 }
 
 void Tst_QOpcUaSecurity::initTestCase()
@@ -0,0 +1,20 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#ifndef TESTSERVERBACKENDS_H
+#define TESTSERVERBACKENDS_H
+
+#include <QtOpcUa/QOpcUaProvider>
+
+#include <QtCore/QStringList>
+
+// Returns the backends which can run the tests against the test server.
+// The loopback backend serves its own address space and does not talk to the test server.
+inline QStringList testServerBackends()
+{
+    auto backends = QOpcUaProvider::availableBackends();
+    backends.removeAll(QStringLiteral("loopback"));
+    return backends;
+}
+
+#endif // TESTSERVERBACKENDS_H
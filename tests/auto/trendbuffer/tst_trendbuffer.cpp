@@ -0,0 +1,224 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtOpcUa/private/qopcuatrendbuffer_p.h>
+
+#include <QtCore/QList>
+#include <QtCore/QRandomGenerator>
+#include <QtCore/qnumeric.h>
+
+#include <QtTest/QtTest>
+
+#include <algorithm>
+#include <limits>
+
+using Sample = QOpcUaTrendBuffer::Sample;
+
+static Sample makeSample(qint64 timestamp, double value,
+                         QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good)
+{
+    Sample sample;
+    sample.timestamp = timestamp;
+    sample.value = value;
+    sample.statusCode = statusCode;
+    return sample;
+}
+
+static QList<double> values(const QList<Sample> &samples)
+{
+    QList<double> result;
+    for (const auto &sample : samples)
+        result.push_back(sample.value);
+    return result;
+}
+
+class Tst_TrendBuffer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void depthAndMemoryUsage();
+    void appendAndOverwrite();
+    void statistics();
+    void excludedSamples();
+    void since();
+    void clear();
+    void slidingWindowStatistics();
+};
+
+void Tst_TrendBuffer::depthAndMemoryUsage()
+{
+    QCOMPARE(QOpcUaTrendBufferPrivate::create(0)->depth(), qsizetype(1));
+    QCOMPARE(QOpcUaTrendBufferPrivate::create(5)->depth(), qsizetype(5));
+
+    QVERIFY(QOpcUaTrendBuffer::memoryUsage(0) > 0);
+    QCOMPARE(QOpcUaTrendBuffer::memoryUsage(0), QOpcUaTrendBuffer::memoryUsage(1));
+    QVERIFY(QOpcUaTrendBuffer::memoryUsage(100) > QOpcUaTrendBuffer::memoryUsage(10));
+
+    // Depths which can't be allocated don't overflow
+    constexpr qsizetype maximum = (std::numeric_limits<qsizetype>::max)();
+    QCOMPARE(QOpcUaTrendBuffer::memoryUsage(maximum), maximum);
+    QCOMPARE(QOpcUaTrendBuffer::memoryUsage(maximum / 2), maximum);
+}
+
+void Tst_TrendBuffer::appendAndOverwrite()
+{
+    const auto buffer = QOpcUaTrendBufferPrivate::create(3);
+    auto d = QOpcUaTrendBufferPrivate::get(buffer.data());
+
+    QCOMPARE(buffer->size(), qsizetype(0));
+    QVERIFY(buffer->last(2).isEmpty());
+
+    d->append(makeSample(1, 1.0));
+    d->append(makeSample(2, 2.0));
+    QCOMPARE(buffer->size(), qsizetype(2));
+    QCOMPARE(values(buffer->last(10)), QList<double>({1.0, 2.0}));
+
+    d->append(makeSample(3, 3.0));
+    d->append(makeSample(4, 4.0));
+    QCOMPARE(buffer->size(), qsizetype(3));
+    QCOMPARE(buffer->totalCount(), quint64(4));
+    QCOMPARE(values(buffer->last(3)), QList<double>({2.0, 3.0, 4.0}));
+    QCOMPARE(values(buffer->last(1)), QList<double>({4.0}));
+    QVERIFY(buffer->last(-1).isEmpty());
+}
+
+void Tst_TrendBuffer::statistics()
+{
+    const auto buffer = QOpcUaTrendBufferPrivate::create(3);
+    auto d = QOpcUaTrendBufferPrivate::get(buffer.data());
+
+    auto statistics = buffer->statistics();
+    QCOMPARE(statistics.count, qsizetype(0));
+    QCOMPARE(statistics.minimum, 0.0);
+    QCOMPARE(statistics.maximum, 0.0);
+    QCOMPARE(statistics.average, 0.0);
+
+    for (double value : {5.0, 1.0, 3.0})
+        d->append(makeSample(0, value));
+
+    statistics = buffer->statistics();
+    QCOMPARE(statistics.count, qsizetype(3));
+    QCOMPARE(statistics.minimum, 1.0);
+    QCOMPARE(statistics.maximum, 5.0);
+    QCOMPARE(statistics.average, 3.0);
+
+    // The maximum and then the minimum are overwritten
+    d->append(makeSample(0, 2.0));
+    statistics = buffer->statistics();
+    QCOMPARE(statistics.minimum, 1.0);
+    QCOMPARE(statistics.maximum, 3.0);
+    QCOMPARE(statistics.average, 2.0);
+
+    d->append(makeSample(0, 4.0));
+    statistics = buffer->statistics();
+    QCOMPARE(statistics.minimum, 2.0);
+    QCOMPARE(statistics.maximum, 4.0);
+    QCOMPARE(statistics.average, 3.0);
+}
+
+void Tst_TrendBuffer::excludedSamples()
+{
+    const auto buffer = QOpcUaTrendBufferPrivate::create(4);
+    auto d = QOpcUaTrendBufferPrivate::get(buffer.data());
+
+    d->append(makeSample(0, 1.0));
+    d->append(makeSample(0, 100.0, QOpcUa::UaStatusCode::BadNoCommunication));
+    d->append(makeSample(0, qQNaN()));
+    d->append(makeSample(0, 3.0, QOpcUa::UaStatusCode::UncertainLastUsableValue));
+
+    // Uncertain values are included, bad values and NaN are not
+    const auto statistics = buffer->statistics();
+    QCOMPARE(statistics.count, qsizetype(2));
+    QCOMPARE(statistics.minimum, 1.0);
+    QCOMPARE(statistics.maximum, 3.0);
+    QCOMPARE(statistics.average, 2.0);
+    QCOMPARE(buffer->size(), qsizetype(4));
+}
+
+void Tst_TrendBuffer::since()
+{
+    const auto buffer = QOpcUaTrendBufferPrivate::create(8);
+    auto d = QOpcUaTrendBufferPrivate::get(buffer.data());
+
+    for (qint64 i = 1; i <= 5; ++i)
+        d->append(makeSample(i * 10, double(i)));
+
+    QCOMPARE(values(buffer->since(30)), QList<double>({3.0, 4.0, 5.0}));
+    QCOMPARE(values(buffer->since(31)), QList<double>({4.0, 5.0}));
+    QCOMPARE(buffer->since(0).size(), qsizetype(5));
+    QVERIFY(buffer->since(51).isEmpty());
+
+    auto statistics = buffer->statistics(30);
+    QCOMPARE(statistics.count, qsizetype(3));
+    QCOMPARE(statistics.minimum, 3.0);
+    QCOMPARE(statistics.maximum, 5.0);
+    QCOMPARE(statistics.average, 4.0);
+
+    statistics = buffer->statistics(51);
+    QCOMPARE(statistics.count, qsizetype(0));
+
+    // The window starts after the newest sample which is older than the timestamp
+    d->append(makeSample(20, 6.0));
+    QVERIFY(buffer->since(25).isEmpty());
+    QCOMPARE(values(buffer->since(20)), QList<double>({2.0, 3.0, 4.0, 5.0, 6.0}));
+}
+
+void Tst_TrendBuffer::clear()
+{
+    const auto buffer = QOpcUaTrendBufferPrivate::create(2);
+    auto d = QOpcUaTrendBufferPrivate::get(buffer.data());
+
+    d->append(makeSample(1, 1.0));
+    d->append(makeSample(2, 2.0));
+    d->append(makeSample(3, 3.0));
+    d->clear();
+
+    QCOMPARE(buffer->size(), qsizetype(0));
+    QCOMPARE(buffer->totalCount(), quint64(0));
+    QCOMPARE(buffer->statistics().count, qsizetype(0));
+
+    d->append(makeSample(4, 4.0));
+    QCOMPARE(values(buffer->last(2)), QList<double>({4.0}));
+    QCOMPARE(buffer->statistics().minimum, 4.0);
+    QCOMPARE(buffer->statistics().maximum, 4.0);
+}
+
+void Tst_TrendBuffer::slidingWindowStatistics()
+{
+    // The incremental statistics must match the statistics calculated from the samples
+    constexpr qsizetype depth = 16;
+    const auto buffer = QOpcUaTrendBufferPrivate::create(depth);
+    auto d = QOpcUaTrendBufferPrivate::get(buffer.data());
+    QRandomGenerator random(42);
+
+    for (int i = 0; i < 1000; ++i) {
+        const bool bad = random.bounded(10) == 0;
+        d->append(makeSample(i, random.bounded(100) - 50.0,
+                             bad ? QOpcUa::UaStatusCode::BadOutOfRange : QOpcUa::UaStatusCode::Good));
+
+        double minimum = 0;
+        double maximum = 0;
+        double sum = 0;
+        qsizetype count = 0;
+        for (const auto &sample : buffer->last(depth)) {
+            if (sample.statusCode != QOpcUa::UaStatusCode::Good)
+                continue;
+            minimum = count ? std::min(minimum, sample.value) : sample.value;
+            maximum = count ? std::max(maximum, sample.value) : sample.value;
+            sum += sample.value;
+            ++count;
+        }
+
+        const auto statistics = buffer->statistics();
+        QCOMPARE(statistics.count, count);
+        QCOMPARE(statistics.minimum, minimum);
+        QCOMPARE(statistics.maximum, maximum);
+        if (count)
+            QVERIFY(qAbs(statistics.average - sum / count) < 1e-9);
+    }
+}
+
+QTEST_APPLESS_MAIN(Tst_TrendBuffer)
+
+#include "tst_trendbuffer.moc"
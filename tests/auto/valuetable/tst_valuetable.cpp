@@ -0,0 +1,222 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtOpcUa/private/qopcuavaluetable_p.h>
+
+#include <QtCore/QList>
+#include <QtCore/QThread>
+
+#include <QtTest/QtTest>
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+class Tst_ValueTable : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void emptyTable();
+    void writeAndRead();
+    void version();
+    void outOfRange();
+    void readRange();
+    void concurrentReaders();
+};
+
+void Tst_ValueTable::emptyTable()
+{
+    const auto table = QOpcUaValueTablePrivate::create(-1);
+    QCOMPARE(table->size(), qsizetype(0));
+
+    QOpcUaScalarDataChange value;
+    QVERIFY(!table->read(0, &value));
+    QCOMPARE(table->version(0), quint64(0));
+
+    const auto unwritten = QOpcUaValueTablePrivate::create(4);
+    QCOMPARE(unwritten->size(), qsizetype(4));
+    QVERIFY(!unwritten->read(0, &value));
+    QCOMPARE(unwritten->version(3), quint64(0));
+}
+
+void Tst_ValueTable::writeAndRead()
+{
+    const auto table = QOpcUaValueTablePrivate::create(6);
+    auto d = QOpcUaValueTablePrivate::get(table.get());
+
+    QOpcUaScalarDataChange value;
+    value.setAttribute(QOpcUa::NodeAttribute::Value);
+    value.setSourceTimestamp(1000);
+    value.setServerTimestamp(2000);
+
+    value.setFloatingPoint(-1.5, QOpcUa::Types::Double);
+    d->write(0, value);
+    value.setSignedInteger(-42, QOpcUa::Types::Int32);
+    d->write(1, value);
+    value.setBoolean(true);
+    d->write(2, value);
+    value.setUnsignedInteger(std::numeric_limits<quint64>::max(), QOpcUa::Types::UInt64);
+    d->write(3, value);
+    value.setDateTime(123456789);
+    d->write(4, value);
+    value.clearValue();
+    value.setStatusCode(QOpcUa::UaStatusCode::BadNoCommunication);
+    d->write(5, value);
+
+    QOpcUaScalarDataChange result;
+    QVERIFY(table->read(0, &result));
+    QCOMPARE(result.valueType(), QOpcUa::Types::Double);
+    QCOMPARE(result.toDouble(), -1.5);
+    QCOMPARE(result.attribute(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(result.sourceTimestamp(), qint64(1000));
+    QCOMPARE(result.serverTimestamp(), qint64(2000));
+    QCOMPARE(result.statusCode(), QOpcUa::UaStatusCode::Good);
+
+    QVERIFY(table->read(1, &result));
+    QCOMPARE(result.valueType(), QOpcUa::Types::Int32);
+    QCOMPARE(result.toLongLong(), qint64(-42));
+
+    QVERIFY(table->read(2, &result));
+    QCOMPARE(result.valueType(), QOpcUa::Types::Boolean);
+    QCOMPARE(result.toBool(), true);
+
+    QVERIFY(table->read(3, &result));
+    QCOMPARE(result.valueType(), QOpcUa::Types::UInt64);
+    QCOMPARE(result.toULongLong(), std::numeric_limits<quint64>::max());
+
+    QVERIFY(table->read(4, &result));
+    QCOMPARE(result.valueType(), QOpcUa::Types::DateTime);
+    QCOMPARE(result.toLongLong(), qint64(123456789));
+
+    QVERIFY(table->read(5, &result));
+    QVERIFY(!result.hasValue());
+    QCOMPARE(result.statusCode(), QOpcUa::UaStatusCode::BadNoCommunication);
+}
+
+void Tst_ValueTable::version()
+{
+    const auto table = QOpcUaValueTablePrivate::create(2);
+    auto d = QOpcUaValueTablePrivate::get(table.get());
+
+    QOpcUaScalarDataChange value;
+    for (int i = 1; i <= 3; ++i) {
+        value.setSignedInteger(i, QOpcUa::Types::Int64);
+        d->write(1, value);
+    }
+
+    QCOMPARE(table->version(0), quint64(0));
+    QCOMPARE(table->version(1), quint64(3));
+
+    quint64 version = 0;
+    QVERIFY(table->read(1, &value, &version));
+    QCOMPARE(version, quint64(3));
+    QCOMPARE(value.toLongLong(), qint64(3));
+}
+
+void Tst_ValueTable::outOfRange()
+{
+    const auto table = QOpcUaValueTablePrivate::create(2);
+    auto d = QOpcUaValueTablePrivate::get(table.get());
+
+    QOpcUaScalarDataChange value;
+    value.setBoolean(true);
+    d->write(-1, value);
+    d->write(2, value);
+
+    QVERIFY(!table->read(-1, &value));
+    QVERIFY(!table->read(2, &value));
+    QVERIFY(!table->read(0, nullptr));
+    QCOMPARE(table->version(0), quint64(0));
+    QCOMPARE(table->version(1), quint64(0));
+}
+
+void Tst_ValueTable::readRange()
+{
+    const auto table = QOpcUaValueTablePrivate::create(4);
+    auto d = QOpcUaValueTablePrivate::get(table.get());
+
+    QOpcUaScalarDataChange value;
+    value.setUnsignedInteger(7, QOpcUa::Types::UInt32);
+    d->write(2, value);
+
+    QList<QOpcUaScalarDataChange> values(3);
+    values[0].setBoolean(true); // Overwritten because the slot has never been written
+
+    QCOMPARE(table->read(1, values), qsizetype(3));
+    QVERIFY(!values.at(0).hasValue());
+    QCOMPARE(values.at(1).toULongLong(), quint64(7));
+    QVERIFY(!values.at(2).hasValue());
+
+    // The table ends before the span
+    QCOMPARE(table->read(3, values), qsizetype(1));
+    QCOMPARE(table->read(4, values), qsizetype(0));
+    QCOMPARE(table->read(-1, values), qsizetype(0));
+}
+
+void Tst_ValueTable::concurrentReaders()
+{
+    constexpr qsizetype slotCount = 4;
+    constexpr qint64 writeCount = 200000;
+
+    const auto table = QOpcUaValueTablePrivate::create(slotCount);
+    auto d = QOpcUaValueTablePrivate::get(table.get());
+    std::atomic<bool> writerFinished {false};
+
+    // The writer stores the same number in the value and both timestamps, a torn read would mix them
+    std::unique_ptr<QThread> writer(QThread::create([d, &writerFinished]() {
+        QOpcUaScalarDataChange value;
+        for (qint64 i = 1; i <= writeCount; ++i) {
+            value.setSignedInteger(i, QOpcUa::Types::Int64);
+            value.setSourceTimestamp(i);
+            value.setServerTimestamp(i);
+            d->write(i % slotCount, value);
+        }
+        writerFinished.store(true, std::memory_order_release);
+    }));
+
+    std::atomic<int> tornReads {0};
+    std::atomic<int> versionErrors {0};
+    std::vector<std::unique_ptr<QThread>> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back(QThread::create([&]() {
+            quint64 lastVersions[slotCount] = {};
+            QOpcUaScalarDataChange value;
+            quint64 version = 0;
+            do {
+                for (qsizetype slot = 0; slot < slotCount; ++slot) {
+                    if (!table->read(slot, &value, &version))
+                        continue;
+                    if (value.toLongLong() != value.sourceTimestamp() || value.toLongLong() != value.serverTimestamp()
+                            || value.toLongLong() % slotCount != slot) {
+                        tornReads.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    if (version < lastVersions[slot])
+                        versionErrors.fetch_add(1, std::memory_order_relaxed);
+                    lastVersions[slot] = version;
+                }
+            } while (!writerFinished.load(std::memory_order_acquire));
+        }));
+    }
+
+    for (const auto &reader : readers)
+        reader->start();
+    writer->start();
+
+    QVERIFY(writer->wait(30000));
+    for (const auto &reader : readers)
+        QVERIFY(reader->wait(30000));
+
+    QCOMPARE(tornReads.load(), 0);
+    QCOMPARE(versionErrors.load(), 0);
+
+    QOpcUaScalarDataChange value;
+    QVERIFY(table->read(writeCount % slotCount, &value));
+    QCOMPARE(value.toLongLong(), writeCount);
+    QCOMPARE(table->version(0), quint64(writeCount / slotCount));
+}
+
+QTEST_GUILESS_MAIN(Tst_ValueTable)
+
+#include "tst_valuetable.moc"
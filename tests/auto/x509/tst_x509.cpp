@@ -15,6 +15,8 @@
 #include <QtTest/QSignalSpy>
 #include <QtTest/QtTest>
 
+#include "../shared/testserverbackends.h"
+
 #define defineDataMethod(name) void name()\
 {\
     QTest::addColumn<QString>("backend");\
@@ -81,7 +83,7 @@ QByteArray asn1dump(const QByteArray &data)
 
 Tst_QOpcUaSecurity::Tst_QOpcUaSecurity()
 {
-    m_backends = QOpcUaProvider::availableBackends();
+    m_backends = testServerBackends();
 }
 
 void Tst_QOpcUaSecurity::initTestCase()
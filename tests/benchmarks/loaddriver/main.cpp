@@ -0,0 +1,752 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+// Load driver for OPC UA servers.
+//
+// Runs a sequence of time boxed workloads against a server and reports throughput and latency
+// percentiles for each workload as JSON or CSV. The defaults match the nodes of the
+// open62541 test server.
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaEndpointDescription>
+#include <QtOpcUa/QOpcUaHistoryReadRawRequest>
+#include <QtOpcUa/QOpcUaHistoryReadResponse>
+#include <QtOpcUa/QOpcUaMonitoringParameters>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+#include <QtOpcUa/QOpcUaReadItem>
+#include <QtOpcUa/QOpcUaReadResult>
+#include <QtOpcUa/QOpcUaReferenceDescription>
+#include <QtOpcUa/QOpcUaWriteItem>
+#include <QtOpcUa/QOpcUaWriteResult>
+#include <QtOpcUa/qopcuahistorydata.h>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QQueue>
+#include <QtCore/QSet>
+#include <QtCore/QTextStream>
+#include <QtCore/QTimer>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+static const QStringList defaultReadNodes = {
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Boolean"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Byte"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Float"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt64"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.String"),
+};
+
+static const QStringList defaultDoubleNodes = {
+    QStringLiteral("ns=3;s=TestNode.ReadWrite"),
+    QStringLiteral("ns=3;s=TestNode2.ReadWrite"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+    QStringLiteral("ns=3;s=Demo.Static.Scalar.FullyWritable"),
+};
+
+struct Options
+{
+    QUrl url;
+    QString backend;
+    QVariantMap backendProperties;
+    QStringList workloads;
+    QStringList readNodes;
+    QStringList writeNodes;
+    QString browseRoot;
+    QString historyNode;
+    int batchSize = 100;
+    int concurrency = 1;
+    int durationMs = 10000;
+    int writeIntervalMs = 10;
+    double publishingInterval = 100;
+    int historySeed = 100;
+};
+
+struct WorkloadResult
+{
+    QString workload;
+    quint64 operations = 0;
+    quint64 items = 0;
+    quint64 errors = 0;
+    qint64 elapsedNs = 0;
+    std::vector<qint64> latenciesNs;
+};
+
+static qint64 percentile(const std::vector<qint64> &sortedValues, double fraction)
+{
+    if (sortedValues.empty())
+        return 0;
+
+    const size_t index = static_cast<size_t>(fraction * (sortedValues.size() - 1) + 0.5);
+    return sortedValues[(std::min)(index, sortedValues.size() - 1)];
+}
+
+// Keeps up to concurrency requests in flight until the duration has expired.
+// issue() is called with a token identifying the request and returns false if no request could be sent.
+// complete() must be called with the token of the request for each response, the responses may arrive
+// in any order.
+class RequestLoop
+{
+public:
+    RequestLoop(const QElapsedTimer &clock, int concurrency, std::function<bool(quint64)> issue)
+        : m_clock(clock)
+        , m_concurrency(concurrency)
+        , m_issue(std::move(issue))
+    {
+    }
+
+    WorkloadResult run(const QString &workload, int durationMs)
+    {
+        m_result = WorkloadResult();
+        m_result.workload = workload;
+        m_stopping = false;
+        m_sendTimes.clear();
+        m_inFlight = 0;
+
+        QTimer::singleShot(durationMs, &m_loop, [this]() {
+            m_stopping = true;
+            if (!m_inFlight)
+                m_loop.quit();
+        });
+
+        const qint64 start = m_clock.nsecsElapsed();
+        fill();
+        if (m_inFlight)
+            m_loop.exec();
+        m_result.elapsedNs = m_clock.nsecsElapsed() - start;
+
+        std::sort(m_result.latenciesNs.begin(), m_result.latenciesNs.end());
+        return std::move(m_result);
+    }
+
+    void complete(quint64 token, qsizetype items, bool good)
+    {
+        const auto it = m_sendTimes.find(token);
+        if (it == m_sendTimes.end())
+            return;
+
+        m_result.latenciesNs.push_back(m_clock.nsecsElapsed() - it.value());
+        m_sendTimes.erase(it);
+        finish(items, good);
+    }
+
+    // A failed response without results can't be assigned to a request, it is counted without a latency
+    void completeUnassigned(qsizetype items, bool good)
+    {
+        if (m_inFlight)
+            finish(items, good);
+    }
+
+private:
+    void finish(qsizetype items, bool good)
+    {
+        --m_inFlight;
+        ++m_result.operations;
+        m_result.items += items;
+        if (!good)
+            ++m_result.errors;
+
+        fill();
+        if (!m_inFlight)
+            m_loop.quit();
+    }
+
+    void fill()
+    {
+        while (!m_stopping && m_inFlight < m_concurrency) {
+            const quint64 token = ++m_nextToken;
+            const qint64 sendTime = m_clock.nsecsElapsed();
+            if (!m_issue(token))
+                break;
+            m_sendTimes.insert(token, sendTime);
+            ++m_inFlight;
+        }
+    }
+
+    const QElapsedTimer &m_clock;
+    int m_concurrency;
+    std::function<bool(quint64)> m_issue;
+    QHash<quint64, qint64> m_sendTimes;
+    int m_inFlight = 0;
+    quint64 m_nextToken = 0;
+    WorkloadResult m_result;
+    QEventLoop m_loop;
+    bool m_stopping = false;
+};
+
+// Batch reads and writes have no request handle. The last item of each batch addresses a node which
+// doesn't exist, its node id carries the token of the request and is returned in the results.
+static const QString tokenNodeIdPrefix = QStringLiteral("ns=0;s=LoadDriver.Request.");
+
+static QString tokenNodeId(quint64 token)
+{
+    return tokenNodeIdPrefix + QString::number(token);
+}
+
+template <typename Result>
+static void completeBatch(RequestLoop &requests, const QList<Result> &results, QOpcUa::UaStatusCode serviceResult)
+{
+    const bool good = serviceResult == QOpcUa::UaStatusCode::Good;
+    if (results.isEmpty() || !results.constLast().nodeId().startsWith(tokenNodeIdPrefix)) {
+        requests.completeUnassigned(results.size(), false);
+        return;
+    }
+
+    const quint64 token = QStringView(results.constLast().nodeId()).sliced(tokenNodeIdPrefix.size()).toULongLong();
+    requests.complete(token, results.size() - 1, good);
+}
+
+class LoadDriver : public QObject
+{
+public:
+    explicit LoadDriver(const Options &options)
+        : m_options(options)
+    {
+        m_clock.start();
+    }
+
+    bool connectToServer();
+    void disconnectFromServer();
+    bool runWorkload(const QString &workload);
+
+    const QList<WorkloadResult> &results() const { return m_results; }
+
+private:
+    template <typename Sender, typename Signal>
+    bool waitFor(Sender *sender, Signal signal, int timeout = 10000);
+
+    WorkloadResult runRead();
+    WorkloadResult runWrite();
+    void runSubscribe();
+    WorkloadResult runBrowse();
+    WorkloadResult runHistory();
+
+    Options m_options;
+    QElapsedTimer m_clock;
+    QOpcUaProvider m_provider;
+    std::unique_ptr<QOpcUaClient> m_client;
+    QList<WorkloadResult> m_results;
+};
+
+template <typename Sender, typename Signal>
+bool LoadDriver::waitFor(Sender *sender, Signal signal, int timeout)
+{
+    QEventLoop loop;
+    bool received = false;
+    const auto connection = connect(sender, signal, &loop, [&]() {
+        received = true;
+        loop.quit();
+    });
+    QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+    loop.exec();
+    disconnect(connection);
+    return received;
+}
+
+bool LoadDriver::connectToServer()
+{
+    m_client.reset(m_provider.createClient(m_options.backend, m_options.backendProperties));
+    if (!m_client) {
+        qCritical("Could not create a client for the backend %s", qPrintable(m_options.backend));
+        return false;
+    }
+
+    QList<QOpcUaEndpointDescription> endpoints;
+    const auto connection = connect(m_client.get(), &QOpcUaClient::endpointsRequestFinished, this,
+                                    [&endpoints](const QList<QOpcUaEndpointDescription> &result) { endpoints = result; });
+    const bool received = m_client->requestEndpoints(m_options.url)
+            && waitFor(m_client.get(), &QOpcUaClient::endpointsRequestFinished);
+    disconnect(connection);
+
+    if (!received || endpoints.isEmpty()) {
+        qCritical("Could not get the endpoints of %s", qPrintable(m_options.url.toString()));
+        return false;
+    }
+
+    // Prefer an unencrypted endpoint to measure the client and not the crypto library
+    auto endpoint = std::find_if(endpoints.cbegin(), endpoints.cend(), [](const QOpcUaEndpointDescription &desc) {
+        return desc.securityMode() == QOpcUaEndpointDescription::MessageSecurityMode::None;
+    });
+
+    m_client->connectToEndpoint(endpoint != endpoints.cend() ? *endpoint : endpoints.first());
+    if (m_client->state() != QOpcUaClient::Connected)
+        waitFor(m_client.get(), &QOpcUaClient::connected);
+
+    if (m_client->state() != QOpcUaClient::Connected) {
+        qCritical("Could not connect to %s", qPrintable(m_options.url.toString()));
+        return false;
+    }
+
+    return true;
+}
+
+void LoadDriver::disconnectFromServer()
+{
+    if (m_client && m_client->state() == QOpcUaClient::Connected) {
+        m_client->disconnectFromEndpoint();
+        waitFor(m_client.get(), &QOpcUaClient::disconnected);
+    }
+}
+
+bool LoadDriver::runWorkload(const QString &workload)
+{
+    if (workload == QLatin1String("read"))
+        m_results.append(runRead());
+    else if (workload == QLatin1String("write"))
+        m_results.append(runWrite());
+    else if (workload == QLatin1String("subscribe"))
+        runSubscribe();
+    else if (workload == QLatin1String("browse"))
+        m_results.append(runBrowse());
+    else if (workload == QLatin1String("history"))
+        m_results.append(runHistory());
+    else
+        return false;
+
+    return true;
+}
+
+WorkloadResult LoadDriver::runRead()
+{
+    QList<QOpcUaReadItem> request;
+    for (int i = 0; i < m_options.batchSize; ++i)
+        request.append(QOpcUaReadItem(m_options.readNodes.at(i % m_options.readNodes.size())));
+    request.append(QOpcUaReadItem());
+
+    RequestLoop requests(m_clock, m_options.concurrency, [&](quint64 token) {
+        request.last().setNodeId(tokenNodeId(token));
+        return m_client->readNodeAttributes(request);
+    });
+
+    const auto connection = connect(m_client.get(), &QOpcUaClient::readNodeAttributesFinished, this,
+                                    [&](const QList<QOpcUaReadResult> &results, QOpcUa::UaStatusCode serviceResult) {
+        completeBatch(requests, results, serviceResult);
+    });
+
+    auto result = requests.run(QStringLiteral("read"), m_options.durationMs);
+    disconnect(connection);
+    return result;
+}
+
+WorkloadResult LoadDriver::runWrite()
+{
+    double value = 0;
+    QList<QOpcUaWriteItem> request;
+    for (int i = 0; i < m_options.batchSize; ++i)
+        request.append(QOpcUaWriteItem(m_options.writeNodes.at(i % m_options.writeNodes.size()), QOpcUa::NodeAttribute::Value,
+                                       value, QOpcUa::Types::Double));
+    request.append(QOpcUaWriteItem(QString(), QOpcUa::NodeAttribute::Value, value, QOpcUa::Types::Double));
+
+    RequestLoop requests(m_clock, m_options.concurrency, [&](quint64 token) {
+        ++value;
+        for (auto &item : request)
+            item.setValue(value);
+        request.last().setNodeId(tokenNodeId(token));
+        return m_client->writeNodeAttributes(request);
+    });
+
+    const auto connection = connect(m_client.get(), &QOpcUaClient::writeNodeAttributesFinished, this,
+                                    [&](const QList<QOpcUaWriteResult> &results, QOpcUa::UaStatusCode serviceResult) {
+        completeBatch(requests, results, serviceResult);
+    });
+
+    auto result = requests.run(QStringLiteral("write"), m_options.durationMs);
+    disconnect(connection);
+    return result;
+}
+
+// Produces two results, the creation of the monitored items and the data change notifications.
+// The writer stores its send time in the written value, the latency is taken on arrival of the data change.
+void LoadDriver::runSubscribe()
+{
+    WorkloadResult creation;
+    creation.workload = QStringLiteral("subscribe-create");
+
+    std::vector<std::unique_ptr<QOpcUaNode>> nodes;
+    QEventLoop creationLoop;
+    int pendingItems = m_options.writeNodes.size();
+
+    WorkloadResult notifications;
+    notifications.workload = QStringLiteral("subscribe");
+    qint64 firstSendTime = -1;
+
+    QOpcUaMonitoringParameters parameters(m_options.publishingInterval);
+    parameters.setSamplingInterval(0);
+    parameters.setQueueSize(100);
+
+    const qint64 creationStart = m_clock.nsecsElapsed();
+    for (const auto &nodeId : std::as_const(m_options.writeNodes)) {
+        nodes.emplace_back(m_client->node(nodeId));
+        QOpcUaNode *node = nodes.back().get();
+        if (!node) {
+            ++creation.errors;
+            --pendingItems;
+            continue;
+        }
+
+        connect(node, &QOpcUaNode::enableMonitoringFinished, this, [&](QOpcUa::NodeAttribute, QOpcUa::UaStatusCode statusCode) {
+            ++creation.operations;
+            ++creation.items;
+            if (statusCode != QOpcUa::UaStatusCode::Good)
+                ++creation.errors;
+            creation.latenciesNs.push_back(m_clock.nsecsElapsed() - creationStart);
+            if (--pendingItems == 0)
+                creationLoop.quit();
+        });
+
+        connect(node, &QOpcUaNode::dataChangeOccurred, this, [&](QOpcUa::NodeAttribute, const QVariant &value) {
+            const qint64 sendTime = static_cast<qint64>(value.toDouble());
+            if (firstSendTime < 0 || sendTime < firstSendTime)
+                return; // Initial value or value written before the writer started
+            ++notifications.operations;
+            ++notifications.items;
+            notifications.latenciesNs.push_back(m_clock.nsecsElapsed() - sendTime);
+        });
+
+        if (!node->enableMonitoring(QOpcUa::NodeAttribute::Value, parameters)) {
+            ++creation.errors;
+            --pendingItems;
+        }
+    }
+
+    if (pendingItems > 0) {
+        QTimer::singleShot(30000, &creationLoop, &QEventLoop::quit);
+        creationLoop.exec();
+    }
+    creation.elapsedNs = m_clock.nsecsElapsed() - creationStart;
+    std::sort(creation.latenciesNs.begin(), creation.latenciesNs.end());
+    m_results.append(creation);
+
+    QList<QOpcUaWriteItem> request;
+    for (const auto &nodeId : std::as_const(m_options.writeNodes))
+        request.append(QOpcUaWriteItem(nodeId, QOpcUa::NodeAttribute::Value, 0.0, QOpcUa::Types::Double));
+
+    QTimer writer;
+    connect(&writer, &QTimer::timeout, this, [&]() {
+        const double sendTime = static_cast<double>(m_clock.nsecsElapsed());
+        if (firstSendTime < 0)
+            firstSendTime = static_cast<qint64>(sendTime);
+        for (auto &item : request)
+            item.setValue(sendTime);
+        if (!m_client->writeNodeAttributes(request))
+            ++notifications.errors;
+    });
+    const auto writeConnection = connect(m_client.get(), &QOpcUaClient::writeNodeAttributesFinished, this,
+                                         [&](const QList<QOpcUaWriteResult> &, QOpcUa::UaStatusCode serviceResult) {
+        if (serviceResult != QOpcUa::UaStatusCode::Good)
+            ++notifications.errors;
+    });
+
+    const qint64 start = m_clock.nsecsElapsed();
+    QEventLoop loop;
+    writer.start(m_options.writeIntervalMs);
+    QTimer::singleShot(m_options.durationMs, &loop, &QEventLoop::quit);
+    loop.exec();
+    writer.stop();
+
+    // Collect the notifications which are still on their way
+    QEventLoop drainLoop;
+    QTimer::singleShot(static_cast<int>(m_options.publishingInterval) * 2 + 100, &drainLoop, &QEventLoop::quit);
+    drainLoop.exec();
+    notifications.elapsedNs = m_clock.nsecsElapsed() - start;
+    disconnect(writeConnection);
+
+    std::sort(notifications.latenciesNs.begin(), notifications.latenciesNs.end());
+    m_results.append(notifications);
+}
+
+WorkloadResult LoadDriver::runBrowse()
+{
+    QSet<QString> visited;
+    QQueue<QString> frontier;
+    QObject nodeOwner;
+    int browsesInFlight = 0;
+
+    RequestLoop *loop = nullptr;
+
+    // The crawl starts over from the root when the whole tree has been visited
+    RequestLoop requests(m_clock, m_options.concurrency, [&](quint64 token) {
+        if (frontier.isEmpty()) {
+            if (browsesInFlight > 0)
+                return false;
+            visited = { m_options.browseRoot };
+            frontier.enqueue(m_options.browseRoot);
+        }
+
+        QOpcUaNode *node = m_client->node(frontier.dequeue());
+        if (!node)
+            return false;
+
+        node->setParent(&nodeOwner);
+        connect(node, &QOpcUaNode::browseFinished, &nodeOwner,
+                [&, node, token](const QList<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode) {
+            node->deleteLater();
+            --browsesInFlight;
+            for (const auto &child : children) {
+                const QString childId = child.targetNodeId().nodeId();
+                if (!visited.contains(childId)) {
+                    visited.insert(childId);
+                    frontier.enqueue(childId);
+                }
+            }
+            loop->complete(token, children.size(), statusCode == QOpcUa::UaStatusCode::Good);
+        });
+
+        if (!node->browseChildren()) {
+            delete node;
+            return false;
+        }
+
+        ++browsesInFlight;
+        return true;
+    });
+    loop = &requests;
+
+    return requests.run(QStringLiteral("browse"), m_options.durationMs);
+}
+
+WorkloadResult LoadDriver::runHistory()
+{
+    QScopedPointer<QOpcUaNode> node(m_client->node(m_options.historyNode));
+    if (!node) {
+        WorkloadResult result;
+        result.workload = QStringLiteral("history");
+        result.errors = 1;
+        return result;
+    }
+
+    for (int i = 0; i < m_options.historySeed; ++i) {
+        node->writeValueAttribute(i, QOpcUa::Types::Int32);
+        waitFor(node.get(), &QOpcUaNode::attributeWritten);
+    }
+
+    const QOpcUaHistoryReadRawRequest request({QOpcUaReadItem(m_options.historyNode)},
+                                              QDateTime::currentDateTime().addDays(-1),
+                                              QDateTime::currentDateTime().addDays(1));
+    QObject responseOwner;
+    RequestLoop *loop = nullptr;
+
+    RequestLoop requests(m_clock, m_options.concurrency, [&](quint64 token) {
+        QOpcUaHistoryReadResponse *response = m_client->readHistoryData(request);
+        if (!response)
+            return false;
+
+        response->setParent(&responseOwner);
+        connect(response, &QOpcUaHistoryReadResponse::readHistoryDataFinished, &responseOwner,
+                [&, response, token](const QList<QOpcUaHistoryData> &results, QOpcUa::UaStatusCode serviceResult) {
+            response->deleteLater();
+            qsizetype values = 0;
+            for (const auto &result : results)
+                values += result.count();
+            loop->complete(token, values, serviceResult == QOpcUa::UaStatusCode::Good);
+        });
+        return true;
+    });
+    loop = &requests;
+
+    return requests.run(QStringLiteral("history"), m_options.durationMs);
+}
+
+static QJsonObject toJson(const WorkloadResult &result)
+{
+    const double seconds = result.elapsedNs / 1e9;
+
+    QJsonObject latency;
+    latency[QLatin1String("p50")] = percentile(result.latenciesNs, 0.5) / 1e3;
+    latency[QLatin1String("p90")] = percentile(result.latenciesNs, 0.9) / 1e3;
+    latency[QLatin1String("p99")] = percentile(result.latenciesNs, 0.99) / 1e3;
+    latency[QLatin1String("max")] = percentile(result.latenciesNs, 1.0) / 1e3;
+
+    QJsonObject object;
+    object[QLatin1String("workload")] = result.workload;
+    object[QLatin1String("operations")] = static_cast<qint64>(result.operations);
+    object[QLatin1String("items")] = static_cast<qint64>(result.items);
+    object[QLatin1String("errors")] = static_cast<qint64>(result.errors);
+    object[QLatin1String("durationMs")] = result.elapsedNs / 1e6;
+    object[QLatin1String("operationsPerSecond")] = seconds > 0 ? result.operations / seconds : 0;
+    object[QLatin1String("itemsPerSecond")] = seconds > 0 ? result.items / seconds : 0;
+    object[QLatin1String("latencyUs")] = latency;
+    return object;
+}
+
+static QByteArray formatResults(const QList<WorkloadResult> &results, const Options &options, const QString &format)
+{
+    if (format == QLatin1String("csv")) {
+        QByteArray csv("workload,operations,items,errors,duration_ms,operations_per_s,items_per_s,p50_us,p90_us,p99_us,max_us\n");
+        for (const auto &result : results) {
+            const QJsonObject object = toJson(result);
+            const QJsonObject latency = object[QLatin1String("latencyUs")].toObject();
+            QStringList fields {
+                result.workload,
+                QString::number(result.operations),
+                QString::number(result.items),
+                QString::number(result.errors),
+                QString::number(object[QLatin1String("durationMs")].toDouble(), 'f', 3),
+                QString::number(object[QLatin1String("operationsPerSecond")].toDouble(), 'f', 3),
+                QString::number(object[QLatin1String("itemsPerSecond")].toDouble(), 'f', 3),
+                QString::number(latency[QLatin1String("p50")].toDouble(), 'f', 3),
+                QString::number(latency[QLatin1String("p90")].toDouble(), 'f', 3),
+                QString::number(latency[QLatin1String("p99")].toDouble(), 'f', 3),
+                QString::number(latency[QLatin1String("max")].toDouble(), 'f', 3),
+            };
+            csv.append(fields.join(QLatin1Char(',')).toUtf8()).append('\n');
+        }
+        return csv;
+    }
+
+    QJsonArray array;
+    for (const auto &result : results)
+        array.append(toJson(result));
+
+    QJsonObject document;
+    document[QLatin1String("endpoint")] = options.url.toString();
+    document[QLatin1String("backend")] = options.backend;
+    document[QLatin1String("timestamp")] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    document[QLatin1String("batchSize")] = options.batchSize;
+    document[QLatin1String("concurrency")] = options.concurrency;
+    document[QLatin1String("results")] = array;
+    return QJsonDocument(document).toJson();
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Measures the throughput and latency of OPC UA services."));
+    parser.addHelpOption();
+
+    const QCommandLineOption urlOption(QStringLiteral("url"), QStringLiteral("The discovery URL of the server."),
+                                       QStringLiteral("url"), QStringLiteral("opc.tcp://127.0.0.1:43344"));
+    const QCommandLineOption backendOption(QStringLiteral("backend"), QStringLiteral("The client backend."),
+                                           QStringLiteral("name"), QStringLiteral("open62541"));
+    const QCommandLineOption backendPropertyOption(QStringLiteral("backend-property"),
+                                                   QStringLiteral("A backend property passed to the client, can be repeated. "
+                                                                  "The loopback backend serves values without a server, "
+                                                                  "for example --backend loopback --backend-property generatorNodeCount=100."),
+                                                   QStringLiteral("name=value"));
+    const QCommandLineOption workloadOption(QStringLiteral("workload"),
+                                            QStringLiteral("Comma separated list of workloads: read, write, subscribe, browse, history."),
+                                            QStringLiteral("list"), QStringLiteral("read,write,subscribe,browse,history"));
+    const QCommandLineOption readNodesOption(QStringLiteral("read-nodes"), QStringLiteral("Comma separated list of nodes to read."),
+                                             QStringLiteral("list"), defaultReadNodes.join(QLatin1Char(',')));
+    const QCommandLineOption writeNodesOption(QStringLiteral("write-nodes"),
+                                              QStringLiteral("Comma separated list of Double variables to write and monitor."),
+                                              QStringLiteral("list"), defaultDoubleNodes.join(QLatin1Char(',')));
+    const QCommandLineOption loadVariablesOption(QStringLiteral("load-variables"),
+                                                 QStringLiteral("Use the first count variables of the load namespace of the test server "
+                                                                "instead of the read and write node lists. The variables must be of type Double."),
+                                                 QStringLiteral("count"));
+    const QCommandLineOption browseRootOption(QStringLiteral("browse-root"), QStringLiteral("The node to start the browse crawl from."),
+                                              QStringLiteral("node"), QStringLiteral("ns=0;i=85"));
+    const QCommandLineOption historyNodeOption(QStringLiteral("history-node"), QStringLiteral("The historizing variable of type Int32."),
+                                               QStringLiteral("node"), QStringLiteral("ns=2;s=Demo.Static.Historizing2"));
+    const QCommandLineOption historySeedOption(QStringLiteral("history-seed"),
+                                               QStringLiteral("Number of values written to the history node before reading."),
+                                               QStringLiteral("count"), QStringLiteral("100"));
+    const QCommandLineOption batchSizeOption(QStringLiteral("batch-size"), QStringLiteral("Number of nodes per read or write request."),
+                                             QStringLiteral("count"), QStringLiteral("100"));
+    const QCommandLineOption concurrencyOption(QStringLiteral("concurrency"), QStringLiteral("Number of requests kept in flight."),
+                                               QStringLiteral("count"), QStringLiteral("1"));
+    const QCommandLineOption durationOption(QStringLiteral("duration"), QStringLiteral("Duration of each workload in seconds."),
+                                            QStringLiteral("seconds"), QStringLiteral("10"));
+    const QCommandLineOption writeIntervalOption(QStringLiteral("write-interval"),
+                                                 QStringLiteral("Interval of the writes in the subscribe workload in milliseconds."),
+                                                 QStringLiteral("ms"), QStringLiteral("10"));
+    const QCommandLineOption publishingIntervalOption(QStringLiteral("publishing-interval"),
+                                                      QStringLiteral("Publishing interval of the subscription in milliseconds."),
+                                                      QStringLiteral("ms"), QStringLiteral("100"));
+    const QCommandLineOption formatOption(QStringLiteral("format"), QStringLiteral("Output format: json or csv."),
+                                          QStringLiteral("format"), QStringLiteral("json"));
+    const QCommandLineOption outputOption(QStringLiteral("output"), QStringLiteral("Output file, stdout if not set."),
+                                          QStringLiteral("file"));
+
+    parser.addOptions({ urlOption, backendOption, backendPropertyOption, workloadOption, readNodesOption, writeNodesOption, loadVariablesOption, browseRootOption,
+                        historyNodeOption, historySeedOption, batchSizeOption, concurrencyOption, durationOption,
+                        writeIntervalOption, publishingIntervalOption, formatOption, outputOption });
+    parser.process(app);
+
+    Options options;
+    options.url = QUrl(parser.value(urlOption));
+    options.backend = parser.value(backendOption);
+    for (const auto &property : parser.values(backendPropertyOption)) {
+        const auto separator = property.indexOf(QLatin1Char('='));
+        if (separator <= 0) {
+            qCritical("Invalid backend property %s", qPrintable(property));
+            return EXIT_FAILURE;
+        }
+        options.backendProperties.insert(property.left(separator), property.mid(separator + 1));
+    }
+    options.workloads = parser.value(workloadOption).split(QLatin1Char(','), Qt::SkipEmptyParts);
+    options.readNodes = parser.value(readNodesOption).split(QLatin1Char(','), Qt::SkipEmptyParts);
+    options.writeNodes = parser.value(writeNodesOption).split(QLatin1Char(','), Qt::SkipEmptyParts);
+    if (parser.isSet(loadVariablesOption)) {
+        const int count = parser.value(loadVariablesOption).toInt();
+        QStringList loadNodes;
+        for (int i = 0; i < count; ++i)
+            loadNodes.append(QStringLiteral("ns=2;s=Load.Variable.%1").arg(i));
+        options.readNodes = loadNodes;
+        options.writeNodes = loadNodes;
+    }
+    options.browseRoot = parser.value(browseRootOption);
+    options.historyNode = parser.value(historyNodeOption);
+    options.historySeed = parser.value(historySeedOption).toInt();
+    options.batchSize = (std::max)(1, parser.value(batchSizeOption).toInt());
+    options.concurrency = (std::max)(1, parser.value(concurrencyOption).toInt());
+    options.durationMs = (std::max)(1, parser.value(durationOption).toInt()) * 1000;
+    options.writeIntervalMs = (std::max)(1, parser.value(writeIntervalOption).toInt());
+    options.publishingInterval = (std::max)(0.0, parser.value(publishingIntervalOption).toDouble());
+
+    const QString format = parser.value(formatOption);
+    if (format != QLatin1String("json") && format != QLatin1String("csv")) {
+        qCritical("Unknown output format %s", qPrintable(format));
+        return EXIT_FAILURE;
+    }
+
+    if (options.readNodes.isEmpty() || options.writeNodes.isEmpty()) {
+        qCritical("The lists of nodes must not be empty");
+        return EXIT_FAILURE;
+    }
+
+    LoadDriver driver(options);
+    if (!driver.connectToServer())
+        return EXIT_FAILURE;
+
+    for (const auto &workload : std::as_const(options.workloads)) {
+        if (!driver.runWorkload(workload.trimmed())) {
+            qCritical("Unknown workload %s", qPrintable(workload));
+            driver.disconnectFromServer();
+            return EXIT_FAILURE;
+        }
+    }
+
+    driver.disconnectFromServer();
+
+    const QByteArray output = formatResults(driver.results(), options, format);
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qCritical("Could not open %s", qPrintable(file.fileName()));
+            return EXIT_FAILURE;
+        }
+        file.write(output);
+    } else {
+        QTextStream(stdout) << output;
+    }
+
+    return EXIT_SUCCESS;
+}
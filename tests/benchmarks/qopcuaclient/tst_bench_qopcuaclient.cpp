@@ -0,0 +1,684 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+// Benchmarks for the client hot paths against the open62541 test server.
+//
+// The results can be written in a machine-readable format using the output options of QTest,
+// for example "tst_bench_qopcuaclient -o results.csv,csv" or "-o results.xml,xml".
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaHistoryReadRawRequest>
+#include <QtOpcUa/QOpcUaHistoryReadResponse>
+#include <QtOpcUa/QOpcUaMonitoringParameters>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+#include <QtOpcUa/QOpcUaReadItem>
+#include <QtOpcUa/QOpcUaReadResult>
+#include <QtOpcUa/QOpcUaReferenceDescription>
+#include <QtOpcUa/QOpcUaWriteItem>
+#include <QtOpcUa/QOpcUaWriteResult>
+#include <QtOpcUa/qopcuahistorydata.h>
+#include <QtOpcUa/qopcuareadgroup.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QEventLoop>
+#include <QtCore/QProcess>
+#include <QtCore/QQueue>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
+#include <QtCore/QTimer>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QtTest>
+#include <QTcpSocket>
+#include <QTcpServer>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+const int signalSpyTimeout = 10000;
+
+static const QStringList scalarNodes = {
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Boolean"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Byte"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.SByte"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Float"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Int16"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Int64"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt16"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt32"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt64"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.String"),
+};
+
+// Writable variables of type Double
+static const QStringList doubleNodes = {
+    QStringLiteral("ns=3;s=TestNode.ReadWrite"),
+    QStringLiteral("ns=3;s=TestNode2.ReadWrite"),
+    QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"),
+    QStringLiteral("ns=3;s=Demo.Static.Scalar.FullyWritable"),
+};
+
+static const QString largeFolderNode = QStringLiteral("ns=1;s=Large.Folder");
+static const QString historizingNode = QStringLiteral("ns=2;s=Demo.Static.Historizing2");
+
+static qint64 percentile(const std::vector<qint64> &sortedValues, double fraction)
+{
+    if (sortedValues.empty())
+        return 0;
+
+    const size_t index = static_cast<size_t>(fraction * (sortedValues.size() - 1) + 0.5);
+    return sortedValues[(std::min)(index, sortedValues.size() - 1)];
+}
+
+// Runs an event loop until quit() is called or the timeout expires
+class EventLoopWaiter
+{
+public:
+    EventLoopWaiter()
+    {
+        m_timer.setSingleShot(true);
+        QObject::connect(&m_timer, &QTimer::timeout, &m_loop, &QEventLoop::quit);
+    }
+
+    bool wait(int timeout = signalSpyTimeout)
+    {
+        if (m_done)
+            return true;
+        m_timer.start(timeout);
+        m_loop.exec();
+        m_timer.stop();
+        return m_done;
+    }
+
+    void quit()
+    {
+        m_done = true;
+        m_loop.quit();
+    }
+
+    void reset() { m_done = false; }
+
+private:
+    QEventLoop m_loop;
+    QTimer m_timer;
+    bool m_done = false;
+};
+
+class tst_QOpcUaClientBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void batchRead_data();
+    void batchRead();
+    void batchWrite_data();
+    void batchWrite();
+    void readGroup_data();
+    void readGroup();
+    void monitoredItemCreation_data();
+    void monitoredItemCreation();
+    void dataChangeThroughput();
+    void dataChangeLatency_data();
+    void dataChangeLatency();
+    void browseCrawl();
+    void historyRead_data();
+    void historyRead();
+
+private:
+    QOpcUaClient *createConnectedClient(const QVariantMap &backendProperties);
+    void disconnectClient(QOpcUaClient *client);
+    void measureDataChangeLatency();
+
+    QString envOrDefault(const char *env, QString def)
+    {
+        return qEnvironmentVariableIsSet(env) ? qgetenv(env).constData() : def;
+    }
+
+    QOpcUaProvider m_opcUa;
+    QOpcUaClient *m_client = nullptr;
+    QOpcUaEndpointDescription m_endpoint;
+    QProcess m_serverProcess;
+    QString m_testServerPath;
+    QStringList m_largeFolderChildren;
+    std::vector<qint64> m_dataChangeLatencies;
+};
+
+void tst_QOpcUaClientBenchmark::initTestCase()
+{
+    const quint16 defaultPort = 43344;
+    const QHostAddress defaultHost(QHostAddress::LocalHost);
+
+    if (!QOpcUaProvider::availableBackends().contains(QLatin1String("open62541")))
+        QSKIP("The benchmarks require the open62541 backend");
+
+    if (qEnvironmentVariableIsEmpty("OPCUA_HOST") && qEnvironmentVariableIsEmpty("OPCUA_PORT")) {
+        m_testServerPath = qApp->applicationDirPath()
+
+#if defined(Q_OS_MACOS)
+                                     + QLatin1String("/../../open62541-testserver/open62541-testserver.app/Contents/MacOS/open62541-testserver")
+#else
+
+#if defined(Q_OS_WIN) && !defined(TESTS_CMAKE_SPECIFIC_PATH)
+                                     + QLatin1String("/..")
+#endif
+                                     + QLatin1String("/../../open62541-testserver/open62541-testserver")
+#ifdef Q_OS_WIN
+                                     + QLatin1String(".exe")
+#endif
+
+#endif
+                ;
+        if (!QFile::exists(m_testServerPath)) {
+            qDebug() << "Server Path:" << m_testServerPath;
+            QSKIP("the benchmarks rely on an open62541-based test-server");
+        }
+
+        QTcpSocket socket;
+        socket.connectToHost(defaultHost, defaultPort);
+        QVERIFY2(socket.waitForConnected(1500) == false, "Server is already running");
+
+        QTcpServer server;
+        QVERIFY2(server.listen(defaultHost, defaultPort) == true, "Port is occupied by another process. Check for defunct server.");
+        server.close();
+
+        m_serverProcess.start(m_testServerPath);
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+        QVERIFY(m_serverProcess.state() == QProcess::Running);
+
+        bool success = false;
+        for (int i = 0; i < 50 && !success; ++i) {
+            QTest::qSleep(100);
+            socket.connectToHost(defaultHost, defaultPort);
+            success = socket.waitForConnected(5000);
+        }
+
+        if (!success)
+            QFAIL("Server does not run");
+
+        socket.disconnectFromHost();
+    }
+
+    const QString host = envOrDefault("OPCUA_HOST", defaultHost.toString());
+    const QString port = envOrDefault("OPCUA_PORT", QString::number(defaultPort));
+    const QUrl discoveryEndpoint(QStringLiteral("opc.tcp://%1:%2").arg(host, port));
+
+    QScopedPointer<QOpcUaClient> discoveryClient(m_opcUa.createClient(QStringLiteral("open62541")));
+    QVERIFY(discoveryClient != nullptr);
+    QSignalSpy endpointSpy(discoveryClient.get(), &QOpcUaClient::endpointsRequestFinished);
+    discoveryClient->requestEndpoints(discoveryEndpoint);
+    endpointSpy.wait(signalSpyTimeout);
+    QCOMPARE(endpointSpy.size(), 1);
+
+    const auto desc = endpointSpy.at(0).at(0).value<QList<QOpcUaEndpointDescription>>();
+    QVERIFY(desc.size() > 0);
+    m_endpoint = desc.first();
+
+    m_client = createConnectedClient({});
+    QVERIFY(m_client != nullptr);
+
+    // The objects in the large folder are used as targets for monitored items
+    QScopedPointer<QOpcUaNode> folder(m_client->node(largeFolderNode));
+    QVERIFY(folder != nullptr);
+    QSignalSpy browseSpy(folder.get(), &QOpcUaNode::browseFinished);
+    QVERIFY(folder->browseChildren());
+    browseSpy.wait(signalSpyTimeout);
+    QCOMPARE(browseSpy.size(), 1);
+
+    const auto children = browseSpy.at(0).at(0).value<QList<QOpcUaReferenceDescription>>();
+    for (const auto &child : children)
+        m_largeFolderChildren.append(child.targetNodeId().nodeId());
+    QVERIFY(!m_largeFolderChildren.isEmpty());
+}
+
+void tst_QOpcUaClientBenchmark::cleanupTestCase()
+{
+    if (m_client)
+        disconnectClient(m_client);
+
+    if (m_serverProcess.state() == QProcess::Running) {
+        m_serverProcess.kill();
+        m_serverProcess.waitForFinished(2000);
+    }
+}
+
+QOpcUaClient *tst_QOpcUaClientBenchmark::createConnectedClient(const QVariantMap &backendProperties)
+{
+    QOpcUaClient *client = m_opcUa.createClient(QStringLiteral("open62541"), backendProperties);
+    if (!client)
+        return nullptr;
+
+    client->setParent(this);
+
+    QSignalSpy connectedSpy(client, &QOpcUaClient::connected);
+    client->connectToEndpoint(m_endpoint);
+    connectedSpy.wait(signalSpyTimeout);
+
+    if (client->state() != QOpcUaClient::Connected) {
+        delete client;
+        return nullptr;
+    }
+
+    return client;
+}
+
+void tst_QOpcUaClientBenchmark::disconnectClient(QOpcUaClient *client)
+{
+    if (client->state() == QOpcUaClient::Connected) {
+        QSignalSpy disconnectedSpy(client, &QOpcUaClient::disconnected);
+        client->disconnectFromEndpoint();
+        disconnectedSpy.wait(signalSpyTimeout);
+    }
+}
+
+void tst_QOpcUaClientBenchmark::batchRead_data()
+{
+    QTest::addColumn<int>("batchSize");
+
+    QTest::newRow("1 node") << 1;
+    QTest::newRow("10 nodes") << 10;
+    QTest::newRow("100 nodes") << 100;
+    QTest::newRow("1000 nodes") << 1000;
+}
+
+void tst_QOpcUaClientBenchmark::batchRead()
+{
+    QFETCH(int, batchSize);
+
+    QList<QOpcUaReadItem> request;
+    for (int i = 0; i < batchSize; ++i)
+        request.append(QOpcUaReadItem(scalarNodes.at(i % scalarNodes.size())));
+
+    QSignalSpy readSpy(m_client, &QOpcUaClient::readNodeAttributesFinished);
+
+    QBENCHMARK {
+        readSpy.clear();
+        QVERIFY(m_client->readNodeAttributes(request));
+        readSpy.wait(signalSpyTimeout);
+        QCOMPARE(readSpy.size(), 1);
+    }
+
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(readSpy.at(0).at(0).value<QList<QOpcUaReadResult>>().size(), batchSize);
+}
+
+void tst_QOpcUaClientBenchmark::batchWrite_data()
+{
+    batchRead_data();
+}
+
+void tst_QOpcUaClientBenchmark::batchWrite()
+{
+    QFETCH(int, batchSize);
+
+    QList<QOpcUaWriteItem> request;
+    for (int i = 0; i < batchSize; ++i)
+        request.append(QOpcUaWriteItem(doubleNodes.at(i % doubleNodes.size()), QOpcUa::NodeAttribute::Value,
+                                       static_cast<double>(i), QOpcUa::Types::Double));
+
+    QSignalSpy writeSpy(m_client, &QOpcUaClient::writeNodeAttributesFinished);
+
+    QBENCHMARK {
+        writeSpy.clear();
+        QVERIFY(m_client->writeNodeAttributes(request));
+        writeSpy.wait(signalSpyTimeout);
+        QCOMPARE(writeSpy.size(), 1);
+    }
+
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(writeSpy.at(0).at(0).value<QList<QOpcUaWriteResult>>().size(), batchSize);
+}
+
+void tst_QOpcUaClientBenchmark::readGroup_data()
+{
+    QTest::addColumn<int>("batchSize");
+    QTest::addColumn<bool>("useRegisteredNodes");
+
+    QTest::newRow("100 nodes") << 100 << false;
+    QTest::newRow("100 registered nodes") << 100 << true;
+    QTest::newRow("1000 nodes") << 1000 << false;
+    QTest::newRow("1000 registered nodes") << 1000 << true;
+}
+
+void tst_QOpcUaClientBenchmark::readGroup()
+{
+    QFETCH(int, batchSize);
+    QFETCH(bool, useRegisteredNodes);
+
+    QList<QOpcUaReadItem> request;
+    for (int i = 0; i < batchSize; ++i)
+        request.append(QOpcUaReadItem(scalarNodes.at(i % scalarNodes.size())));
+
+    QScopedPointer<QOpcUaReadGroup> group(m_client->createReadGroup(request, useRegisteredNodes));
+    QVERIFY(group != nullptr);
+
+    if (group->state() == QOpcUaReadGroup::State::Preparing) {
+        QSignalSpy stateSpy(group.get(), &QOpcUaReadGroup::stateChanged);
+        stateSpy.wait(signalSpyTimeout);
+    }
+    QCOMPARE(group->state(), QOpcUaReadGroup::State::Ready);
+
+    QSignalSpy readSpy(group.get(), &QOpcUaReadGroup::readFinished);
+
+    QBENCHMARK {
+        readSpy.clear();
+        QVERIFY(group->read());
+        readSpy.wait(signalSpyTimeout);
+        QCOMPARE(readSpy.size(), 1);
+    }
+
+    QCOMPARE(group->serviceResult(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(group->results().size(), batchSize);
+}
+
+void tst_QOpcUaClientBenchmark::monitoredItemCreation_data()
+{
+    QTest::addColumn<int>("attributesPerNode");
+
+    // One monitored item is created for each attribute of each object in the large folder
+    QTest::newRow("100 items") << 1;
+    QTest::newRow("400 items") << 4;
+    QTest::newRow("800 items") << 8;
+}
+
+void tst_QOpcUaClientBenchmark::monitoredItemCreation()
+{
+    QFETCH(int, attributesPerNode);
+
+    const QOpcUa::NodeAttribute objectAttributes[] = {
+        QOpcUa::NodeAttribute::DisplayName,
+        QOpcUa::NodeAttribute::BrowseName,
+        QOpcUa::NodeAttribute::Description,
+        QOpcUa::NodeAttribute::NodeId,
+        QOpcUa::NodeAttribute::NodeClass,
+        QOpcUa::NodeAttribute::WriteMask,
+        QOpcUa::NodeAttribute::UserWriteMask,
+        QOpcUa::NodeAttribute::EventNotifier,
+    };
+
+    QOpcUa::NodeAttributes attributes;
+    for (int i = 0; i < attributesPerNode; ++i)
+        attributes |= objectAttributes[i];
+
+    const int itemCount = m_largeFolderChildren.size() * attributesPerNode;
+    const int runs = 5;
+    std::vector<qint64> durations;
+
+    for (int run = 0; run < runs; ++run) {
+        int finished = 0;
+        int failed = 0;
+        EventLoopWaiter waiter;
+        std::vector<std::unique_ptr<QOpcUaNode>> nodes;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for (const auto &nodeId : std::as_const(m_largeFolderChildren)) {
+            nodes.emplace_back(m_client->node(nodeId));
+            QVERIFY(nodes.back() != nullptr);
+            connect(nodes.back().get(), &QOpcUaNode::enableMonitoringFinished, this,
+                    [&](QOpcUa::NodeAttribute, QOpcUa::UaStatusCode statusCode) {
+                if (statusCode != QOpcUa::UaStatusCode::Good)
+                    ++failed;
+                if (++finished == itemCount)
+                    waiter.quit();
+            });
+            QVERIFY(nodes.back()->enableMonitoring(attributes, QOpcUaMonitoringParameters(100)));
+        }
+
+        QVERIFY(waiter.wait());
+        durations.push_back(timer.elapsed());
+        QCOMPARE(failed, 0);
+
+        // Remove the monitored items before the next run
+        finished = 0;
+        waiter.reset();
+        for (const auto &node : nodes) {
+            connect(node.get(), &QOpcUaNode::disableMonitoringFinished, this, [&]() {
+                if (++finished == itemCount)
+                    waiter.quit();
+            });
+            QVERIFY(node->disableMonitoring(attributes));
+        }
+        QVERIFY(waiter.wait());
+    }
+
+    std::sort(durations.begin(), durations.end());
+    QTest::setBenchmarkResult(percentile(durations, 0.5), QTest::WalltimeMilliseconds);
+}
+
+void tst_QOpcUaClientBenchmark::dataChangeThroughput()
+{
+    QScopedPointer<QOpcUaClient> client(createConnectedClient({{QStringLiteral("batchDataChanges"), true}}));
+    QVERIFY(client != nullptr);
+
+    std::vector<std::unique_ptr<QOpcUaNode>> nodes;
+    int monitored = 0;
+    for (const auto &nodeId : doubleNodes) {
+        nodes.emplace_back(client->node(nodeId));
+        QVERIFY(nodes.back() != nullptr);
+        QSignalSpy monitoringSpy(nodes.back().get(), &QOpcUaNode::enableMonitoringFinished);
+        QOpcUaMonitoringParameters parameters(10);
+        parameters.setSamplingInterval(0);
+        QVERIFY(nodes.back()->enableMonitoring(QOpcUa::NodeAttribute::Value, parameters));
+        monitoringSpy.wait(signalSpyTimeout);
+        QCOMPARE(monitoringSpy.size(), 1);
+        if (nodes.back()->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode() == QOpcUa::UaStatusCode::Good)
+            ++monitored;
+    }
+    QCOMPARE(monitored, doubleNodes.size());
+
+    // Each round writes a new value to all nodes and waits until all notifications have arrived
+    double round = -1;
+    QSet<QString> pending;
+    EventLoopWaiter waiter;
+
+    connect(client.get(), &QOpcUaClient::dataChangesReceived, this, [&](const QList<QOpcUaReadResult> &results) {
+        for (const auto &result : results) {
+            if (result.value().toDouble() == round)
+                pending.remove(result.nodeId());
+        }
+        if (pending.isEmpty())
+            waiter.quit();
+    });
+
+    QSignalSpy writeSpy(client.get(), &QOpcUaClient::writeNodeAttributesFinished);
+
+    QBENCHMARK {
+        ++round;
+        pending = QSet<QString>(doubleNodes.begin(), doubleNodes.end());
+        waiter.reset();
+
+        QList<QOpcUaWriteItem> request;
+        for (const auto &nodeId : doubleNodes)
+            request.append(QOpcUaWriteItem(nodeId, QOpcUa::NodeAttribute::Value, round, QOpcUa::Types::Double));
+        QVERIFY(client->writeNodeAttributes(request));
+
+        QVERIFY(waiter.wait());
+    }
+
+    QVERIFY(writeSpy.size() > 0);
+    disconnectClient(client.get());
+}
+
+void tst_QOpcUaClientBenchmark::dataChangeLatency_data()
+{
+    QTest::addColumn<double>("fraction");
+
+    QTest::newRow("p50") << 0.5;
+    QTest::newRow("p90") << 0.9;
+    QTest::newRow("p99") << 0.99;
+    QTest::newRow("max") << 1.0;
+}
+
+void tst_QOpcUaClientBenchmark::dataChangeLatency()
+{
+    QFETCH(double, fraction);
+
+    // The samples are collected once and shared by all rows
+    if (m_dataChangeLatencies.empty())
+        measureDataChangeLatency();
+    QVERIFY(!m_dataChangeLatencies.empty());
+
+    QTest::setBenchmarkResult(percentile(m_dataChangeLatencies, fraction), QTest::WalltimeNanoseconds);
+}
+
+void tst_QOpcUaClientBenchmark::measureDataChangeLatency()
+{
+    const int samples = 500;
+
+    QScopedPointer<QOpcUaNode> node(m_client->node(doubleNodes.first()));
+    QVERIFY(node != nullptr);
+
+    QSignalSpy monitoringSpy(node.get(), &QOpcUaNode::enableMonitoringFinished);
+    QOpcUaMonitoringParameters parameters(10, QOpcUaMonitoringParameters::SubscriptionType::Exclusive);
+    parameters.setSamplingInterval(0);
+    QVERIFY(node->enableMonitoring(QOpcUa::NodeAttribute::Value, parameters));
+    monitoringSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    // The written value is the send time, the latency is measured on arrival of the data change
+    QElapsedTimer clock;
+    clock.start();
+
+    double expected = -1;
+    EventLoopWaiter waiter;
+    std::vector<qint64> latencies;
+
+    connect(node.get(), &QOpcUaNode::dataChangeOccurred, this, [&](QOpcUa::NodeAttribute, const QVariant &value) {
+        if (value.toDouble() != expected)
+            return;
+        latencies.push_back(clock.nsecsElapsed() - static_cast<qint64>(expected));
+        waiter.quit();
+    });
+
+    for (int i = 0; i < samples; ++i) {
+        waiter.reset();
+        expected = static_cast<double>(clock.nsecsElapsed());
+        QVERIFY(node->writeValueAttribute(expected, QOpcUa::Types::Double));
+        QVERIFY(waiter.wait());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    m_dataChangeLatencies = std::move(latencies);
+}
+
+void tst_QOpcUaClientBenchmark::browseCrawl()
+{
+    const int maxRequestsInFlight = 8;
+    int browsedNodes = 0;
+
+    QBENCHMARK {
+        QSet<QString> visited { QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder) };
+        QQueue<QString> frontier;
+        frontier.enqueue(*visited.cbegin());
+        int inFlight = 0;
+        int errors = 0;
+        EventLoopWaiter waiter;
+        QObject nodeOwner; // Deletes the nodes of unfinished requests
+
+        std::function<void()> browseNext = [&]() {
+            while (inFlight < maxRequestsInFlight && !frontier.isEmpty()) {
+                QOpcUaNode *node = m_client->node(frontier.dequeue());
+                if (!node) {
+                    ++errors;
+                    continue;
+                }
+
+                node->setParent(&nodeOwner);
+                connect(node, &QOpcUaNode::browseFinished, &nodeOwner,
+                        [&, node](const QList<QOpcUaReferenceDescription> &children, QOpcUa::UaStatusCode statusCode) {
+                    node->deleteLater();
+                    --inFlight;
+                    if (statusCode != QOpcUa::UaStatusCode::Good)
+                        ++errors;
+
+                    for (const auto &child : children) {
+                        const QString childId = child.targetNodeId().nodeId();
+                        if (!visited.contains(childId)) {
+                            visited.insert(childId);
+                            frontier.enqueue(childId);
+                        }
+                    }
+
+                    browseNext();
+                });
+
+                if (node->browseChildren()) {
+                    ++inFlight;
+                } else {
+                    ++errors;
+                    delete node;
+                }
+            }
+
+            if (inFlight == 0 && frontier.isEmpty())
+                waiter.quit();
+        };
+
+        browseNext();
+        QVERIFY(waiter.wait(60000));
+        QCOMPARE(errors, 0);
+        browsedNodes = visited.size();
+    }
+
+    QVERIFY(browsedNodes > m_largeFolderChildren.size());
+}
+
+void tst_QOpcUaClientBenchmark::historyRead_data()
+{
+    QTest::addColumn<int>("valueCount");
+
+    QTest::newRow("100 values") << 100;
+    QTest::newRow("1000 values") << 1000;
+}
+
+void tst_QOpcUaClientBenchmark::historyRead()
+{
+    QFETCH(int, valueCount);
+
+    // Fill the history up to the requested size
+    static int historySize = 0;
+    QScopedPointer<QOpcUaNode> node(m_client->node(historizingNode));
+    QVERIFY(node != nullptr);
+    QSignalSpy writeSpy(node.get(), &QOpcUaNode::attributeWritten);
+    for (; historySize < valueCount; ++historySize) {
+        writeSpy.clear();
+        QVERIFY(node->writeValueAttribute(historySize, QOpcUa::Types::Int32));
+        writeSpy.wait(signalSpyTimeout);
+        QCOMPARE(writeSpy.size(), 1);
+    }
+
+    const QOpcUaHistoryReadRawRequest request({QOpcUaReadItem(historizingNode)},
+                                              QDateTime::currentDateTime().addDays(-1),
+                                              QDateTime::currentDateTime().addDays(1));
+    qsizetype resultCount = 0;
+
+    QBENCHMARK {
+        QScopedPointer<QOpcUaHistoryReadResponse> response(m_client->readHistoryData(request));
+        QVERIFY(response != nullptr);
+        QSignalSpy readSpy(response.get(), &QOpcUaHistoryReadResponse::readHistoryDataFinished);
+        readSpy.wait(signalSpyTimeout);
+        QCOMPARE(readSpy.size(), 1);
+        QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+        const auto results = readSpy.at(0).at(0).value<QList<QOpcUaHistoryData>>();
+        QCOMPARE(results.size(), 1);
+        resultCount = results.first().count();
+    }
+
+    QVERIFY(resultCount > 0);
+}
+
+QTEST_MAIN(tst_QOpcUaClientBenchmark)
+
+#include "tst_bench_qopcuaclient.moc"
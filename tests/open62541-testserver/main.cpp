@@ -5,8 +5,10 @@
 #include "qopen62541utils.h"
 #include "generated/namespace_qtopcuatestmodel_generated.h"
 
+#include <QtCore/QCommandLineParser>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
+#include <QtCore/QMetaEnum>
 #include <QtCore/QThread>
 #include <QtCore/QVariant>
 #include <QUuid>
@@ -38,8 +40,94 @@ static void signalHandler(int sig) {
     running = false;
 }
 
-int main()
+static bool parseLoadConfiguration(const QCoreApplication &app, LoadConfiguration *config)
 {
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("open62541 based OPC UA server for the Qt OPC UA tests.\n"
+                                                    "The load options add a synthetic namespace for benchmarks."));
+    parser.addHelpOption();
+
+    const QCommandLineOption variablesOption(QStringLiteral("load-variables"),
+                                             QStringLiteral("Number of variables in the load namespace."),
+                                             QStringLiteral("count"), QStringLiteral("0"));
+    const QCommandLineOption typesOption(QStringLiteral("load-types"),
+                                         QStringLiteral("Comma separated list of the variable types, assigned round robin. "
+                                                        "Supported are Boolean, SByte, Byte, Int16, UInt16, Int32, UInt32, "
+                                                        "Int64, UInt64, Float, Double and String."),
+                                         QStringLiteral("types"), QStringLiteral("Double"));
+    const QCommandLineOption arraySizeOption(QStringLiteral("load-array-size"),
+                                             QStringLiteral("Array size of the variables, 0 for scalar variables."),
+                                             QStringLiteral("size"), QStringLiteral("0"));
+    const QCommandLineOption changingOption(QStringLiteral("load-changing"),
+                                            QStringLiteral("Number of variables which change their value."),
+                                            QStringLiteral("count"), QStringLiteral("0"));
+    const QCommandLineOption rateOption(QStringLiteral("load-rate"),
+                                        QStringLiteral("Value changes per second of each changing variable."),
+                                        QStringLiteral("hz"), QStringLiteral("10"));
+    const QCommandLineOption eventRateOption(QStringLiteral("load-event-rate"),
+                                             QStringLiteral("Events per second emitted by the server object."),
+                                             QStringLiteral("hz"), QStringLiteral("0"));
+    const QCommandLineOption historizingOption(QStringLiteral("load-historizing"),
+                                               QStringLiteral("Number of historizing variables."),
+                                               QStringLiteral("count"), QStringLiteral("0"));
+    const QCommandLineOption historyValuesOption(QStringLiteral("load-history-values"),
+                                                 QStringLiteral("Number of values pre-seeded into the history of each historizing variable."),
+                                                 QStringLiteral("count"), QStringLiteral("0"));
+
+    parser.addOptions({ variablesOption, typesOption, arraySizeOption, changingOption, rateOption,
+                        eventRateOption, historizingOption, historyValuesOption });
+    parser.process(app);
+
+    bool ok = true;
+    const auto toUInt = [&parser, &ok](const QCommandLineOption &option) {
+        bool success = false;
+        const auto value = parser.value(option).toUInt(&success);
+        ok = ok && success;
+        return value;
+    };
+    const auto toDouble = [&parser, &ok](const QCommandLineOption &option) {
+        bool success = false;
+        const auto value = parser.value(option).toDouble(&success);
+        ok = ok && success && value >= 0;
+        return value;
+    };
+
+    config->variableCount = toUInt(variablesOption);
+    config->arraySize = toUInt(arraySizeOption);
+    config->changingVariableCount = toUInt(changingOption);
+    config->changeRate = toDouble(rateOption);
+    config->eventRate = toDouble(eventRateOption);
+    config->historizingVariableCount = toUInt(historizingOption);
+    config->historyValueCount = toUInt(historyValuesOption);
+
+    if (!ok) {
+        qCritical() << "Invalid value for a load option";
+        return false;
+    }
+
+    const auto typeEnum = QMetaEnum::fromType<QOpcUa::Types>();
+    config->types.clear();
+    for (const auto &typeName : parser.value(typesOption).split(QLatin1Char(','), Qt::SkipEmptyParts)) {
+        bool isType = false;
+        const auto type = typeEnum.keyToValue(typeName.trimmed().toLatin1().constData(), &isType);
+        if (!isType) {
+            qCritical() << "Unknown type for the load namespace:" << typeName;
+            return false;
+        }
+        config->types.push_back(static_cast<QOpcUa::Types>(type));
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    LoadConfiguration loadConfig;
+    if (!parseLoadConfiguration(app, &loadConfig))
+        return -1;
+
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
 #ifdef Q_OS_MACOS
@@ -321,6 +409,13 @@ int main()
     if (result != UA_STATUSCODE_GOOD)
         qFatal("Failed to initialize decoder test nodeset: %s", UA_StatusCode_name(result));
 
+    if (loadConfig.variableCount || loadConfig.eventRate > 0) {
+        result = server.addLoadNamespace(idx, loadConfig);
+
+        if (result != UA_STATUSCODE_GOOD)
+            qFatal("Failed to initialize the load namespace: %s", UA_StatusCode_name(result));
+    }
+
     result = server.run(&running);
 
     if (result != UA_STATUSCODE_GOOD)
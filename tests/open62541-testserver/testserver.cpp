@@ -18,6 +18,7 @@
 #include <QFile>
 #include <QMap>
 
+#include <cmath>
 #include <cstring>
 
 QT_BEGIN_NAMESPACE
@@ -43,6 +44,9 @@ TestServer::~TestServer()
 {
     m_historyDataBackend.deleteMembers(&m_historyDataBackend);
     UA_Server_delete(m_server);
+
+    for (auto &variable : m_loadVariables)
+        UA_NodeId_clear(&variable.nodeId);
 }
 
 bool TestServer::createInsecureServerConfig(UA_ServerConfig *config)
@@ -983,6 +987,19 @@ UA_StatusCode TestServer::generateEventCallback(UA_Server *server,
     Q_UNUSED(outputSize)
     Q_UNUSED(output)
 
+    quint16 eventSeverity = 100;
+
+    if (inputSize && input[0].type == &UA_TYPES[UA_TYPES_UINT16] && input[0].data) {
+        eventSeverity = *reinterpret_cast<quint16 *>(input[0].data);
+    }
+
+    qDebug() << "Creating event with severity" << eventSeverity;
+
+    return triggerTestEvent(server, eventSeverity);
+}
+
+UA_StatusCode TestServer::triggerTestEvent(UA_Server *server, quint16 eventSeverity)
+{
     // Setup event
     UA_NodeId eventNodeId;
 
@@ -992,14 +1009,6 @@ UA_StatusCode TestServer::generateEventCallback(UA_Server *server,
         return ret;
     }
 
-    quint16 eventSeverity = 100;
-
-    if (inputSize && input[0].type == &UA_TYPES[UA_TYPES_UINT16] && input[0].data) {
-        eventSeverity = *reinterpret_cast<quint16 *>(input[0].data);
-    }
-
-    qDebug() << "Creating event with severity" << eventSeverity;
-
     auto timePropertyName = UA_QUALIFIEDNAME_ALLOC(0, "Time");
     auto severityPropertyName = UA_QUALIFIEDNAME_ALLOC(0, "Severity");
     auto messagePropertyName = UA_QUALIFIEDNAME_ALLOC(0, "Message");
@@ -1511,4 +1520,270 @@ UA_StatusCode TestServer::addEventHistorian(const UA_NodeId &parent)
     return UA_STATUSCODE_GOOD;
 }
 
+// Fills value with a scalar or an array of arraySize elements derived from counter
+static void generateLoadValue(UA_Variant *value, const UA_DataType *type, quint32 arraySize, quint64 counter)
+{
+    const size_t elementCount = arraySize ? arraySize : 1;
+    auto data = static_cast<char *>(UA_Array_new(elementCount, type));
+
+    for (size_t i = 0; i < elementCount; ++i) {
+        const quint64 elementValue = counter + i;
+        void *element = data + i * type->memSize;
+
+        switch (type->typeKind) {
+        case UA_DATATYPEKIND_BOOLEAN:
+            *static_cast<UA_Boolean *>(element) = elementValue & 1;
+            break;
+        case UA_DATATYPEKIND_SBYTE:
+            *static_cast<UA_SByte *>(element) = static_cast<UA_SByte>(elementValue);
+            break;
+        case UA_DATATYPEKIND_BYTE:
+            *static_cast<UA_Byte *>(element) = static_cast<UA_Byte>(elementValue);
+            break;
+        case UA_DATATYPEKIND_INT16:
+            *static_cast<UA_Int16 *>(element) = static_cast<UA_Int16>(elementValue);
+            break;
+        case UA_DATATYPEKIND_UINT16:
+            *static_cast<UA_UInt16 *>(element) = static_cast<UA_UInt16>(elementValue);
+            break;
+        case UA_DATATYPEKIND_INT32:
+            *static_cast<UA_Int32 *>(element) = static_cast<UA_Int32>(elementValue);
+            break;
+        case UA_DATATYPEKIND_UINT32:
+            *static_cast<UA_UInt32 *>(element) = static_cast<UA_UInt32>(elementValue);
+            break;
+        case UA_DATATYPEKIND_INT64:
+            *static_cast<UA_Int64 *>(element) = static_cast<UA_Int64>(elementValue);
+            break;
+        case UA_DATATYPEKIND_UINT64:
+            *static_cast<UA_UInt64 *>(element) = elementValue;
+            break;
+        case UA_DATATYPEKIND_FLOAT:
+            *static_cast<UA_Float *>(element) = static_cast<UA_Float>(100 * std::sin(elementValue * 0.1));
+            break;
+        case UA_DATATYPEKIND_DOUBLE:
+            *static_cast<UA_Double *>(element) = 100 * std::sin(elementValue * 0.1);
+            break;
+        case UA_DATATYPEKIND_STRING:
+            *static_cast<UA_String *>(element) = UA_STRING_ALLOC(QByteArray::number(elementValue).constData());
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (arraySize)
+        UA_Variant_setArray(value, data, elementCount, type);
+    else
+        UA_Variant_setScalar(value, data, type);
+}
+
+static bool isSupportedLoadType(const UA_DataType *type)
+{
+    if (!type)
+        return false;
+
+    switch (type->typeKind) {
+    case UA_DATATYPEKIND_BOOLEAN:
+    case UA_DATATYPEKIND_SBYTE:
+    case UA_DATATYPEKIND_BYTE:
+    case UA_DATATYPEKIND_INT16:
+    case UA_DATATYPEKIND_UINT16:
+    case UA_DATATYPEKIND_INT32:
+    case UA_DATATYPEKIND_UINT32:
+    case UA_DATATYPEKIND_INT64:
+    case UA_DATATYPEKIND_UINT64:
+    case UA_DATATYPEKIND_FLOAT:
+    case UA_DATATYPEKIND_DOUBLE:
+    case UA_DATATYPEKIND_STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Adds the synthetic namespace of the load generator mode.
+// The variables are named ns=<namespaceIndex>;s=Load.Variable.<n> and are distributed over
+// folders of 1000 variables below the folder ns=<namespaceIndex>;s=Load.
+// The first changingVariableCount variables change at changeRate, the first historizingVariableCount
+// variables are historizing and their history is pre-seeded with values in the past.
+UA_StatusCode TestServer::addLoadNamespace(int namespaceIndex, const LoadConfiguration &config)
+{
+    const quint32 variablesPerFolder = 1000;
+
+    QList<const UA_DataType *> types;
+    for (const auto type : config.types) {
+        const auto dataType = QOpen62541ValueConverter::toDataType(type);
+        if (!isSupportedLoadType(dataType)) {
+            qWarning() << "Unsupported type for the load namespace:" << type;
+            return UA_STATUSCODE_BADINVALIDARGUMENT;
+        }
+        types.push_back(dataType);
+    }
+
+    if (types.isEmpty())
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+
+    m_loadConfig = config;
+    m_loadConfig.changingVariableCount = (std::min)(config.changingVariableCount, config.variableCount);
+    m_loadConfig.historizingVariableCount = (std::min)(config.historizingVariableCount, config.variableCount);
+    m_loadVariables.reserve(config.variableCount);
+
+    const auto loadFolder = addFolder(QStringLiteral("ns=%1;s=Load").arg(namespaceIndex), QStringLiteral("Load"));
+    UA_NodeId folderId = UA_NODEID_NULL;
+    UA_StatusCode result = UA_STATUSCODE_GOOD;
+
+    // One value per change interval is pre-seeded, the newest value is one interval in the past
+    const UA_DateTime historyInterval = config.changeRate > 0 ? static_cast<UA_DateTime>(UA_DATETIME_SEC / config.changeRate)
+                                                              : UA_DATETIME_SEC;
+    const UA_DateTime historyStart = UA_DateTime_now() - historyInterval * config.historyValueCount;
+
+    for (quint32 i = 0; i < config.variableCount; ++i) {
+        if (i % variablesPerFolder == 0) {
+            UA_NodeId_clear(&folderId);
+            const QByteArray folderName = QByteArray("Load.Folder.") + QByteArray::number(i / variablesPerFolder);
+
+            UA_ObjectAttributes folderAttr = UA_ObjectAttributes_default;
+            folderAttr.displayName = UA_LOCALIZEDTEXT_ALLOC("en-US", folderName.constData());
+            UA_QualifiedName folderBrowseName = UA_QUALIFIEDNAME_ALLOC(namespaceIndex, folderName.constData());
+            UA_NodeId requestedFolderId = UA_NODEID_STRING_ALLOC(namespaceIndex, folderName.constData());
+
+            result = UA_Server_addObjectNode(m_server, requestedFolderId, loadFolder, UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                             folderBrowseName, UA_NODEID_NUMERIC(0, UA_NS0ID_FOLDERTYPE), folderAttr, nullptr, &folderId);
+
+            UA_NodeId_clear(&requestedFolderId);
+            UA_QualifiedName_clear(&folderBrowseName);
+            UA_ObjectAttributes_clear(&folderAttr);
+
+            if (result != UA_STATUSCODE_GOOD) {
+                qWarning() << "Could not add load folder:" << folderName << UA_StatusCode_name(result);
+                return result;
+            }
+        }
+
+        const UA_DataType *type = types.at(i % types.size());
+        const QByteArray name = QByteArray("Load.Variable.") + QByteArray::number(i);
+        const bool historizing = i < m_loadConfig.historizingVariableCount;
+
+        UA_VariableAttributes attr = UA_VariableAttributes_default;
+        generateLoadValue(&attr.value, type, config.arraySize, i);
+        attr.dataType = type->typeId;
+        attr.valueRank = config.arraySize ? UA_VALUERANK_ONE_DIMENSION : UA_VALUERANK_SCALAR;
+        if (config.arraySize) {
+            attr.arrayDimensionsSize = 1;
+            attr.arrayDimensions = UA_UInt32_new();
+            *attr.arrayDimensions = config.arraySize;
+        }
+        attr.displayName = UA_LOCALIZEDTEXT_ALLOC("en-US", name.constData());
+        attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+        if (historizing)
+            attr.accessLevel |= UA_ACCESSLEVELMASK_HISTORYREAD;
+        attr.historizing = historizing;
+
+        UA_QualifiedName browseName = UA_QUALIFIEDNAME_ALLOC(namespaceIndex, name.constData());
+        UA_NodeId variableId = UA_NODEID_STRING_ALLOC(namespaceIndex, name.constData());
+
+        result = UA_Server_addVariableNode(m_server, variableId, folderId, UA_NODEID_NUMERIC(0, UA_NS0ID_ORGANIZES),
+                                           browseName, UA_NODEID_NUMERIC(0, UA_NS0ID_BASEDATAVARIABLETYPE), attr, nullptr, nullptr);
+
+        UA_QualifiedName_clear(&browseName);
+        UA_VariableAttributes_clear(&attr);
+
+        if (result != UA_STATUSCODE_GOOD) {
+            qWarning() << "Could not add load variable:" << name << UA_StatusCode_name(result);
+            UA_NodeId_clear(&variableId);
+            UA_NodeId_clear(&folderId);
+            return result;
+        }
+
+        m_loadVariables.push_back({variableId, type});
+
+        if (!historizing)
+            continue;
+
+        UA_HistorizingNodeIdSettings setting;
+        setting.historizingBackend = m_historyDataBackend;
+        setting.maxHistoryDataResponseSize = 1000;
+        setting.historizingUpdateStrategy = UA_HISTORIZINGUPDATESTRATEGY_VALUESET;
+        result = m_gathering.registerNodeId(m_server, m_gathering.context, &variableId, setting);
+        if (result != UA_STATUSCODE_GOOD) {
+            qWarning() << "Could not register load variable for historical data:" << name << UA_StatusCode_name(result);
+            UA_NodeId_clear(&folderId);
+            return result;
+        }
+
+        for (quint32 j = 0; j < config.historyValueCount; ++j) {
+            UA_DataValue value;
+            UA_DataValue_init(&value);
+            generateLoadValue(&value.value, type, config.arraySize, j);
+            value.hasValue = true;
+            value.sourceTimestamp = historyStart + j * historyInterval;
+            value.hasSourceTimestamp = true;
+            value.serverTimestamp = value.sourceTimestamp;
+            value.hasServerTimestamp = true;
+
+            result = m_historyDataBackend.serverSetHistoryData(m_server, m_historyDataBackend.context, nullptr, nullptr,
+                                                               &variableId, true, &value);
+            UA_DataValue_clear(&value);
+
+            if (result != UA_STATUSCODE_GOOD) {
+                qWarning() << "Could not pre-seed the history of" << name << UA_StatusCode_name(result);
+                UA_NodeId_clear(&folderId);
+                return result;
+            }
+        }
+    }
+
+    UA_NodeId_clear(&folderId);
+
+    if (m_loadConfig.changingVariableCount && config.changeRate > 0) {
+        result = UA_Server_addRepeatedCallback(m_server, changeLoadVariablesCallback, this, 1000 / config.changeRate, nullptr);
+        if (result != UA_STATUSCODE_GOOD) {
+            qWarning() << "Could not add the value change callback:" << UA_StatusCode_name(result);
+            return result;
+        }
+    }
+
+    if (config.eventRate > 0) {
+        // The callback interval is at least one millisecond, higher rates trigger multiple events per callback
+        const double interval = (std::max)(1.0, 1000 / config.eventRate);
+        m_loadEventsPerCallback = (std::max)(1u, static_cast<quint32>(std::lround(config.eventRate * interval / 1000)));
+        result = UA_Server_addRepeatedCallback(m_server, generateLoadEventsCallback, this, interval, nullptr);
+        if (result != UA_STATUSCODE_GOOD) {
+            qWarning() << "Could not add the event generator callback:" << UA_StatusCode_name(result);
+            return result;
+        }
+    }
+
+    qDebug() << "Added load namespace with" << config.variableCount << "variables," << m_loadConfig.changingVariableCount
+             << "changing at" << config.changeRate << "Hz," << m_loadConfig.historizingVariableCount << "historizing and"
+             << config.eventRate << "events per second";
+
+    return UA_STATUSCODE_GOOD;
+}
+
+void TestServer::changeLoadVariablesCallback(UA_Server *server, void *data)
+{
+    auto testServer = static_cast<TestServer *>(data);
+    const quint64 counter = ++testServer->m_loadCounter;
+
+    for (quint32 i = 0; i < testServer->m_loadConfig.changingVariableCount; ++i) {
+        const auto &variable = testServer->m_loadVariables[i];
+
+        UA_Variant value;
+        UA_Variant_init(&value);
+        generateLoadValue(&value, variable.type, testServer->m_loadConfig.arraySize, counter + i);
+        UA_Server_writeValue(server, variable.nodeId, value);
+        UA_Variant_clear(&value);
+    }
+}
+
+void TestServer::generateLoadEventsCallback(UA_Server *server, void *data)
+{
+    auto testServer = static_cast<TestServer *>(data);
+
+    for (quint32 i = 0; i < testServer->m_loadEventsPerCallback; ++i)
+        triggerTestEvent(server, 100);
+}
+
 QT_END_NAMESPACE
@@ -13,6 +13,8 @@
 #include <QtCore/QVariant>
 #include <QtCore/QList>
 
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
 class ManagedUaNodeId {
@@ -45,6 +47,19 @@ private:
     std::shared_ptr<UA_NodeId> m_nodeId;
 };
 
+// Describes the synthetic namespace of the load generator mode
+struct LoadConfiguration
+{
+    quint32 variableCount = 0;
+    QList<QOpcUa::Types> types { QOpcUa::Types::Double }; // Assigned round robin to the variables
+    quint32 arraySize = 0; // 0 creates scalar variables
+    quint32 changingVariableCount = 0;
+    double changeRate = 10; // Value changes per second of each changing variable
+    double eventRate = 0; // Events per second
+    quint32 historizingVariableCount = 0;
+    quint32 historyValueCount = 0; // Values pre-seeded into the history of each historizing variable
+};
+
 class TestServer : public QObject
 {
     Q_OBJECT
@@ -83,6 +98,8 @@ public:
 
     UA_StatusCode addUnreadableVariableNode(const UA_NodeId &parent);
 
+    UA_StatusCode addLoadNamespace(int namespaceIndex, const LoadConfiguration &config);
+
     static UA_StatusCode multiplyMethod(UA_Server *server, const UA_NodeId *sessionId, void *sessionHandle,
                                             const UA_NodeId *methodId, void *methodContext,
                                             const UA_NodeId *objectId, void *objectContext,
@@ -120,6 +137,11 @@ public:
                                   UA_HistoryReadResponse *response,
                                   UA_HistoryEvent * const * const historyData);
 
+    static UA_StatusCode triggerTestEvent(UA_Server *server, quint16 severity);
+
+    static void changeLoadVariablesCallback(UA_Server *server, void *data);
+    static void generateLoadEventsCallback(UA_Server *server, void *data);
+
     static UA_StatusCode readLocalizedTextCallback(UA_Server *server, const UA_NodeId *sessionId,
                                                    void *sessionContext, const UA_NodeId *nodeId,
                                                    void *nodeContext, UA_Boolean includeSourceTimeStamp,
@@ -129,6 +151,15 @@ public:
     UA_Server *m_server{nullptr};
     UA_HistoryDataGathering m_gathering;
     UA_HistoryDataBackend m_historyDataBackend;
+
+    struct LoadVariable {
+        UA_NodeId nodeId;
+        const UA_DataType *type;
+    };
+    std::vector<LoadVariable> m_loadVariables;
+    LoadConfiguration m_loadConfig;
+    quint64 m_loadCounter = 0;
+    quint32 m_loadEventsPerCallback = 0;
 public slots:
     UA_StatusCode run(volatile bool *running);
 };
@@ -6,6 +6,10 @@
 #include <QDebug>
 #include <QFile>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 /*
  * This generator should be run if there is a new version of the NodeIds.csv or StatusCode.csv file
  * available in https://opcfoundation.org/UA/schemas/1.05/
@@ -17,7 +21,8 @@
  * qtopcua-internal-generator -n NodeIds.csv -s StatusCode.csv -o /path/to/qtopcua
  *
  * This updates qopcuanodeids.h, qopcuanodeids.cpp, qopcuatype.h, qopcuatype.cpp,
- * opcuastatus_p.h and opcuastatus.cpp with the most recent status codes and node ids.
+ * opcuastatus_p.h and opcuastatus.cpp with the most recent status codes and node ids
+ * and regenerates the lookup tables in qopcuanodeidtable_p.h and qopcuastatuscodetable_p.h.
  * The Qt OPC UA module must be rebuilt after running the generator.
 */
 
@@ -234,6 +239,181 @@ bool patchQmlStatusCodeSource(const QList<StatusCode> &statusCodes, const QStrin
     return patchFile(path, startMarker, endMarker, newContent);
 }
 
+bool writeFile(const QString &path, const QString &content)
+{
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly | QFile::Truncate)) {
+        qWarning() << "Failed to open" << path << "for writing";
+        return false;
+    }
+
+    QTextStream out(&file);
+    out << content;
+
+    return true;
+}
+
+void writeTableHeaderStart(QTextStream &out, const QString &guard, const QString &csvFile)
+{
+    out << "// Copyright (C) 2025 The Qt Company Ltd.\n"
+        << "// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only\n\n"
+        << "// This file is generated by qtopcua-internalgenerator from " << csvFile << ", do not edit.\n\n"
+        << "#ifndef " << guard << "\n"
+        << "#define " << guard << "\n\n"
+        << "//\n"
+        << "//  W A R N I N G\n"
+        << "//  -------------\n"
+        << "//\n"
+        << "// This file is not part of the Qt API.  It exists purely as an\n"
+        << "// implementation detail.  This header file may change from version to\n"
+        << "// version without notice, or even be removed.\n"
+        << "//\n"
+        << "// We mean it.\n"
+        << "//\n\n"
+        << "#include <QtCore/qglobal.h>\n\n"
+        << "#include <iterator>\n\n"
+        << "QT_BEGIN_NAMESPACE\n\n";
+}
+
+void writeTableHeaderEnd(QTextStream &out, const QString &guard)
+{
+    out << "QT_END_NAMESPACE\n\n"
+        << "#endif // " << guard << "\n";
+}
+
+template <typename T>
+QList<T> sortedByValue(QList<T> list, int base)
+{
+    std::stable_sort(list.begin(), list.end(), [base](const T &lhs, const T &rhs) {
+        return lhs.value.toUInt(nullptr, base) < rhs.value.toUInt(nullptr, base);
+    });
+    return list;
+}
+
+template <typename T>
+void writeArrayValues(QTextStream &out, const QList<T> &values, qsizetype valuesPerLine)
+{
+    for (qsizetype i = 0; i < values.size(); i += valuesPerLine) {
+        out << "   ";
+        for (qsizetype j = i; j < std::min(i + valuesPerLine, values.size()); ++j)
+            out << " " << values.at(j) << ",";
+        out << "\n";
+    }
+}
+
+// Writes all names into one string and an offset table instead of one pointer per name.
+// This avoids a relocation for each entry when the module is loaded.
+template <typename T>
+void writeNames(QTextStream &out, const QList<T> &entries)
+{
+    QList<quint32> offsets;
+    offsets.reserve(entries.size());
+    quint32 offset = 0;
+    for (const auto &entry : entries) {
+        offsets.push_back(offset);
+        offset += static_cast<quint32>(entry.name.size()) + 1;
+    }
+
+    out << "// Offsets of the names in names, in the same order\n"
+        << "inline constexpr quint32 nameOffsets[] = {\n";
+    writeArrayValues(out, offsets, 16);
+    out << "};\n\n"
+        << "// The names, each terminated by \\0\n"
+        << "inline constexpr char names[] =\n";
+
+    for (qsizetype i = 0; i < entries.size(); ++i)
+        out << "    \"" << entries.at(i).name << "\\0\"" << (i + 1 == entries.size() ? ";\n" : "\n");
+
+    out << "\n"
+        << "static_assert(sizeof(names) == " << offset + 1 << ");\n"
+        << "static_assert(std::size(nameOffsets) == " << entries.size() << ");\n\n"
+        << "constexpr const char *name(qsizetype index)\n"
+        << "{\n"
+        << "    return names + nameOffsets[index];\n"
+        << "}\n\n";
+}
+
+bool writeNodeIdTable(const QList<NodeId> &nodeIds, const QString &path)
+{
+    const auto guard = QStringLiteral("QOPCUANODEIDTABLE_P_H");
+    const auto sorted = sortedByValue(nodeIds, 10);
+
+    if (sorted.size() > std::numeric_limits<quint16>::max()) {
+        qWarning() << "Too many node ids for the name index";
+        return false;
+    }
+
+    QList<QString> ids;
+    ids.reserve(sorted.size());
+    for (const auto &id : sorted)
+        ids.push_back(id.value);
+
+    QList<quint16> byName(sorted.size());
+    std::iota(byName.begin(), byName.end(), 0);
+    std::sort(byName.begin(), byName.end(), [&sorted](quint16 lhs, quint16 rhs) {
+        return sorted.at(lhs).name < sorted.at(rhs).name;
+    });
+
+    QString content;
+    QTextStream out(&content);
+
+    writeTableHeaderStart(out, guard, QStringLiteral("NodeIds.csv"));
+
+    out << "// Lookup tables for QOpcUa::NodeIds::Namespace0 which don't require the meta object\n"
+        << "namespace QOpcUaNodeIdTable {\n\n"
+        << "// Sorted by id\n"
+        << "inline constexpr quint32 ids[] = {\n";
+    writeArrayValues(out, ids, 16);
+    out << "};\n\n";
+
+    writeNames(out, sorted);
+
+    out << "// Indices into ids, sorted by name\n"
+        << "inline constexpr quint16 entriesByName[] = {\n";
+    writeArrayValues(out, byName, 16);
+    out << "};\n\n"
+        << "static_assert(std::size(ids) == std::size(nameOffsets));\n"
+        << "static_assert(std::size(ids) == std::size(entriesByName));\n\n"
+        << "} // namespace QOpcUaNodeIdTable\n\n";
+
+    writeTableHeaderEnd(out, guard);
+
+    return writeFile(path, content);
+}
+
+bool writeStatusCodeTable(const QList<StatusCode> &statusCodes, const QString &path)
+{
+    const auto guard = QStringLiteral("QOPCUASTATUSCODETABLE_P_H");
+    const auto sorted = sortedByValue(statusCodes, 16);
+
+    QList<QString> codes;
+    codes.reserve(sorted.size());
+    for (const auto &statusCode : sorted)
+        codes.push_back(statusCode.value);
+
+    QString content;
+    QTextStream out(&content);
+
+    writeTableHeaderStart(out, guard, QStringLiteral("StatusCode.csv"));
+
+    out << "// Lookup table for QOpcUa::UaStatusCode which doesn't require the meta object\n"
+        << "namespace QOpcUaStatusCodeTable {\n\n"
+        << "// Sorted by code\n"
+        << "inline constexpr quint32 codes[] = {\n";
+    writeArrayValues(out, codes, 8);
+    out << "};\n\n";
+
+    writeNames(out, sorted);
+
+    out << "static_assert(std::size(codes) == std::size(nameOffsets));\n\n"
+        << "} // namespace QOpcUaStatusCodeTable\n\n";
+
+    writeTableHeaderEnd(out, guard);
+
+    return writeFile(path, content);
+}
+
 int main(int argc, char *argv[])
 {
     QCoreApplication app(argc, argv);
@@ -265,6 +445,7 @@ int main(int argc, char *argv[])
     if (parser.isSet(nOption)) {
         const auto nodeIdsHeaderPath = QStringLiteral("%1/src/opcua/client/qopcuanodeids.h").arg(parser.value(oOption));
         const auto nodeIdsSourcePath = QStringLiteral("%1/src/opcua/client/qopcuanodeids.cpp").arg(parser.value(oOption));
+        const auto nodeIdTablePath = QStringLiteral("%1/src/opcua/client/qopcuanodeidtable_p.h").arg(parser.value(oOption));
 
         const auto nodeIds = parseNodeIds(parser.value(nOption));
 
@@ -278,6 +459,9 @@ int main(int argc, char *argv[])
             patchNodeIdsSource(nodeIds, nodeIdsSourcePath);
         else
             return EXIT_FAILURE;
+
+        if (!writeNodeIdTable(nodeIds, nodeIdTablePath))
+            return EXIT_FAILURE;
     }
 
     if (parser.isSet(sOption)) {
@@ -285,6 +469,7 @@ int main(int argc, char *argv[])
         const auto typeSourcePath = QStringLiteral("%1/src/opcua/client/qopcuatype.cpp").arg(parser.value(oOption));
         const auto qmlStatusHeaderPath = QStringLiteral("%1/src/declarative_opcua/opcuastatus_p.h").arg(parser.value(oOption));
         const auto qmlStatusSourcePath = QStringLiteral("%1/src/declarative_opcua/opcuastatus.cpp").arg(parser.value(oOption));
+        const auto statusCodeTablePath = QStringLiteral("%1/src/opcua/client/qopcuastatuscodetable_p.h").arg(parser.value(oOption));
 
         const auto statusCodes = parseStatusCodes(parser.value(sOption));
 
@@ -300,6 +485,8 @@ int main(int argc, char *argv[])
             success = patchQmlStatusCodeHeader(statusCodes, qmlStatusHeaderPath);
         if (success)
             success = patchQmlStatusCodeSource(statusCodes, qmlStatusSourcePath);
+        if (success)
+            success = writeStatusCodeTable(statusCodes, statusCodeTablePath);
     }
 
     return success ? EXIT_SUCCESS : EXIT_SUCCESS;